@@ -0,0 +1,45 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatMassFragments.h"
+
+FStatMassStat* FStatMassStatsFragment::Find(EStatType StatType)
+{
+	for (int32 Index = 0; Index < NumStats; ++Index)
+	{
+		if (Stats[Index].StatType == StatType)
+		{
+			return &Stats[Index];
+		}
+	}
+	return nullptr;
+}
+
+const FStatMassStat* FStatMassStatsFragment::Find(EStatType StatType) const
+{
+	return const_cast<FStatMassStatsFragment*>(this)->Find(StatType);
+}
+
+bool FStatMassStatsFragment::Set(const FStatMassStat& Stat)
+{
+	if (FStatMassStat* Existing = Find(Stat.StatType))
+	{
+		*Existing = Stat;
+		return true;
+	}
+
+	if (NumStats >= StatMass::MaxStats)
+	{
+		return false;
+	}
+
+	Stats[NumStats++] = Stat;
+	return true;
+}
+
+void FStatMassStatsFragment::ApplyDelta(EStatType StatType, float Amount)
+{
+	if (FStatMassStat* Stat = Find(StatType))
+	{
+		Stat->CurrentValue = FMath::Clamp(Stat->CurrentValue + Amount, 0.0f, Stat->MaxValue);
+	}
+}
@@ -0,0 +1,169 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatMassProcessors.h"
+#include "StatMassFragments.h"
+#include "Simulation/StatSurvivalFormulas.h"
+#include "MassExecutionContext.h"
+#include "MassCommandBuffer.h"
+
+const FName StatMass::ProcessorGroup = TEXT("StatSystemPro");
+
+namespace StatMass
+{
+	/** Skip entities owned by components, and dead ones */
+	static void ExcludeInactive(FMassEntityQuery& Query)
+	{
+		Query.AddTagRequirement<FStatMassPromotedTag>(EMassFragmentPresence::None);
+		Query.AddTagRequirement<FStatMassDeadTag>(EMassFragmentPresence::None);
+	}
+}
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+UStatMassBodyProcessor::UStatMassBodyProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = (int32)(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+	ExecutionOrder.ExecuteInGroup = StatMass::ProcessorGroup;
+}
+
+void UStatMassBodyProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FStatMassStatsFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FStatMassBodyFragment>(EMassFragmentAccess::ReadWrite);
+	StatMass::ExcludeInactive(EntityQuery);
+}
+
+void UStatMassBodyProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [](FMassExecutionContext& Context)
+	{
+		const float DeltaTime = Context.GetDeltaTimeSeconds();
+		const TArrayView<FStatMassStatsFragment> StatsList = Context.GetMutableFragmentView<FStatMassStatsFragment>();
+		const TArrayView<FStatMassBodyFragment> BodyList = Context.GetMutableFragmentView<FStatMassBodyFragment>();
+
+		for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
+		{
+			FStatMassStatsFragment& Stats = StatsList[EntityIndex];
+			FStatMassBodyFragment& Body = BodyList[EntityIndex];
+
+			if (Body.BleedingRate > 0.0f)
+			{
+				Stats.ApplyDelta(EStatType::BloodLevel, -StatSurvivalFormulas::BloodLoss(Body.BleedingRate, DeltaTime));
+			}
+
+			if (Body.InfectionLevel > 0.0f)
+			{
+				Body.InfectionLevel = StatSurvivalFormulas::GrowInfection(Body.InfectionLevel, DeltaTime);
+				Stats.ApplyDelta(EStatType::Infection_Level, StatSurvivalFormulas::InfectionStatRate * DeltaTime);
+			}
+		}
+	});
+}
+
+// ============================================================================
+// THERMAL
+// ============================================================================
+
+UStatMassThermalProcessor::UStatMassThermalProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = (int32)(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+	ExecutionOrder.ExecuteInGroup = StatMass::ProcessorGroup;
+	ExecutionOrder.ExecuteAfter.Add(UStatMassBodyProcessor::StaticClass()->GetFName());
+}
+
+void UStatMassThermalProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FStatMassStatsFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FStatMassThermalFragment>(EMassFragmentAccess::ReadOnly);
+	StatMass::ExcludeInactive(EntityQuery);
+}
+
+void UStatMassThermalProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [](FMassExecutionContext& Context)
+	{
+		const float DeltaTime = Context.GetDeltaTimeSeconds();
+		const TArrayView<FStatMassStatsFragment> StatsList = Context.GetMutableFragmentView<FStatMassStatsFragment>();
+		const TConstArrayView<FStatMassThermalFragment> ThermalList = Context.GetFragmentView<FStatMassThermalFragment>();
+
+		TArray<FStatDelta> Deltas;
+		for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
+		{
+			FStatMassStatsFragment& Stats = StatsList[EntityIndex];
+			FStatMassStat* BodyTemperature = Stats.Find(EStatType::BodyTemperature);
+			if (!BodyTemperature)
+			{
+				continue;
+			}
+
+			// Same response as UStatSystemProComponent's weather layer
+			const float TempChange = StatSurvivalFormulas::ApproachTemperature(BodyTemperature->CurrentValue,
+				ThermalList[EntityIndex].EnvironmentTemperature, StatSurvivalFormulas::BodyTemperatureResponse, DeltaTime);
+			BodyTemperature->CurrentValue = FMath::Clamp(BodyTemperature->CurrentValue + TempChange, 0.0f, BodyTemperature->MaxValue);
+
+			// Freezing/overheating drains, staged on the new body temperature (as UWeatherComponent)
+			const float BodyTemp = BodyTemperature->CurrentValue;
+			Deltas.Reset();
+			StatSurvivalFormulas::AddTemperatureEffectDeltas(
+				StatSurvivalFormulas::GetFreezingStage(BodyTemp), StatSurvivalFormulas::GetOverheatingStage(BodyTemp), DeltaTime, Deltas);
+
+			for (const FStatDelta& Delta : Deltas)
+			{
+				Stats.ApplyDelta(Delta.StatType, Delta.Amount);
+			}
+		}
+	});
+}
+
+// ============================================================================
+// REGENERATION
+// ============================================================================
+
+UStatMassRegenerationProcessor::UStatMassRegenerationProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = (int32)(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+	ExecutionOrder.ExecuteInGroup = StatMass::ProcessorGroup;
+	ExecutionOrder.ExecuteAfter.Add(UStatMassBodyProcessor::StaticClass()->GetFName());
+	ExecutionOrder.ExecuteAfter.Add(UStatMassThermalProcessor::StaticClass()->GetFName());
+}
+
+void UStatMassRegenerationProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FStatMassStatsFragment>(EMassFragmentAccess::ReadWrite);
+	StatMass::ExcludeInactive(EntityQuery);
+}
+
+void UStatMassRegenerationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [](FMassExecutionContext& Context)
+	{
+		const float DeltaTime = Context.GetDeltaTimeSeconds();
+		const TArrayView<FStatMassStatsFragment> StatsList = Context.GetMutableFragmentView<FStatMassStatsFragment>();
+
+		for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
+		{
+			FStatMassStatsFragment& Stats = StatsList[EntityIndex];
+
+			for (int32 StatIndex = 0; StatIndex < Stats.NumStats; ++StatIndex)
+			{
+				FStatMassStat& Stat = Stats.Stats[StatIndex];
+				if (!FMath::IsNearlyZero(Stat.RegenerationRate))
+				{
+					Stat.CurrentValue = StatSurvivalFormulas::Regenerate(Stat.CurrentValue, Stat.MaxValue, Stat.RegenerationRate, DeltaTime);
+				}
+			}
+
+			// Last processor of the frame, so this sees every drain
+			const FStatMassStat* Health = Stats.Find(EStatType::Health_Core);
+			if (Health && Health->CurrentValue <= 0.0f)
+			{
+				Context.Defer().AddTag<FStatMassDeadTag>(Context.GetEntity(EntityIndex));
+			}
+		}
+	});
+}
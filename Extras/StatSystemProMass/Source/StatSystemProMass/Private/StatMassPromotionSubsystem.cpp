@@ -0,0 +1,151 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatMassPromotionSubsystem.h"
+#include "StatMassFragments.h"
+#include "StatLayer/StatComponent.h"
+#include "BodyLayer/BodyComponent.h"
+#include "EnvironmentLayer/EnvironmentComponent.h"
+#include "MassEntitySubsystem.h"
+#include "MassEntityManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+namespace StatMassPromotion
+{
+	/** A Mass entity's body is one part - promoted bleeding/infection land on the torso */
+	static constexpr EBodyPart PromotedBodyPart = EBodyPart::Torso;
+}
+
+bool UStatMassPromotionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Promotion only happens in game worlds
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FMassEntityManager* UStatMassPromotionSubsystem::GetEntityManager() const
+{
+	UMassEntitySubsystem* MassSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UMassEntitySubsystem>() : nullptr;
+	return MassSubsystem ? &MassSubsystem->GetMutableEntityManager() : nullptr;
+}
+
+template<typename ComponentType>
+ComponentType* UStatMassPromotionSubsystem::FindOrAddComponent(AActor& Actor)
+{
+	if (ComponentType* Existing = Actor.FindComponentByClass<ComponentType>())
+	{
+		return Existing;
+	}
+
+	// Registering on a playing actor runs BeginPlay (stats get initialized)
+	ComponentType* Component = NewObject<ComponentType>(&Actor, ComponentType::StaticClass());
+	Actor.AddInstanceComponent(Component);
+	Component->RegisterComponent();
+	return Component;
+}
+
+bool UStatMassPromotionSubsystem::IsEntityPromoted(FMassEntityHandle Entity) const
+{
+	const FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !EntityManager->IsEntityValid(Entity))
+	{
+		return false;
+	}
+
+	const FMassArchetypeHandle Archetype = EntityManager->GetArchetypeForEntity(Entity);
+	return EntityManager->GetArchetypeComposition(Archetype).Tags.Contains<FStatMassPromotedTag>();
+}
+
+UStatComponent* UStatMassPromotionSubsystem::PromoteEntity(FMassEntityHandle Entity, AActor* Actor)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!Actor || !EntityManager || !EntityManager->IsEntityValid(Entity))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PromoteEntity: Invalid entity or actor"));
+		return nullptr;
+	}
+
+	const FStatMassStatsFragment* StatsFragment = EntityManager->GetFragmentDataPtr<FStatMassStatsFragment>(Entity);
+	if (!StatsFragment)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PromoteEntity: Entity has no StatSystemPro stats"));
+		return nullptr;
+	}
+
+	// Stats
+	UStatComponent* StatComponent = FindOrAddComponent<UStatComponent>(*Actor);
+	for (int32 Index = 0; Index < StatsFragment->Num(); ++Index)
+	{
+		const FStatMassStat& Stat = StatsFragment->Stats[Index];
+		StatComponent->SetStatMaxValue(Stat.StatType, Stat.MaxValue);
+		StatComponent->SetStatValue(Stat.StatType, Stat.CurrentValue);
+		StatComponent->SetStatRegenerationRate(Stat.StatType, Stat.RegenerationRate);
+	}
+
+	// Bleeding / infection
+	if (const FStatMassBodyFragment* Body = EntityManager->GetFragmentDataPtr<FStatMassBodyFragment>(Entity))
+	{
+		UBodyComponent* BodyComponent = FindOrAddComponent<UBodyComponent>(*Actor);
+		BodyComponent->SetBleedingRate(StatMassPromotion::PromotedBodyPart, Body->BleedingRate);
+
+		const float Infection = Body->InfectionLevel - BodyComponent->GetBodyPartState(StatMassPromotion::PromotedBodyPart).InfectionRate;
+		if (Infection > 0.0f)
+		{
+			BodyComponent->ApplyInfection(StatMassPromotion::PromotedBodyPart, Infection);
+		}
+	}
+
+	// Temperature (environment is usually driven by the level, so only an existing component is updated)
+	if (const FStatMassThermalFragment* Thermal = EntityManager->GetFragmentDataPtr<FStatMassThermalFragment>(Entity))
+	{
+		if (UEnvironmentComponent* EnvironmentComponent = Actor->FindComponentByClass<UEnvironmentComponent>())
+		{
+			EnvironmentComponent->SetAmbientTemperature(Thermal->EnvironmentTemperature);
+		}
+	}
+
+	EntityManager->AddTagToEntity(Entity, FStatMassPromotedTag::StaticStruct());
+	return StatComponent;
+}
+
+void UStatMassPromotionSubsystem::DemoteEntity(FMassEntityHandle Entity, AActor* Actor)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!Actor || !EntityManager || !EntityManager->IsEntityValid(Entity))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DemoteEntity: Invalid entity or actor"));
+		return;
+	}
+
+	// Stats (the entity keeps its own stat set - only values the component has are copied back)
+	FStatMassStatsFragment* StatsFragment = EntityManager->GetFragmentDataPtr<FStatMassStatsFragment>(Entity);
+	const UStatComponent* StatComponent = Actor->FindComponentByClass<UStatComponent>();
+	if (StatsFragment && StatComponent)
+	{
+		for (int32 Index = 0; Index < StatsFragment->Num(); ++Index)
+		{
+			FStatMassStat& Stat = StatsFragment->Stats[Index];
+			if (StatComponent->HasStat(Stat.StatType))
+			{
+				Stat.MaxValue = StatComponent->GetStatMaxValue(Stat.StatType);
+				Stat.CurrentValue = StatComponent->GetStatValue(Stat.StatType);
+			}
+		}
+	}
+
+	// Bleeding / infection collapse back into one body
+	FStatMassBodyFragment* Body = EntityManager->GetFragmentDataPtr<FStatMassBodyFragment>(Entity);
+	const UBodyComponent* BodyComponent = Actor->FindComponentByClass<UBodyComponent>();
+	if (Body && BodyComponent)
+	{
+		Body->BleedingRate = BodyComponent->GetTotalBleedingRate();
+
+		float Infection = 0.0f;
+		for (int32 PartIndex = 0; PartIndex < (int32)EBodyPart::MAX; ++PartIndex)
+		{
+			Infection = FMath::Max(Infection, BodyComponent->GetBodyPartState((EBodyPart)PartIndex).InfectionRate);
+		}
+		Body->InfectionLevel = Infection;
+	}
+
+	EntityManager->RemoveTagFromEntity(Entity, FStatMassPromotedTag::StaticStruct());
+}
@@ -0,0 +1,26 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatMassTrait.h"
+#include "MassEntityTemplateRegistry.h"
+
+void UStatMassTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	FStatMassStatsFragment& StatsFragment = BuildContext.AddFragment_GetRef<FStatMassStatsFragment>();
+	for (const FStatMassStat& Stat : Stats)
+	{
+		if (!StatsFragment.Set(Stat))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UStatMassTrait: More than %d stats - stat %d ignored"), StatMass::MaxStats, (int32)Stat.StatType);
+		}
+	}
+
+	if (bSimulateBody)
+	{
+		BuildContext.AddFragment_GetRef<FStatMassBodyFragment>() = Body;
+	}
+
+	if (bSimulateThermal)
+	{
+		BuildContext.AddFragment_GetRef<FStatMassThermalFragment>() = Thermal;
+	}
+}
@@ -0,0 +1,18 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatSystemProMass.h"
+
+#define LOCTEXT_NAMESPACE "FStatSystemProMassModule"
+
+void FStatSystemProMassModule::StartupModule()
+{
+	// Processors register themselves with the Mass processing phases
+}
+
+void FStatSystemProMassModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FStatSystemProMassModule, StatSystemProMass)
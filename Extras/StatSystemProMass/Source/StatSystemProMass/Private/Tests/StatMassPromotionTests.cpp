@@ -0,0 +1,131 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "StatMassPromotionSubsystem.h"
+#include "StatMassFragments.h"
+#include "StatLayer/StatComponent.h"
+#include "BodyLayer/BodyComponent.h"
+#include "MassEntitySubsystem.h"
+#include "MassEntityManager.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace StatMassPromotionTests
+{
+	/** Throwaway game world with Mass and the promotion subsystem running */
+	struct FTestWorld
+	{
+		UWorld* World = nullptr;
+
+		FTestWorld()
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false);
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+
+			World->InitializeActorsForPlay(FURL());
+			World->BeginPlay();
+		}
+
+		~FTestWorld()
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+	};
+
+	static FStatMassStat MakeStat(EStatType StatType, float CurrentValue, float MaxValue)
+	{
+		FStatMassStat Stat;
+		Stat.StatType = StatType;
+		Stat.CurrentValue = CurrentValue;
+		Stat.MaxValue = MaxValue;
+		Stat.RegenerationRate = 0.0f;
+		return Stat;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStatMassPromotionRoundTripTest, "StatSystemPro.Mass.PromoteDemoteRoundTrip",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FStatMassPromotionRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace StatMassPromotionTests;
+
+	FTestWorld TestWorld;
+	UWorld* World = TestWorld.World;
+
+	UMassEntitySubsystem* MassSubsystem = World->GetSubsystem<UMassEntitySubsystem>();
+	UStatMassPromotionSubsystem* Promotion = World->GetSubsystem<UStatMassPromotionSubsystem>();
+	if (!TestNotNull(TEXT("Mass entity subsystem"), MassSubsystem) || !TestNotNull(TEXT("Promotion subsystem"), Promotion))
+	{
+		return false;
+	}
+
+	// Entity simulated by Mass: wounded, tired, bleeding and infected
+	FMassEntityManager& EntityManager = MassSubsystem->GetMutableEntityManager();
+	const FMassArchetypeHandle Archetype = EntityManager.CreateArchetype({ FStatMassStatsFragment::StaticStruct(), FStatMassBodyFragment::StaticStruct() });
+	const FMassEntityHandle Entity = EntityManager.CreateEntity(Archetype);
+
+	FStatMassStatsFragment& Stats = EntityManager.GetFragmentDataChecked<FStatMassStatsFragment>(Entity);
+	Stats.Set(MakeStat(EStatType::Health_Core, 40.0f, 100.0f));
+	Stats.Set(MakeStat(EStatType::Stamina, 25.0f, 80.0f));
+
+	FStatMassBodyFragment& Body = EntityManager.GetFragmentDataChecked<FStatMassBodyFragment>(Entity);
+	Body.BleedingRate = 2.0f;
+	Body.InfectionLevel = 30.0f;
+
+	AActor* Actor = World->SpawnActor<AActor>();
+	if (!TestNotNull(TEXT("Spawned actor"), Actor))
+	{
+		return false;
+	}
+
+	// Promote - the components pick up the entity's state
+	UStatComponent* StatComponent = Promotion->PromoteEntity(Entity, Actor);
+	UBodyComponent* BodyComponent = Actor->FindComponentByClass<UBodyComponent>();
+	if (!TestNotNull(TEXT("Promoted stat component"), StatComponent) || !TestNotNull(TEXT("Promoted body component"), BodyComponent))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Entity is promoted"), Promotion->IsEntityPromoted(Entity));
+	TestEqual(TEXT("Promoted health"), StatComponent->GetStatValue(EStatType::Health_Core), 40.0f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Promoted stamina"), StatComponent->GetStatValue(EStatType::Stamina), 25.0f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Promoted stamina max"), StatComponent->GetStatMaxValue(EStatType::Stamina), 80.0f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Promoted bleeding"), BodyComponent->GetTotalBleedingRate(), 2.0f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Promoted infection"), BodyComponent->GetBodyPartState(EBodyPart::Torso).InfectionRate, 30.0f, KINDA_SMALL_NUMBER);
+
+	// Gameplay on the promoted actor
+	StatComponent->ApplyStatChange(EStatType::Health_Core, -15.0f);
+	BodyComponent->SetBleedingRate(EBodyPart::Torso, 0.5f);
+
+	// Demote - the entity resumes from the components' state
+	Promotion->DemoteEntity(Entity, Actor);
+
+	TestFalse(TEXT("Entity is demoted"), Promotion->IsEntityPromoted(Entity));
+
+	const FStatMassStatsFragment& DemotedStats = EntityManager.GetFragmentDataChecked<FStatMassStatsFragment>(Entity);
+	const FStatMassStat* Health = DemotedStats.Find(EStatType::Health_Core);
+	const FStatMassStat* Stamina = DemotedStats.Find(EStatType::Stamina);
+	if (TestNotNull(TEXT("Demoted health"), Health) && TestNotNull(TEXT("Demoted stamina"), Stamina))
+	{
+		TestEqual(TEXT("Demoted health"), Health->CurrentValue, 25.0f, KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Demoted stamina"), Stamina->CurrentValue, 25.0f, KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Demoted stamina max"), Stamina->MaxValue, 80.0f, KINDA_SMALL_NUMBER);
+	}
+
+	const FStatMassBodyFragment& DemotedBody = EntityManager.GetFragmentDataChecked<FStatMassBodyFragment>(Entity);
+	TestEqual(TEXT("Demoted bleeding"), DemotedBody.BleedingRate, 0.5f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Demoted infection"), DemotedBody.InfectionLevel, 30.0f, KINDA_SMALL_NUMBER);
+
+	EntityManager.DestroyEntity(Entity);
+	Actor->Destroy();
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
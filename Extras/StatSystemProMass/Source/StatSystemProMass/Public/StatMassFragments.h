@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "StatLayer/StatTypes.h"
+#include "StatMassFragments.generated.h"
+
+namespace StatMass
+{
+	/** Most stats one entity simulates (a horde NPC typically needs health, stamina, blood and body temperature) */
+	inline constexpr int32 MaxStats = 8;
+}
+
+/**
+ * One simulated stat on a Mass entity
+ */
+USTRUCT(BlueprintType)
+struct STATSYSTEMPROMASS_API FStatMassStat
+{
+	GENERATED_BODY()
+
+	/** Which stat */
+	UPROPERTY(EditAnywhere, Category = "Stat")
+	EStatType StatType = EStatType::Health_Core;
+
+	/** Current value */
+	UPROPERTY(EditAnywhere, Category = "Stat")
+	float CurrentValue = 100.0f;
+
+	/** Maximum value */
+	UPROPERTY(EditAnywhere, Category = "Stat")
+	float MaxValue = 100.0f;
+
+	/** Regeneration per second (negative = decay) */
+	UPROPERTY(EditAnywhere, Category = "Stat")
+	float RegenerationRate = 0.0f;
+};
+
+/**
+ * Stats of a Mass entity - a fixed handful, stored inline (no heap, no delegates)
+ */
+USTRUCT()
+struct STATSYSTEMPROMASS_API FStatMassStatsFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	/** Find a stat (nullptr if the entity doesn't simulate it) */
+	FStatMassStat* Find(EStatType StatType);
+	const FStatMassStat* Find(EStatType StatType) const;
+
+	/** Add a stat, or overwrite it if present. Returns false when full. */
+	bool Set(const FStatMassStat& Stat);
+
+	/** Change a stat by Amount, clamped to 0-max (no-op if absent) */
+	void ApplyDelta(EStatType StatType, float Amount);
+
+	/** Number of stats in use */
+	int32 Num() const { return NumStats; }
+
+	/** Stats in use are [0, NumStats) */
+	FStatMassStat Stats[StatMass::MaxStats];
+	int32 NumStats = 0;
+};
+
+/**
+ * Body state of a Mass entity - the whole body as one part (per-limb detail comes with promotion)
+ */
+USTRUCT()
+struct STATSYSTEMPROMASS_API FStatMassBodyFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	/** Blood lost per second */
+	UPROPERTY(EditAnywhere, Category = "Body")
+	float BleedingRate = 0.0f;
+
+	/** Infection (0-100), grows while above zero */
+	UPROPERTY(EditAnywhere, Category = "Body")
+	float InfectionLevel = 0.0f;
+};
+
+/**
+ * Thermal state of a Mass entity
+ */
+USTRUCT()
+struct STATSYSTEMPROMASS_API FStatMassThermalFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	/** Temperature the body moves towards (ambient after wind chill, clothing, shelter) - set by game code */
+	UPROPERTY(EditAnywhere, Category = "Thermal")
+	float EnvironmentTemperature = 20.0f;
+};
+
+/**
+ * Entity's simulation is owned by full components on an actor - processors skip it
+ */
+USTRUCT()
+struct STATSYSTEMPROMASS_API FStatMassPromotedTag : public FMassTag
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Entity's Health_Core reached zero (added once, deferred) - query it to react to deaths
+ */
+USTRUCT()
+struct STATSYSTEMPROMASS_API FStatMassDeadTag : public FMassTag
+{
+	GENERATED_BODY()
+};
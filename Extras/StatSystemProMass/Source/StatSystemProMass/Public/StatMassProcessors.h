@@ -0,0 +1,86 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "StatMassProcessors.generated.h"
+
+namespace StatMass
+{
+	/** Processing group all StatSystemPro processors run in */
+	extern STATSYSTEMPROMASS_API const FName ProcessorGroup;
+}
+
+/**
+ * ============================================================================
+ * STAT MASS PROCESSORS - Horde-Scale Survival Simulation
+ * ============================================================================
+ *
+ * Survival simulation for Mass entities, using StatSurvivalFormulas - the same
+ * math as the layer components and UStatSystemProComponent.
+ *
+ * ORDER (mirrors the component layers - body and weather feed the stat layer):
+ *   Body (bleeding, infection) -> Thermal (body temperature, drains) -> Regeneration
+ *
+ * Server/standalone only. Entities tagged FStatMassPromotedTag (simulated by
+ * full components) or FStatMassDeadTag are skipped.
+ */
+
+/**
+ * Bleeding drains BloodLevel, infection grows and feeds Infection_Level
+ */
+UCLASS()
+class STATSYSTEMPROMASS_API UStatMassBodyProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UStatMassBodyProcessor();
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Body temperature approaches the environment, freezing/overheating stages drain stats
+ */
+UCLASS()
+class STATSYSTEMPROMASS_API UStatMassThermalProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UStatMassThermalProcessor();
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Regeneration/decay of every stat; tags entities whose health reached zero
+ */
+UCLASS()
+class STATSYSTEMPROMASS_API UStatMassRegenerationProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UStatMassRegenerationProcessor();
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
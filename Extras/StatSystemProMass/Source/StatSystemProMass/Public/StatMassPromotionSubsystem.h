@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassEntityTypes.h"
+#include "StatMassPromotionSubsystem.generated.h"
+
+class UStatComponent;
+
+/**
+ * ============================================================================
+ * STAT MASS PROMOTION SUBSYSTEM - Entity <-> Component Handoff
+ * ============================================================================
+ *
+ * Horde NPCs live as lightweight Mass entities. When a player starts
+ * interacting with one (looting, melee, inspecting wounds), promote it:
+ * its stats, bleeding/infection and temperature are copied into full
+ * components on an actor, and the Mass processors stop simulating it.
+ *
+ * Promotion fills UStatComponent (created if missing) and UBodyComponent
+ * (created if the entity has body state); an existing UEnvironmentComponent
+ * gets the entity's environment temperature. Demote to hand the state back.
+ *
+ * Game thread only, outside Mass processing (processors: use Context.Defer()).
+ */
+UCLASS()
+class STATSYSTEMPROMASS_API UStatMassPromotionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Copy an entity's simulation into components on Actor and stop simulating it in Mass
+	 * @return The actor's stat component (nullptr if the entity or actor is invalid)
+	 */
+	UStatComponent* PromoteEntity(FMassEntityHandle Entity, AActor* Actor);
+
+	/**
+	 * Copy the components' state back into the entity and resume Mass simulation
+	 * Components are left on the actor (destroy or pool the actor as needed)
+	 */
+	void DemoteEntity(FMassEntityHandle Entity, AActor* Actor);
+
+	/** Is this entity currently simulated by components? */
+	bool IsEntityPromoted(FMassEntityHandle Entity) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** The world's entity manager (nullptr without Mass) */
+	FMassEntityManager* GetEntityManager() const;
+
+	/** Find a component of a class on Actor, or create and register one */
+	template<typename ComponentType>
+	static ComponentType* FindOrAddComponent(AActor& Actor);
+};
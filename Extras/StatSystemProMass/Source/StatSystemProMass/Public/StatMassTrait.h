@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTraitBase.h"
+#include "StatMassFragments.h"
+#include "StatMassTrait.generated.h"
+
+/**
+ * ============================================================================
+ * STAT MASS TRAIT - Survival Stats for Mass Entities
+ * ============================================================================
+ *
+ * Add to a Mass Entity Config to give spawned entities stats, and optionally
+ * bleeding/infection and body temperature. Simulated by the StatSystemPro Mass
+ * processors with the same formulas as the stat, body and weather layers.
+ *
+ * EXAMPLE (zombie horde):
+ * - Stats: Health_Core 100, BloodLevel 100, BodyTemperature 37 (max 45)
+ * - Simulate Body: ON, Simulate Thermal: ON
+ *
+ * Promote an entity to full components (UStatMassPromotionSubsystem) when a
+ * player interacts with it.
+ */
+UCLASS(meta=(DisplayName="StatSystemPro Stats"))
+class STATSYSTEMPROMASS_API UStatMassTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Stats each entity starts with (up to 8) */
+	UPROPERTY(EditAnywhere, Category = "Stats")
+	TArray<FStatMassStat> Stats;
+
+	/** Simulate bleeding and infection */
+	UPROPERTY(EditAnywhere, Category = "Body")
+	bool bSimulateBody = true;
+
+	/** Initial body state */
+	UPROPERTY(EditAnywhere, Category = "Body", meta=(EditCondition = "bSimulateBody"))
+	FStatMassBodyFragment Body;
+
+	/** Simulate body temperature (needs a BodyTemperature stat) */
+	UPROPERTY(EditAnywhere, Category = "Thermal")
+	bool bSimulateThermal = true;
+
+	/** Initial thermal state */
+	UPROPERTY(EditAnywhere, Category = "Thermal", meta=(EditCondition = "bSimulateThermal"))
+	FStatMassThermalFragment Thermal;
+
+protected:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+};
@@ -2,12 +2,19 @@
 
 #include "BodyLayer/BodyComponent.h"
 #include "StatLayer/StatComponent.h"
+#include "Simulation/StatSignificanceSubsystem.h"
+#include "Simulation/StatSurvivalFormulas.h"
+#include "StatSystemProStats.h"
+#include "StatSystemProTrace.h"
+#include "Engine/World.h"
 
 UBodyComponent::UBodyComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	bEnabled = true;
 	StatComponent = nullptr;
+	LayerSimulation = nullptr;
+	LayerSimulationHandle = INDEX_NONE;
 }
 
 void UBodyComponent::BeginPlay()
@@ -21,19 +28,108 @@ void UBodyComponent::BeginPlay()
 	{
 		StatComponent = GetOwner()->FindComponentByClass<UStatComponent>();
 	}
+
+	// Far-away and unseen owners tick less often
+	if (UStatSignificanceSubsystem* Significance = GetWorld() ? GetWorld()->GetSubsystem<UStatSignificanceSubsystem>() : nullptr)
+	{
+		Significance->RegisterComponent(this, EStatTickLayer::Body);
+	}
+
+	RegisterWithLayerSimulation();
+}
+
+void UBodyComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (LayerSimulation)
+	{
+		LayerSimulation->UnregisterClient(LayerSimulationHandle);
+		LayerSimulation = nullptr;
+		LayerSimulationHandle = INDEX_NONE;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UBodyComponent::RegisterWithLayerSimulation()
+{
+	if (GetOwnerRole() != ROLE_Authority || !UStatLayerSimulationSubsystem::IsParallelLayerSimulationEnabled())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UStatLayerSimulationSubsystem* Subsystem = World ? World->GetSubsystem<UStatLayerSimulationSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	LayerSimulationHandle = Subsystem->RegisterClient(this, this);
+	if (LayerSimulationHandle != INDEX_NONE)
+	{
+		LayerSimulation = Subsystem;
+
+		// Subsystem computes and applies our stat changes
+		SetComponentTickEnabled(false);
+	}
 }
 
 void UBodyComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (!bEnabled)
+	if (!ShouldSimulateLayer())
 	{
 		return;
 	}
 
-	UpdateBleeding(DeltaTime);
-	UpdateInfection(DeltaTime);
+	INC_DWORD_STAT(STAT_StatSystemPro_ComponentsTicked);
+	TRACE_STATSYSTEMPRO_LAYER_SCOPE(this, EStatSystemProTraceLayer::Body);
+
+	// Same compute/apply split the layer simulation subsystem runs, for this component alone
+	TickStatDeltas.Reset();
+	ComputeLayerStatDeltas(StatComponent, DeltaTime, TickStatDeltas);
+	if (StatComponent)
+	{
+		StatComponent->ApplyStatChanges(TickStatDeltas);
+	}
+	PostLayerStatDeltasApplied(DeltaTime);
+}
+
+void UBodyComponent::ComputeLayerStatDeltas(const UStatComponent* Target, float DeltaTime, TArray<FStatDelta>& OutDeltas)
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_BodyLayer);
+
+	float BloodLoss = 0.0f;
+	float InfectionGain = 0.0f;
+	FixedStep.Run(DeltaTime, [this, &BloodLoss, &InfectionGain](float StepTime)
+	{
+		BloodLoss += UpdateBleeding(StepTime);
+		InfectionGain += UpdateInfection(StepTime);
+	});
+
+	if (BloodLoss > 0.0f)
+	{
+		OutDeltas.Emplace(EStatType::BloodLevel, -BloodLoss, TEXT("Bleeding"));
+	}
+
+	if (InfectionGain > 0.0f)
+	{
+		OutDeltas.Emplace(EStatType::Infection_Level, InfectionGain, TEXT("BodyInfection"));
+	}
+
+	// Head damage drains sanity
+	const float SanityDrainRate = CalculateEffectMultipliers().SanityDrainRate;
+	if (SanityDrainRate > 0.0f)
+	{
+		OutDeltas.Emplace(EStatType::Sanity, -SanityDrainRate * DeltaTime, TEXT("HeadInjury"));
+	}
+}
+
+void UBodyComponent::PostLayerStatDeltasApplied(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_BodyLayer);
+
 	ApplyBodyEffectsToStats();
 }
 
@@ -62,6 +158,7 @@ void UBodyComponent::DamageBodyPart(EBodyPart BodyPart, float Damage)
 	// Increase pain based on damage
 	State.PainLevel = FMath::Min(100.0f, State.PainLevel + Damage * 0.5f);
 
+	TRACE_STATSYSTEMPRO_BODY_PART_DAMAGED(this, BodyPart, Damage, State.Condition);
 	OnBodyPartDamaged.Broadcast(BodyPart, Damage);
 
 	UE_LOG(LogTemp, Warning, TEXT("Body Part Damaged: %d | Damage: %.2f | Condition: %.2f"),
@@ -268,24 +365,15 @@ bool UBodyComponent::HasCriticalInjury() const
 	return false;
 }
 
-void UBodyComponent::UpdateBleeding(float DeltaTime)
+float UBodyComponent::UpdateBleeding(float DeltaTime) const
 {
-	float TotalBleedingRate = GetTotalBleedingRate();
-
-	if (TotalBleedingRate > 0.0f && StatComponent)
-	{
-		// Apply blood loss to the stat component
-		StatComponent->ApplyStatChange(
-			EStatType::BloodLevel,
-			-TotalBleedingRate * DeltaTime,
-			TEXT("Bleeding"),
-			FGameplayTag()
-		);
-	}
+	return StatSurvivalFormulas::BloodLoss(GetTotalBleedingRate(), DeltaTime);
 }
 
-void UBodyComponent::UpdateInfection(float DeltaTime)
+float UBodyComponent::UpdateInfection(float DeltaTime)
 {
+	float InfectionGain = 0.0f;
+
 	// Progress infection over time
 	for (auto& Pair : BodyParts)
 	{
@@ -293,23 +381,17 @@ void UBodyComponent::UpdateInfection(float DeltaTime)
 		if (State.InfectionRate > 0.0f)
 		{
 			// Infection slowly grows
-			State.InfectionRate = FMath::Min(100.0f, State.InfectionRate + DeltaTime * 0.5f);
+			State.InfectionRate = StatSurvivalFormulas::GrowInfection(State.InfectionRate, DeltaTime);
 
 			// Infection causes pain
 			State.PainLevel = FMath::Min(100.0f, State.PainLevel + DeltaTime * 0.1f);
 
-			// Apply infection to global infection stat
-			if (StatComponent)
-			{
-				StatComponent->ApplyStatChange(
-					EStatType::Infection_Level,
-					DeltaTime * 0.2f,
-					TEXT("BodyInfection"),
-					FGameplayTag()
-				);
-			}
+			// Feeds the global infection stat
+			InfectionGain += StatSurvivalFormulas::InfectionStatRate * DeltaTime;
 		}
 	}
+
+	return InfectionGain;
 }
 
 void UBodyComponent::ApplyBodyEffectsToStats()
@@ -321,24 +403,11 @@ void UBodyComponent::ApplyBodyEffectsToStats()
 
 	FBodyPartEffectMultipliers Multipliers = CalculateEffectMultipliers();
 
-	// Apply torso damage to max health
-	float CurrentHealthMax = StatComponent->GetStatMaxValue(EStatType::Health_Core);
-	float BaseHealthMax = StatComponent->GetStat(EStatType::Health_Core).BaseMaxValue;
-	float NewMaxHealth = BaseHealthMax * Multipliers.MaxHealthMultiplier;
-
-	if (!FMath::IsNearlyEqual(CurrentHealthMax, NewMaxHealth))
+	// Apply torso damage to max health (the stat only recomputes when the multiplier changes)
+	if (!StatComponent->UpdateStatModifier(TorsoMaxHealthModifier, Multipliers.MaxHealthMultiplier))
 	{
-		StatComponent->SetStatMaxValue(EStatType::Health_Core, NewMaxHealth);
+		TorsoMaxHealthModifier = StatComponent->AddStatModifier(EStatType::Health_Core, EStatModifierTarget::MaxValue,
+			EStatModifierOp::Multiplicative, Multipliers.MaxHealthMultiplier, TEXT("BodyTorso"));
 	}
 
-	// Apply head damage to sanity
-	if (Multipliers.SanityDrainRate > 0.0f)
-	{
-		StatComponent->ApplyStatChange(
-			EStatType::Sanity,
-			-Multipliers.SanityDrainRate * GetWorld()->GetDeltaSeconds(),
-			TEXT("HeadInjury"),
-			FGameplayTag()
-		);
-	}
 }
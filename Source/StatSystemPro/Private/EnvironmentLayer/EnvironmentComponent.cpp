@@ -3,6 +3,10 @@
 #include "EnvironmentLayer/EnvironmentComponent.h"
 #include "StatLayer/StatComponent.h"
 #include "StatusEffectLayer/StatusEffectComponent.h"
+#include "Simulation/StatSignificanceSubsystem.h"
+#include "StatSystemProStats.h"
+#include "StatSystemProTrace.h"
+#include "Engine/World.h"
 
 UEnvironmentComponent::UEnvironmentComponent()
 {
@@ -12,6 +16,8 @@ UEnvironmentComponent::UEnvironmentComponent()
 	StatusEffectComponent = nullptr;
 	bHypothermiaTriggered = false;
 	bHeatstrokeTriggered = false;
+	LayerSimulation = nullptr;
+	LayerSimulationHandle = INDEX_NONE;
 }
 
 void UEnvironmentComponent::BeginPlay()
@@ -28,20 +34,127 @@ void UEnvironmentComponent::BeginPlay()
 	{
 		StatusEffectComponent = GetOwner()->FindComponentByClass<UStatusEffectComponent>();
 	}
+
+	// Far-away and unseen owners tick less often
+	if (UStatSignificanceSubsystem* Significance = GetWorld() ? GetWorld()->GetSubsystem<UStatSignificanceSubsystem>() : nullptr)
+	{
+		Significance->RegisterComponent(this, EStatTickLayer::Environment);
+	}
+
+	RegisterWithLayerSimulation();
+}
+
+void UEnvironmentComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (LayerSimulation)
+	{
+		LayerSimulation->UnregisterClient(LayerSimulationHandle);
+		LayerSimulation = nullptr;
+		LayerSimulationHandle = INDEX_NONE;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UEnvironmentComponent::RegisterWithLayerSimulation()
+{
+	if (GetOwnerRole() != ROLE_Authority || !UStatLayerSimulationSubsystem::IsParallelLayerSimulationEnabled())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UStatLayerSimulationSubsystem* Subsystem = World ? World->GetSubsystem<UStatLayerSimulationSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	LayerSimulationHandle = Subsystem->RegisterClient(this, this);
+	if (LayerSimulationHandle != INDEX_NONE)
+	{
+		LayerSimulation = Subsystem;
+
+		// Subsystem computes and applies our stat changes
+		SetComponentTickEnabled(false);
+	}
 }
 
 void UEnvironmentComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (!bEnabled)
+	if (!ShouldSimulateLayer() || !StatComponent)
 	{
 		return;
 	}
 
-	UpdateBodyTemperature(DeltaTime);
-	UpdateWetness(DeltaTime);
-	UpdateRadiation(DeltaTime);
+	INC_DWORD_STAT(STAT_StatSystemPro_ComponentsTicked);
+	TRACE_STATSYSTEMPRO_LAYER_SCOPE(this, EStatSystemProTraceLayer::Environment);
+
+	// Same compute/apply split the layer simulation subsystem runs, for this component alone
+	TickStatDeltas.Reset();
+	ComputeLayerStatDeltas(StatComponent, DeltaTime, TickStatDeltas);
+	StatComponent->ApplyStatChanges(TickStatDeltas);
+	PostLayerStatDeltasApplied(DeltaTime);
+}
+
+void UEnvironmentComponent::ComputeLayerStatDeltas(const UStatComponent* Target, float DeltaTime, TArray<FStatDelta>& OutDeltas)
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_EnvironmentLayer);
+
+	if (!Target)
+	{
+		return;
+	}
+
+	// Step a local copy, so each fixed step sees the previous one's result before anything is applied
+	float BodyTemp = Target->GetStatValue(EStatType::BodyTemperature);
+	float Wetness = Target->GetStatValue(EStatType::Wetness);
+	float TempChange = 0.0f;
+	float WetnessChange = 0.0f;
+	float RadiationDamage = 0.0f;
+
+	FixedStep.Run(DeltaTime, [&](float StepTime)
+	{
+		const float StepTempChange = CalculateBodyTemperatureChange(BodyTemp, Wetness, StepTime);
+		BodyTemp += StepTempChange;
+		TempChange += StepTempChange;
+
+		const float StepWetnessChange = CalculateWetnessChange(BodyTemp, Wetness, StepTime);
+		Wetness += StepWetnessChange;
+		WetnessChange += StepWetnessChange;
+
+		RadiationDamage += CalculateRadiationDamage(StepTime);
+	});
+
+	if (!FMath::IsNearlyZero(TempChange, 0.01f))
+	{
+		OutDeltas.Emplace(EStatType::BodyTemperature, TempChange, TEXT("Environment"));
+	}
+
+	if (!FMath::IsNearlyZero(WetnessChange))
+	{
+		OutDeltas.Emplace(EStatType::Wetness, WetnessChange, TEXT("Environment"));
+	}
+
+	// Radiation damages health and increases toxicity
+	if (RadiationDamage > 0.0f)
+	{
+		OutDeltas.Emplace(EStatType::Health_Core, -RadiationDamage, TEXT("Radiation"));
+		OutDeltas.Emplace(EStatType::Toxicity, RadiationDamage * 0.5f, TEXT("Radiation"));
+	}
+}
+
+void UEnvironmentComponent::PostLayerStatDeltasApplied(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_EnvironmentLayer);
+
+	if (CurrentEnvironment.HasRadiation())
+	{
+		OnRadiationExposure.Broadcast(CurrentEnvironment.RadiationFactor);
+	}
+
 	CheckTemperatureEffects();
 }
 
@@ -120,50 +233,23 @@ bool UEnvironmentComponent::HasHeatstroke() const
 	return BodyTemp > 40.0f; // Heatstroke threshold
 }
 
-void UEnvironmentComponent::UpdateBodyTemperature(float DeltaTime)
+float UEnvironmentComponent::CalculateBodyTemperatureChange(float BodyTemp, float Wetness, float DeltaTime) const
 {
-	if (!StatComponent)
-	{
-		return;
-	}
-
-	float CurrentBodyTemp = StatComponent->GetStatValue(EStatType::BodyTemperature);
 	float TargetTemp = CurrentEnvironment.AmbientTemperature;
 
-	// Get current wetness
-	float Wetness = StatComponent->GetStatValue(EStatType::Wetness);
-
 	// Calculate exposure factor using the formula from Todo.md:
 	// Exposure = (1 - Clothing_Insulation) + Wetness*0.02 + WindIntensity*0.1
 	float ExposureFactor = CurrentEnvironment.CalculateExposureFactor();
 	ExposureFactor += (Wetness / 100.0f) * EffectConfig.WetnessTemperatureMultiplier;
 
 	// Calculate temperature change rate
-	float TempDifference = TargetTemp - CurrentBodyTemp;
-	float TempChange = TempDifference * EffectConfig.TemperatureChangeRate * ExposureFactor * DeltaTime;
-
-	// Apply temperature change
-	if (!FMath::IsNearlyZero(TempChange, 0.01f))
-	{
-		StatComponent->ApplyStatChange(
-			EStatType::BodyTemperature,
-			TempChange,
-			TEXT("Environment"),
-			FGameplayTag()
-		);
-	}
+	float TempDifference = TargetTemp - BodyTemp;
+	// Exact exponential approach, so long ticks (tick LOD) converge instead of overshooting
+	return TempDifference * (1.0f - FMath::Exp(-EffectConfig.TemperatureChangeRate * ExposureFactor * DeltaTime));
 }
 
-void UEnvironmentComponent::UpdateWetness(float DeltaTime)
+float UEnvironmentComponent::CalculateWetnessChange(float BodyTemp, float Wetness, float DeltaTime) const
 {
-	if (!StatComponent)
-	{
-		return;
-	}
-
-	float CurrentWetness = StatComponent->GetStatValue(EStatType::Wetness);
-	float WetnessChange = 0.0f;
-
 	// Increase wetness if raining or snowing
 	if (CurrentEnvironment.IsRaining() || CurrentEnvironment.IsSnowing())
 	{
@@ -173,72 +259,35 @@ void UEnvironmentComponent::UpdateWetness(float DeltaTime)
 			float RainFactor = CurrentEnvironment.IsRaining() ? CurrentEnvironment.RainLevel : CurrentEnvironment.SnowLevel * 0.5f;
 			float ShelterMultiplier = CurrentEnvironment.ShelterState == EShelterState::PartialShelter ? 0.3f : 1.0f;
 
-			WetnessChange = EffectConfig.WetnessGainRateInRain * RainFactor * ShelterMultiplier * DeltaTime;
+			return EffectConfig.WetnessGainRateInRain * RainFactor * ShelterMultiplier * DeltaTime;
 		}
 	}
-	else
+	else if (Wetness > 0.0f)
 	{
 		// Dry off when not raining
-		if (CurrentWetness > 0.0f)
-		{
-			// Drying rate affected by:
-			// - Body temperature (warmer = faster drying)
-			// - Wind (more wind = faster drying)
-			// - Shelter (inside = slower drying from wind)
-
-			float BodyTemp = StatComponent->GetStatValue(EStatType::BodyTemperature);
-			float TempFactor = FMath::Clamp((BodyTemp - 20.0f) / 20.0f, 0.1f, 2.0f);
+		// Drying rate affected by:
+		// - Body temperature (warmer = faster drying)
+		// - Wind (more wind = faster drying)
+		// - Shelter (inside = slower drying from wind)
 
-			float WindFactor = 1.0f + (CurrentEnvironment.WindIntensity * 0.5f);
-			if (CurrentEnvironment.ShelterState == EShelterState::FullShelter)
-			{
-				WindFactor = 0.5f; // Slow drying indoors
-			}
+		float TempFactor = FMath::Clamp((BodyTemp - 20.0f) / 20.0f, 0.1f, 2.0f);
 
-			WetnessChange = -EffectConfig.WetnessDryRate * TempFactor * WindFactor * DeltaTime;
+		float WindFactor = 1.0f + (CurrentEnvironment.WindIntensity * 0.5f);
+		if (CurrentEnvironment.ShelterState == EShelterState::FullShelter)
+		{
+			WindFactor = 0.5f; // Slow drying indoors
 		}
-	}
 
-	if (!FMath::IsNearlyZero(WetnessChange))
-	{
-		StatComponent->ApplyStatChange(
-			EStatType::Wetness,
-			WetnessChange,
-			TEXT("Environment"),
-			FGameplayTag()
-		);
+		// Can't dry past bone-dry
+		return -FMath::Min(EffectConfig.WetnessDryRate * TempFactor * WindFactor * DeltaTime, Wetness);
 	}
+
+	return 0.0f;
 }
 
-void UEnvironmentComponent::UpdateRadiation(float DeltaTime)
+float UEnvironmentComponent::CalculateRadiationDamage(float DeltaTime) const
 {
-	if (!StatComponent)
-	{
-		return;
-	}
-
-	if (CurrentEnvironment.HasRadiation())
-	{
-		// Apply radiation damage
-		float RadiationDamage = EffectConfig.RadiationDamageRate * CurrentEnvironment.RadiationFactor * DeltaTime;
-
-		StatComponent->ApplyStatChange(
-			EStatType::Health_Core,
-			-RadiationDamage,
-			TEXT("Radiation"),
-			FGameplayTag()
-		);
-
-		// Increase toxicity
-		StatComponent->ApplyStatChange(
-			EStatType::Toxicity,
-			RadiationDamage * 0.5f,
-			TEXT("Radiation"),
-			FGameplayTag()
-		);
-
-		OnRadiationExposure.Broadcast(CurrentEnvironment.RadiationFactor);
-	}
+	return CurrentEnvironment.HasRadiation() ? EffectConfig.RadiationDamageRate * CurrentEnvironment.RadiationFactor * DeltaTime : 0.0f;
 }
 
 void UEnvironmentComponent::CheckTemperatureEffects()
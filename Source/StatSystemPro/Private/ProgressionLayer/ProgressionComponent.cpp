@@ -3,6 +3,10 @@
 #include "ProgressionLayer/ProgressionComponent.h"
 #include "StatLayer/StatComponent.h"
 #include "StatusEffectLayer/StatusEffectComponent.h"
+#include "Simulation/StatSignificanceSubsystem.h"
+#include "StatSystemProStats.h"
+#include "StatSystemProTrace.h"
+#include "Engine/World.h"
 #include "Engine/DataTable.h"
 
 UProgressionComponent::UProgressionComponent()
@@ -37,6 +41,12 @@ void UProgressionComponent::BeginPlay()
 
 	// Calculate initial XP requirement
 	ProgressionData.XPForNextLevel = CalculateXPForLevel(ProgressionData.CurrentLevel + 1);
+
+	// Far-away and unseen owners tick less often
+	if (UStatSignificanceSubsystem* Significance = GetWorld() ? GetWorld()->GetSubsystem<UStatSignificanceSubsystem>() : nullptr)
+	{
+		Significance->RegisterComponent(this, EStatTickLayer::Progression);
+	}
 }
 
 void UProgressionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -48,6 +58,10 @@ void UProgressionComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 		return;
 	}
 
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_ProgressionLayer);
+	INC_DWORD_STAT(STAT_StatSystemPro_ComponentsTicked);
+	TRACE_STATSYSTEMPRO_LAYER_SCOPE(this, EStatSystemProTraceLayer::Progression);
+
 	// Track survival time
 	ProgressionData.TotalTimeSurvived += DeltaTime;
 
@@ -56,7 +70,7 @@ void UProgressionComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	{
 		SurvivalXPTimer += DeltaTime;
 
-		if (SurvivalXPTimer >= 60.0f) // Every minute
+		while (SurvivalXPTimer >= 60.0f) // Every minute (several if the tick was long)
 		{
 			int32 XPToGrant = FMath::FloorToInt(XPPerMinuteSurvived);
 			AwardXP(XPToGrant, EXPSource::Survival);
@@ -3,9 +3,12 @@
 #include "SaveSystem/StatSystemSaveFunctionLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "StatLayer/StatComponent.h"
+#include "StatSystemProStats.h"
 
 bool UStatSystemSaveFunctionLibrary::SaveStatSystem(AActor* Actor, const FString& SaveSlotName, int32 UserIndex)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_Save);
+
 	if (!Actor)
 	{
 		UE_LOG(LogTemp, Error, TEXT("SaveStatSystem: Actor is null!"));
@@ -57,6 +60,8 @@ bool UStatSystemSaveFunctionLibrary::SaveStatSystem(AActor* Actor, const FString
 
 bool UStatSystemSaveFunctionLibrary::LoadStatSystem(AActor* Actor, const FString& SaveSlotName, int32 UserIndex)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_Load);
+
 	if (!Actor)
 	{
 		UE_LOG(LogTemp, Error, TEXT("LoadStatSystem: Actor is null!"));
@@ -149,6 +154,8 @@ bool UStatSystemSaveFunctionLibrary::GetSaveMetadata(
 
 bool UStatSystemSaveFunctionLibrary::SaveStatsOnly(UStatComponent* StatComp, const FString& SaveSlotName, int32 UserIndex)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_Save);
+
 	if (!StatComp)
 	{
 		return false;
@@ -169,6 +176,8 @@ bool UStatSystemSaveFunctionLibrary::SaveStatsOnly(UStatComponent* StatComp, con
 
 bool UStatSystemSaveFunctionLibrary::LoadStatsOnly(UStatComponent* StatComp, const FString& SaveSlotName, int32 UserIndex)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_Load);
+
 	if (!StatComp)
 	{
 		return false;
@@ -203,7 +212,7 @@ void UStatSystemSaveFunctionLibrary::SerializeStatComponent(UStatComponent* Stat
 	}
 
 	// Save all stats
-	OutData.Stats = StatComp->Stats;
+	OutData.Stats = StatComp->GetStatsMap();
 	OutData.bEnabled = StatComp->bEnabled;
 	OutData.bUseSimpleMode = StatComp->bUseSimpleMode;
 	OutData.bEnableAutoRegeneration = StatComp->bEnableAutoRegeneration;
@@ -220,11 +229,14 @@ void UStatSystemSaveFunctionLibrary::DeserializeStatComponent(UStatComponent* St
 	}
 
 	// Restore all stats
-	StatComp->Stats = InData.Stats;
+	StatComp->Stats.FromMap(InData.Stats);
 	StatComp->bEnabled = InData.bEnabled;
 	StatComp->bUseSimpleMode = InData.bUseSimpleMode;
 	StatComp->bEnableAutoRegeneration = InData.bEnableAutoRegeneration;
 	StatComp->CriticalThreshold = InData.CriticalThreshold;
 
+	// Saved timestamps belong to another session - restart lazy clocks from the loaded values
+	StatComp->ResetLazyEvaluation();
+
 	UE_LOG(LogTemp, Verbose, TEXT("DeserializeStatComponent: Loaded %d stats"), InData.Stats.Num());
 }
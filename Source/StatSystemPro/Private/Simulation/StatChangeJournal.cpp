@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/StatChangeJournal.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+const FName StatJournalSource::SetValue = TEXT("SetStatValue");
+const FName StatJournalSource::Regeneration = TEXT("Regeneration");
+const FName StatJournalSource::SetMaxValue = TEXT("SetStatMaxValue");
+const FName StatJournalSource::RestoreToMax = TEXT("RestoreToMax");
+const FName StatJournalSource::DepleteAll = TEXT("DepleteAll");
+
+FStatChangeJournal::FStatChangeJournal()
+	: Slots(MakeUnique<FSlot[]>(Capacity))
+{
+}
+
+void FStatChangeJournal::Write(const FStatJournalRecord& Record)
+{
+	checkSlow(IsInGameThread());
+
+	const uint64 Sequence = Head.load(std::memory_order_relaxed);
+	FSlot& Slot = Slots[Sequence & IndexMask];
+
+	// Mark the slot as being written so readers reject a half-copied record
+	Slot.Sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	Slot.Record = Record;
+
+	Slot.Sequence.store(Sequence + 1, std::memory_order_release);
+	Head.store(Sequence + 1, std::memory_order_release);
+}
+
+int32 FStatChangeJournal::Read(FStatJournalCursor& Cursor, TArray<FStatJournalRecord>& OutRecords) const
+{
+	const uint64 End = Head.load(std::memory_order_acquire);
+
+	// Anything older than one lap has been overwritten
+	if (End > Capacity && Cursor.Next < End - Capacity)
+	{
+		Cursor.NumDropped += (End - Capacity) - Cursor.Next;
+		Cursor.Next = End - Capacity;
+	}
+
+	int32 NumRead = 0;
+	OutRecords.Reserve(OutRecords.Num() + (int32)(End - FMath::Min(Cursor.Next, End)));
+
+	for (; Cursor.Next < End; ++Cursor.Next)
+	{
+		const FSlot& Slot = Slots[Cursor.Next & IndexMask];
+
+		if (Slot.Sequence.load(std::memory_order_acquire) != Cursor.Next + 1)
+		{
+			++Cursor.NumDropped;
+			continue;
+		}
+
+		FStatJournalRecord Copy = Slot.Record;
+
+		// The writer lapped us while copying
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Slot.Sequence.load(std::memory_order_relaxed) != Cursor.Next + 1)
+		{
+			++Cursor.NumDropped;
+			continue;
+		}
+
+		OutRecords.Add(MoveTemp(Copy));
+		++NumRead;
+	}
+
+	return NumRead;
+}
+
+FStatJournalCursor FStatChangeJournal::MakeCursorAtHead() const
+{
+	FStatJournalCursor Cursor;
+	Cursor.Next = Head.load(std::memory_order_acquire);
+	return Cursor;
+}
+
+FStatJournalCursor FStatChangeJournal::MakeCursorAtTail() const
+{
+	const uint64 End = Head.load(std::memory_order_acquire);
+
+	FStatJournalCursor Cursor;
+	Cursor.Next = End > Capacity ? End - Capacity : 0;
+	return Cursor;
+}
+
+bool UStatChangeJournalSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Stat simulation only runs in game worlds
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStatChangeJournalSubsystem::RecordChange(const UActorComponent* Component, EStatType StatType, float Delta, float NewValue, FName Source, FGameplayTag ReasonTag)
+{
+	const AActor* Owner = Component ? Component->GetOwner() : nullptr;
+
+	FStatJournalRecord Record;
+	Record.Time = GetWorld()->GetTimeSeconds();
+	Record.EntityId = Owner ? Owner->GetUniqueID() : (Component ? Component->GetUniqueID() : 0);
+	Record.StatType = StatType;
+	Record.Delta = Delta;
+	Record.NewValue = NewValue;
+	Record.Source = Source;
+	Record.ReasonTag = ReasonTag;
+	Journal.Write(Record);
+}
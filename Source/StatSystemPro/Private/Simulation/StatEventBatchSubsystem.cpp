@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/StatEventBatchSubsystem.h"
+#include "Engine/World.h"
+
+void UStatEventBatchSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Runs after actor ticks, timers and tickable objects
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UStatEventBatchSubsystem::HandleWorldPostActorTick);
+}
+
+void UStatEventBatchSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	Pending.Empty();
+	Flushing.Empty();
+
+	Super::Deinitialize();
+}
+
+void UStatEventBatchSubsystem::QueueFlush(UObject* Owner, IStatEventBatchClient* Client)
+{
+	if (Owner && Client)
+	{
+		Pending.Add({ Owner, Client });
+	}
+}
+
+void UStatEventBatchSubsystem::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	// The delegate is global - only flush our own world
+	if (World != GetWorld() || Pending.Num() == 0)
+	{
+		return;
+	}
+
+	// Swap first: listeners that change stats queue into next frame's list
+	Swap(Pending, Flushing);
+
+	for (const FPendingFlush& Entry : Flushing)
+	{
+		if (Entry.Owner.IsValid())
+		{
+			Entry.Client->FlushBatchedStatEvents();
+		}
+	}
+
+	Flushing.Reset();
+}
@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/StatFixedStep.h"
+#include "StatSystemProSettings.h"
+
+namespace StatFixedStep
+{
+	/** Absorbs rounding from summing frame times, so N frames of 1/N s give exactly one 1 s step */
+	static constexpr double StepTolerance = 1.0e-6;
+}
+
+bool FStatFixedStepAccumulator::IsEnabled()
+{
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	return Settings && Settings->bUseFixedTimestep;
+}
+
+float FStatFixedStepAccumulator::GetStepSize()
+{
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	return Settings ? FMath::Max(Settings->FixedTimestep, KINDA_SMALL_NUMBER) : 0.05f;
+}
+
+int32 FStatFixedStepAccumulator::GetMaxStepsPerFrame()
+{
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	return Settings ? FMath::Max(Settings->MaxFixedStepsPerFrame, 1) : 32;
+}
+
+int32 FStatFixedStepAccumulator::Advance(float DeltaTime, float StepSize, int32 MaxSteps)
+{
+	if (StepSize <= 0.0f)
+	{
+		return 0;
+	}
+
+	LastStepSize = StepSize;
+	Accumulated += FMath::Max(DeltaTime, 0.0f);
+
+	const int32 DueSteps = FMath::FloorToInt32((Accumulated + StatFixedStep::StepTolerance) / StepSize);
+	const int32 NumSteps = FMath::Clamp(DueSteps, 0, MaxSteps);
+
+	// Steps over the cap stay in the accumulator and are caught up next time
+	Accumulated = FMath::Max(Accumulated - (double)NumSteps * StepSize, 0.0);
+	return NumSteps;
+}
+
+float FStatFixedStepAccumulator::GetAlpha() const
+{
+	return LastStepSize > 0.0f ? FMath::Clamp((float)(Accumulated / LastStepSize), 0.0f, 1.0f) : 1.0f;
+}
@@ -0,0 +1,229 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/StatLayerSimulationSubsystem.h"
+#include "StatSystemProStats.h"
+#include "StatLayer/StatComponent.h"
+#include "StatSystemProSettings.h"
+#include "Components/ActorComponent.h"
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
+
+bool UStatLayerSimulationSubsystem::IsParallelLayerSimulationEnabled()
+{
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	return Settings && Settings->bUseParallelLayerSimulation;
+}
+
+bool UStatLayerSimulationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Layer simulation only runs in game worlds
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStatLayerSimulationSubsystem::Deinitialize()
+{
+	Clients.Empty();
+	PendingRemovals.Empty();
+	DueClients.Empty();
+	MergedDeltas.Empty();
+	Targets.Empty();
+	TargetDeltas.Empty();
+	TargetSlots.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UStatLayerSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UStatLayerSimulationSubsystem, STATGROUP_StatSystemPro);
+}
+
+int32 UStatLayerSimulationSubsystem::RegisterClient(UActorComponent* Owner, IStatLayerSimulationClient* Client)
+{
+	if (!Owner || !Client)
+	{
+		return INDEX_NONE;
+	}
+
+	FClientEntry Entry;
+	Entry.Owner = Owner;
+	Entry.Client = Client;
+	return Clients.Add(Entry);
+}
+
+void UStatLayerSimulationSubsystem::UnregisterClient(int32 Handle)
+{
+	if (!Clients.IsValidIndex(Handle))
+	{
+		return;
+	}
+
+	// Events fired while applying can destroy actors - defer removal and skip the client's remaining callbacks
+	if (bIsApplying)
+	{
+		Clients[Handle].Client = nullptr;
+		Clients[Handle].Owner.Reset();
+		for (FDueClient& Due : DueClients)
+		{
+			if (Due.Handle == Handle)
+			{
+				Due.Client = nullptr;
+			}
+		}
+		PendingRemovals.Add(Handle);
+		return;
+	}
+
+	Clients.RemoveAt(Handle);
+}
+
+void UStatLayerSimulationSubsystem::RemoveStaleClients()
+{
+	for (const int32 Handle : PendingRemovals)
+	{
+		if (Clients.IsValidIndex(Handle))
+		{
+			Clients.RemoveAt(Handle);
+		}
+	}
+	PendingRemovals.Reset();
+
+	for (auto It = Clients.CreateIterator(); It; ++It)
+	{
+		if (!It->Owner.IsValid() || !It->Client)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UStatLayerSimulationSubsystem::Tick(float DeltaTime)
+{
+	RemoveStaleClients();
+
+	if (Clients.Num() == 0)
+	{
+		return;
+	}
+
+	// ========== GATHER ==========
+	// Resolve who is due and their targets on the game thread (component lookups aren't worker-safe)
+	DueClients.Reset();
+	Targets.Reset();
+	TargetSlots.Reset();
+	for (auto It = Clients.CreateIterator(); It; ++It)
+	{
+		UActorComponent* Owner = It->Owner.Get();
+		It->ElapsedTime += DeltaTime;
+
+		// Honor the component's tick interval (tick LOD)
+		if (It->ElapsedTime < Owner->GetComponentTickInterval() || !It->Client->ShouldSimulateLayer())
+		{
+			continue;
+		}
+
+		FDueClient& Due = DueClients.AddDefaulted_GetRef();
+		Due.Client = It->Client;
+		Due.Target = It->Client->GetLayerStatTarget();
+		Due.Handle = It.GetIndex();
+		Due.DeltaTime = It->ElapsedTime;
+		It->ElapsedTime = 0.0f;
+
+		// Layers sharing a stat component share a slot
+		if (Due.Target)
+		{
+			if (const int32* Slot = TargetSlots.Find(Due.Target))
+			{
+				Due.TargetSlot = *Slot;
+			}
+			else
+			{
+				Due.TargetSlot = Targets.Add(Due.Target);
+				TargetSlots.Add(Due.Target, Due.TargetSlot);
+			}
+		}
+	}
+
+	if (DueClients.Num() == 0)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT_BY(STAT_StatSystemPro_ComponentsTicked, DueClients.Num());
+
+	// ========== COMPUTE ==========
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	const int32 MinBatchSize = Settings ? FMath::Max(Settings->ParallelLayerMinBatchSize, 1) : 16;
+
+	TArray<FComputeContext, TInlineAllocator<8>> Contexts;
+	ParallelForWithTaskContext(TEXT("StatLayerCompute"), Contexts, DueClients.Num(), MinBatchSize,
+		[this](FComputeContext& Context, int32 DueIndex)
+		{
+			const FDueClient& Due = DueClients[DueIndex];
+
+			Context.Scratch.Reset();
+			Due.Client->ComputeLayerStatDeltas(Due.Target, Due.DeltaTime, Context.Scratch);
+
+			if (!Due.Target)
+			{
+				return;
+			}
+
+			for (const FStatDelta& Delta : Context.Scratch)
+			{
+				FTaggedStatDelta& Tagged = Context.Deltas.AddDefaulted_GetRef();
+				Tagged.DueIndex = DueIndex;
+				Tagged.Delta = Delta;
+			}
+		});
+
+	// ========== APPLY ==========
+	ApplyDeltas(Contexts);
+}
+
+void UStatLayerSimulationSubsystem::ApplyDeltas(TArrayView<FComputeContext> Contexts)
+{
+	bIsApplying = true;
+
+	// Merge in client order, so the result doesn't depend on which task ran what
+	MergedDeltas.Reset();
+	for (const FComputeContext& Context : Contexts)
+	{
+		MergedDeltas.Append(Context.Deltas);
+	}
+	Algo::StableSortBy(MergedDeltas, &FTaggedStatDelta::DueIndex);
+
+	if (TargetDeltas.Num() < Targets.Num())
+	{
+		TargetDeltas.SetNum(Targets.Num());
+	}
+	for (int32 Slot = 0; Slot < Targets.Num(); ++Slot)
+	{
+		TargetDeltas[Slot].Reset();
+	}
+	for (const FTaggedStatDelta& Tagged : MergedDeltas)
+	{
+		TargetDeltas[DueClients[Tagged.DueIndex].TargetSlot].Add(Tagged.Delta);
+	}
+
+	// One ApplyStatChanges per stat component: every layer's deltas summed, clamped and broadcast once per stat
+	for (int32 Slot = 0; Slot < Targets.Num(); ++Slot)
+	{
+		// An earlier target's events may have destroyed this one
+		if (TargetDeltas[Slot].Num() > 0 && IsValid(Targets[Slot]))
+		{
+			Targets[Slot]->ApplyStatChanges(TargetDeltas[Slot]);
+		}
+	}
+
+	// Index loop: callbacks may unregister clients (their due entry is cleared)
+	for (int32 DueIndex = 0; DueIndex < DueClients.Num(); ++DueIndex)
+	{
+		if (DueClients[DueIndex].Client)
+		{
+			DueClients[DueIndex].Client->PostLayerStatDeltasApplied(DueClients[DueIndex].DeltaTime);
+		}
+	}
+
+	bIsApplying = false;
+}
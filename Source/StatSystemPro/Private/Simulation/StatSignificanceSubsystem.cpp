@@ -0,0 +1,228 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/StatSignificanceSubsystem.h"
+#include "StatSystemProStats.h"
+#include "StatSystemProSettings.h"
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+
+namespace StatSignificance
+{
+	/**
+	 * Multiple of StatUpdateInterval per layer and significance
+	 * Possessed / Near / Far / Distant
+	 */
+	static constexpr float IntervalScales[(int32)EStatTickLayer::MAX][(int32)EStatSignificance::MAX] =
+	{
+		// Stats - regen and thresholds
+		{ 1.0f, 1.0f, 4.0f, 8.0f },
+
+		// Body - bleeding drains blood, keep it responsive
+		{ 1.0f, 1.0f, 2.0f, 8.0f },
+
+		// StatusEffects - expiry timers
+		{ 1.0f, 1.0f, 4.0f, 8.0f },
+
+		// Environment - body temperature / wetness drift slowly
+		{ 1.0f, 2.0f, 8.0f, 30.0f },
+
+		// Weather - clothing wetness and temperature stages
+		{ 1.0f, 2.0f, 8.0f, 30.0f },
+
+		// Progression - survival time and XP
+		{ 1.0f, 4.0f, 16.0f, 60.0f }
+	};
+
+	/** Rendered within this many seconds counts as visible */
+	static constexpr float VisibleRecentlyTime = 0.25f;
+}
+
+bool UStatSignificanceSubsystem::IsTickOptimizationEnabled()
+{
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	return Settings && Settings->bEnableTickOptimization;
+}
+
+float UStatSignificanceSubsystem::GetTickInterval(EStatTickLayer Layer, EStatSignificance Significance)
+{
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	if (!Settings || Layer >= EStatTickLayer::MAX || Significance >= EStatSignificance::MAX)
+	{
+		return 0.0f;
+	}
+
+	return Settings->StatUpdateInterval * StatSignificance::IntervalScales[(int32)Layer][(int32)Significance];
+}
+
+bool UStatSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Tick LOD only runs in game worlds
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStatSignificanceSubsystem::Deinitialize()
+{
+	Components.Empty();
+	ViewPoints.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UStatSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UStatSignificanceSubsystem, STATGROUP_StatSystemPro);
+}
+
+void UStatSignificanceSubsystem::RegisterComponent(UActorComponent* Component, EStatTickLayer Layer)
+{
+	if (!Component || Layer >= EStatTickLayer::MAX || !IsTickOptimizationEnabled())
+	{
+		return;
+	}
+
+	FRegisteredComponent& Entry = Components.AddDefaulted_GetRef();
+	Entry.Component = Component;
+	Entry.Layer = Layer;
+
+	// Start at the right rate instead of waiting for the next update
+	if (ViewPoints.Num() == 0)
+	{
+		UpdateViewPoints();
+	}
+	ApplySignificance(Entry, GetActorSignificance(Component->GetOwner()));
+}
+
+void UStatSignificanceSubsystem::Tick(float DeltaTime)
+{
+	if (Components.Num() == 0)
+	{
+		return;
+	}
+
+	TimeUntilUpdate -= DeltaTime;
+	if (TimeUntilUpdate > 0.0f)
+	{
+		return;
+	}
+
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	TimeUntilUpdate = Settings ? Settings->SignificanceUpdateInterval : 0.25f;
+
+	UpdateSignificance();
+}
+
+void UStatSignificanceSubsystem::UpdateViewPoints()
+{
+	ViewPoints.Reset();
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// On a server this includes every remote player's controller
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController || (!PlayerController->GetPawn() && !PlayerController->GetViewTarget()))
+		{
+			continue;
+		}
+
+		FVector Location;
+		FRotator Rotation;
+		PlayerController->GetPlayerViewPoint(Location, Rotation);
+		ViewPoints.Add(Location);
+	}
+}
+
+void UStatSignificanceSubsystem::UpdateSignificance()
+{
+	UpdateViewPoints();
+
+	for (int32 Index = Components.Num() - 1; Index >= 0; --Index)
+	{
+		FRegisteredComponent& Entry = Components[Index];
+		UActorComponent* Component = Entry.Component.Get();
+		if (!Component)
+		{
+			Components.RemoveAtSwap(Index);
+			continue;
+		}
+
+		ApplySignificance(Entry, GetActorSignificance(Component->GetOwner()));
+	}
+}
+
+void UStatSignificanceSubsystem::ApplySignificance(FRegisteredComponent& Entry, EStatSignificance Significance)
+{
+	if (Entry.Significance == Significance)
+	{
+		return;
+	}
+
+	Entry.Significance = Significance;
+	if (UActorComponent* Component = Entry.Component.Get())
+	{
+		Component->SetComponentTickInterval(GetTickInterval(Entry.Layer, Significance));
+	}
+}
+
+EStatSignificance UStatSignificanceSubsystem::GetActorSignificance(const AActor* Actor) const
+{
+	if (!Actor)
+	{
+		return EStatSignificance::Distant;
+	}
+
+	// Players always run at full rate, wherever their stats live
+	const APawn* Pawn = Cast<APawn>(Actor);
+	if ((Pawn && Pawn->IsPlayerControlled()) || Actor->IsA<APlayerController>() || Actor->IsA<APlayerState>())
+	{
+		return EStatSignificance::Possessed;
+	}
+
+	// Owners without a position (game state, managers) can't be ranked by distance
+	if (!Actor->GetRootComponent())
+	{
+		return EStatSignificance::Possessed;
+	}
+
+	if (ViewPoints.Num() == 0)
+	{
+		return EStatSignificance::Distant;
+	}
+
+	const FVector Location = Actor->GetActorLocation();
+	double NearestDistSquared = TNumericLimits<double>::Max();
+	for (const FVector& ViewPoint : ViewPoints)
+	{
+		NearestDistSquared = FMath::Min(NearestDistSquared, FVector::DistSquared(Location, ViewPoint));
+	}
+
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	const double NearDistance = Settings ? Settings->SignificanceNearDistance : 3000.0;
+	const double FarDistance = Settings ? Settings->SignificanceFarDistance : 10000.0;
+
+	EStatSignificance Significance = EStatSignificance::Distant;
+	if (NearestDistSquared <= FMath::Square(NearDistance))
+	{
+		Significance = EStatSignificance::Near;
+	}
+	else if (NearestDistSquared <= FMath::Square(FarDistance))
+	{
+		Significance = EStatSignificance::Far;
+	}
+
+	// On screen counts one step closer (never for dedicated servers - nothing renders)
+	if (Significance > EStatSignificance::Near && Actor->WasRecentlyRendered(StatSignificance::VisibleRecentlyTime))
+	{
+		Significance = (EStatSignificance)((int32)Significance - 1);
+	}
+
+	return Significance;
+}
@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/StatSimulationKernel.h"
+#include "Math/VectorRegister.h"
+
+namespace StatSimulationKernel
+{
+	/** Matches FMath::IsNearlyZero's default tolerance used by FStatValue::IsAtZero */
+	static constexpr float ZeroTolerance = UE_SMALL_NUMBER;
+
+	/** Step a single lane, returning true if it crossed a threshold */
+	FORCEINLINE static bool StepLane(float& Current, float Max, float Rate, float Critical, float DeltaTime)
+	{
+		const float Old = Current;
+		const float New = FMath::Clamp(Old + Rate * DeltaTime, 0.0f, Max);
+		Current = New;
+
+		const bool bCrossedZero = (Old <= ZeroTolerance) != (New <= ZeroTolerance);
+		const bool bCrossedMax = (Old >= Max) != (New >= Max);
+		const bool bCrossedCritical = (Old < Critical) != (New < Critical);
+		return bCrossedZero || bCrossedMax || bCrossedCritical;
+	}
+
+	static void StepLanesScalarRange(float* RESTRICT Current, const float* RESTRICT Max, const float* RESTRICT Rate,
+		const float* RESTRICT Critical, int32 FirstLane, int32 NumLanes, float DeltaTime, uint32* RESTRICT OutCrossedMask)
+	{
+		for (int32 Lane = FirstLane; Lane < NumLanes; ++Lane)
+		{
+			if (StepLane(Current[Lane], Max[Lane], Rate[Lane], Critical[Lane], DeltaTime))
+			{
+				OutCrossedMask[Lane / LanesPerMaskWord] |= 1u << (Lane % LanesPerMaskWord);
+			}
+		}
+	}
+
+	void StepLanesScalar(float* RESTRICT Current, const float* RESTRICT Max, const float* RESTRICT Rate,
+		const float* RESTRICT Critical, int32 NumLanes, float DeltaTime, uint32* RESTRICT OutCrossedMask)
+	{
+		FMemory::Memzero(OutCrossedMask, GetNumMaskWords(NumLanes) * sizeof(uint32));
+		StepLanesScalarRange(Current, Max, Rate, Critical, 0, NumLanes, DeltaTime, OutCrossedMask);
+	}
+
+	void StepLanes(float* RESTRICT Current, const float* RESTRICT Max, const float* RESTRICT Rate,
+		const float* RESTRICT Critical, int32 NumLanes, float DeltaTime, uint32* RESTRICT OutCrossedMask)
+	{
+		FMemory::Memzero(OutCrossedMask, GetNumMaskWords(NumLanes) * sizeof(uint32));
+
+		const VectorRegister4Float VecDeltaTime = VectorSetFloat1(DeltaTime);
+		const VectorRegister4Float VecZero = VectorZeroFloat();
+		const VectorRegister4Float VecZeroTolerance = VectorSetFloat1(ZeroTolerance);
+
+		// 4 lanes per iteration; 4 divides LanesPerMaskWord so a group never straddles two words
+		const int32 NumVectorLanes = NumLanes & ~3;
+		for (int32 Lane = 0; Lane < NumVectorLanes; Lane += 4)
+		{
+			const VectorRegister4Float VecOld = VectorLoad(Current + Lane);
+			const VectorRegister4Float VecMax = VectorLoad(Max + Lane);
+			const VectorRegister4Float VecRate = VectorLoad(Rate + Lane);
+			const VectorRegister4Float VecCritical = VectorLoad(Critical + Lane);
+
+			// New = Clamp(Old + Rate * DeltaTime, 0, Max)
+			VectorRegister4Float VecNew = VectorMultiplyAdd(VecRate, VecDeltaTime, VecOld);
+			VecNew = VectorMin(VectorMax(VecNew, VecZero), VecMax);
+			VectorStore(VecNew, Current + Lane);
+
+			// A threshold was crossed when its old and new comparison results differ
+			const VectorRegister4Float CrossedZero = VectorBitwiseXor(
+				VectorCompareLE(VecOld, VecZeroTolerance), VectorCompareLE(VecNew, VecZeroTolerance));
+			const VectorRegister4Float CrossedMax = VectorBitwiseXor(
+				VectorCompareGE(VecOld, VecMax), VectorCompareGE(VecNew, VecMax));
+			const VectorRegister4Float CrossedCritical = VectorBitwiseXor(
+				VectorCompareLT(VecOld, VecCritical), VectorCompareLT(VecNew, VecCritical));
+
+			const uint32 CrossedBits = (uint32)VectorMaskBits(
+				VectorBitwiseOr(VectorBitwiseOr(CrossedZero, CrossedMax), CrossedCritical));
+			if (CrossedBits)
+			{
+				OutCrossedMask[Lane / LanesPerMaskWord] |= CrossedBits << (Lane % LanesPerMaskWord);
+			}
+		}
+
+		// Remaining 0-3 lanes
+		StepLanesScalarRange(Current, Max, Rate, Critical, NumVectorLanes, NumLanes, DeltaTime, OutCrossedMask);
+	}
+}
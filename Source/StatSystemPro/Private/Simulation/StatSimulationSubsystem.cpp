@@ -0,0 +1,318 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/StatSimulationSubsystem.h"
+#include "StatSystemProStats.h"
+#include "Simulation/StatSimulationKernel.h"
+#include "StatLayer/StatCurveLUT.h"
+#include "StatSystemProSettings.h"
+#include "Curves/CurveFloat.h"
+
+bool UStatSimulationSubsystem::IsBatchedSimulationEnabled()
+{
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	return Settings && Settings->bUseBatchedStatSimulation;
+}
+
+bool UStatSimulationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Stat simulation only runs in game worlds
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStatSimulationSubsystem::Deinitialize()
+{
+	Clients.Empty();
+	PendingRemovals.Empty();
+	ClientStatsScratch.Empty();
+	ClientCriticalScratch.Empty();
+	CrossedMask.Empty();
+	LaneCurrent.Empty();
+	LaneMax.Empty();
+	LaneRate.Empty();
+	LaneCritical.Empty();
+	LaneOldScratch.Empty();
+	LaneClient.Empty();
+	LaneStat.Empty();
+	LaneCurveLUT.Empty();
+	LaneCurveSource.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UStatSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UStatSimulationSubsystem, STATGROUP_StatSystemPro);
+}
+
+int32 UStatSimulationSubsystem::RegisterClient(UObject* Owner, IStatSimulationClient* Client)
+{
+	if (!Owner || !Client)
+	{
+		return INDEX_NONE;
+	}
+
+	FClientEntry Entry;
+	Entry.Owner = Owner;
+	Entry.Client = Client;
+
+	bLanesDirty = true;
+	return Clients.Add(Entry);
+}
+
+void UStatSimulationSubsystem::UnregisterClient(int32 Handle)
+{
+	if (!Clients.IsValidIndex(Handle))
+	{
+		return;
+	}
+
+	bLanesDirty = true;
+
+	// Events fired during a step can destroy actors - defer removal so lane indices stay valid
+	if (bIsSimulating)
+	{
+		Clients[Handle].Client = nullptr;
+		Clients[Handle].Owner.Reset();
+		if (ClientStatsScratch.IsValidIndex(Handle))
+		{
+			ClientStatsScratch[Handle] = nullptr;
+		}
+		PendingRemovals.Add(Handle);
+		return;
+	}
+
+	Clients.RemoveAt(Handle);
+}
+
+void UStatSimulationSubsystem::MarkClientDirty(int32 Handle)
+{
+	if (Clients.IsValidIndex(Handle))
+	{
+		bLanesDirty = true;
+	}
+}
+
+void UStatSimulationSubsystem::RemoveStaleClients()
+{
+	for (const int32 Handle : PendingRemovals)
+	{
+		if (Clients.IsValidIndex(Handle))
+		{
+			Clients.RemoveAt(Handle);
+		}
+	}
+	PendingRemovals.Reset();
+
+	for (auto It = Clients.CreateIterator(); It; ++It)
+	{
+		if (!It->Owner.IsValid() || !It->Client)
+		{
+			It.RemoveCurrent();
+			bLanesDirty = true;
+		}
+	}
+}
+
+void UStatSimulationSubsystem::RebuildLanes()
+{
+	LaneCurrent.Reset();
+	LaneMax.Reset();
+	LaneRate.Reset();
+	LaneCritical.Reset();
+	LaneClient.Reset();
+	LaneStat.Reset();
+	LaneCurveLUT.Reset();
+	LaneCurveSource.Reset();
+
+	const bool bUseCurveLUTs = FStatCurveLUTCache::IsEnabled();
+	FStatCurveLUTCache& CurveLUTs = FStatCurveLUTCache::Get();
+	CurveLUTGeneration = CurveLUTs.GetGeneration();
+
+	for (auto It = Clients.CreateConstIterator(); It; ++It)
+	{
+		const FStatContainer& Stats = It->Client->GetSimulatedStats();
+
+		for (const auto& StatPair : Stats)
+		{
+			const FStatValue& Stat = StatPair.Value;
+
+			// Stats without regen never change on their own, lazy stats are computed on read - no lane needed
+			if (Stat.IsLazy() || (!Stat.RegenerationCurve && FMath::IsNearlyZero(Stat.RegenerationRate)))
+			{
+				continue;
+			}
+
+			LaneCurrent.Add(Stat.CurrentValue);
+			LaneMax.Add(Stat.MaxValue);
+			LaneRate.Add(Stat.RegenerationRate);
+			LaneCritical.Add(0.0f);
+			LaneClient.Add(It.GetIndex());
+			LaneStat.Add(StatPair.Key);
+			LaneCurveLUT.Add(bUseCurveLUTs ? CurveLUTs.FindOrBake(Stat.RegenerationCurve) : nullptr);
+			LaneCurveSource.Add(Stat.RegenerationCurve);
+		}
+	}
+
+	CrossedMask.SetNumZeroed(StatSimulationKernel::GetNumMaskWords(LaneCurrent.Num()));
+	bLanesDirty = false;
+}
+
+void UStatSimulationSubsystem::Tick(float DeltaTime)
+{
+	FixedStep.Run(DeltaTime, [this](float StepTime)
+	{
+		StepSimulation(StepTime);
+	});
+}
+
+void UStatSimulationSubsystem::StepSimulation(float DeltaTime)
+{
+	// Each step can fire events that destroy actors
+	RemoveStaleClients();
+
+	if (Clients.Num() == 0)
+	{
+		return;
+	}
+
+	// Pick up regen curves edited in editor
+	FStatCurveLUTCache& CurveLUTs = FStatCurveLUTCache::Get();
+	CurveLUTs.RebakeModified();
+
+	// Tables were freed after GC - cached LUT pointers must be refetched
+	if (CurveLUTs.GetGeneration() != CurveLUTGeneration)
+	{
+		bLanesDirty = true;
+	}
+
+	if (bLanesDirty)
+	{
+		RebuildLanes();
+	}
+
+	// Resolve each client's stat storage once per frame (nullptr = skip this frame)
+	ClientStatsScratch.Reset();
+	ClientStatsScratch.SetNumZeroed(Clients.GetMaxIndex());
+	ClientCriticalScratch.Reset();
+	ClientCriticalScratch.SetNumZeroed(Clients.GetMaxIndex());
+	for (auto It = Clients.CreateIterator(); It; ++It)
+	{
+		if (It->Client->ShouldSimulateStats())
+		{
+			ClientStatsScratch[It.GetIndex()] = &It->Client->GetSimulatedStats();
+			ClientCriticalScratch[It.GetIndex()] = It->Client->GetSimulationCriticalThreshold();
+			INC_DWORD_STAT(STAT_StatSystemPro_ComponentsTicked);
+		}
+	}
+
+	const int32 NumLanes = LaneCurrent.Num();
+	float* RESTRICT Current = LaneCurrent.GetData();
+	float* RESTRICT Max = LaneMax.GetData();
+	float* RESTRICT Rate = LaneRate.GetData();
+	float* RESTRICT Critical = LaneCritical.GetData();
+
+	// ========== GATHER ==========
+	// Pull live values (gameplay code may have changed them since last frame)
+	for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+	{
+		const FStatContainer* Stats = ClientStatsScratch[LaneClient[Lane]];
+		const FStatValue* Stat = Stats ? Stats->Find(LaneStat[Lane]) : nullptr;
+		if (!Stat)
+		{
+			// Inert lane: stays at zero and never crosses a threshold
+			Current[Lane] = 0.0f;
+			Max[Lane] = 0.0f;
+			Rate[Lane] = 0.0f;
+			Critical[Lane] = 0.0f;
+			continue;
+		}
+
+		Current[Lane] = Stat->CurrentValue;
+		Max[Lane] = Stat->MaxValue;
+		Critical[Lane] = Stat->MaxValue * ClientCriticalScratch[LaneClient[Lane]];
+
+		// Curve Y-axis IS the regeneration amount per second (X-axis = 0-1 percentage)
+		if (!Stat->RegenerationCurve)
+		{
+			Rate[Lane] = Stat->RegenerationRate;
+		}
+		else if (LaneCurveLUT[Lane] && LaneCurveSource[Lane] == Stat->RegenerationCurve)
+		{
+			Rate[Lane] = LaneCurveLUT[Lane]->Evaluate(Stat->GetPercentage());
+		}
+		else
+		{
+			// Curve swapped since the last rebuild (or LUTs disabled)
+			Rate[Lane] = CurveLUTs.Evaluate(Stat->RegenerationCurve, Stat->GetPercentage());
+		}
+	}
+
+	// ========== STEP ==========
+	StatSimulationKernel::StepLanes(Current, Max, Rate, Critical, NumLanes, DeltaTime, CrossedMask.GetData());
+
+	// ========== SCATTER ==========
+	// Write every lane back before any event runs: handlers may change a later lane's stat
+	// (damage/healing from a regen event), and that write must not be overwritten by this step
+	LaneOldScratch.Reset();
+	LaneOldScratch.SetNumUninitialized(NumLanes);
+	float* RESTRICT Old = LaneOldScratch.GetData();
+	for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+	{
+		FStatContainer* Stats = ClientStatsScratch[LaneClient[Lane]];
+		FStatValue* Stat = Stats ? Stats->Find(LaneStat[Lane]) : nullptr;
+		if (!Stat || FMath::IsNearlyZero(Rate[Lane] * DeltaTime))
+		{
+			// Unchanged (inert lanes never cross a threshold either)
+			Old[Lane] = Current[Lane];
+			continue;
+		}
+
+		Old[Lane] = Stat->CurrentValue;
+		Stat->CurrentValue = Current[Lane];
+	}
+
+	// ========== EVENTS ==========
+	bIsSimulating = true;
+
+	for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+	{
+		if (FMath::IsNearlyZero(Rate[Lane] * DeltaTime))
+		{
+			continue;
+		}
+
+		// A previous lane's events may have unregistered this client
+		const int32 ClientIndex = LaneClient[Lane];
+		if (!ClientStatsScratch[ClientIndex])
+		{
+			continue;
+		}
+
+		const float OldValue = Old[Lane];
+		const float NewValue = Current[Lane];
+
+		// Broadcast events if value changed significantly
+		if (!FMath::IsNearlyEqual(OldValue, NewValue, 0.01f))
+		{
+			Clients[ClientIndex].Client->OnSimulatedStatChanged(LaneStat[Lane], OldValue, NewValue);
+		}
+
+		// Threshold events only for lanes the kernel flagged (client may have unregistered above)
+		if (StatSimulationKernel::HasCrossed(CrossedMask.GetData(), Lane) && ClientStatsScratch[ClientIndex])
+		{
+			Clients[ClientIndex].Client->OnSimulatedStatCrossedThreshold(LaneStat[Lane], OldValue, NewValue);
+		}
+	}
+
+	// Index loop: callbacks may register new clients and grow the sparse array
+	const int32 NumClientSlots = ClientStatsScratch.Num();
+	for (int32 ClientIndex = 0; ClientIndex < NumClientSlots; ++ClientIndex)
+	{
+		if (Clients.IsValidIndex(ClientIndex) && Clients[ClientIndex].Client)
+		{
+			Clients[ClientIndex].Client->PostStatSimulation();
+		}
+	}
+
+	bIsSimulating = false;
+}
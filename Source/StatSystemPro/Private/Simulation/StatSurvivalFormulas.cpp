@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/StatSurvivalFormulas.h"
+
+EFreezingStage StatSurvivalFormulas::GetFreezingStage(float BodyTemp)
+{
+	if (BodyTemp >= 36.0f)
+		return EFreezingStage::None;
+	else if (BodyTemp >= 35.0f)
+		return EFreezingStage::Chilled;
+	else if (BodyTemp >= 34.0f)
+		return EFreezingStage::Cold;
+	else if (BodyTemp >= 32.0f)
+		return EFreezingStage::Freezing;
+	else if (BodyTemp >= 30.0f)
+		return EFreezingStage::Hypothermia;
+	else
+		return EFreezingStage::CriticalHypothermia;
+}
+
+EOverheatingStage StatSurvivalFormulas::GetOverheatingStage(float BodyTemp)
+{
+	if (BodyTemp <= 37.5f)
+		return EOverheatingStage::None;
+	else if (BodyTemp <= 38.5f)
+		return EOverheatingStage::Warm;
+	else if (BodyTemp <= 39.5f)
+		return EOverheatingStage::Hot;
+	else if (BodyTemp <= 40.5f)
+		return EOverheatingStage::Overheating;
+	else if (BodyTemp <= 42.0f)
+		return EOverheatingStage::Heatstroke;
+	else
+		return EOverheatingStage::CriticalHeatstroke;
+}
+
+void StatSurvivalFormulas::AddTemperatureEffectDeltas(EFreezingStage FreezingStage, EOverheatingStage OverheatingStage, float DeltaTime, TArray<FStatDelta>& OutDeltas)
+{
+	// Apply freezing damage
+	switch (FreezingStage)
+	{
+	case EFreezingStage::Chilled:
+		// Minor stamina drain
+		OutDeltas.Emplace(EStatType::Stamina, -2.0f * DeltaTime, TEXT("Freezing"));
+		break;
+	case EFreezingStage::Cold:
+		// Moderate stamina drain + minor health drain
+		OutDeltas.Emplace(EStatType::Stamina, -5.0f * DeltaTime, TEXT("Freezing"));
+		OutDeltas.Emplace(EStatType::Health_Core, -0.5f * DeltaTime, TEXT("Freezing"));
+		break;
+	case EFreezingStage::Freezing:
+		// Heavy stamina drain + moderate health drain
+		OutDeltas.Emplace(EStatType::Stamina, -10.0f * DeltaTime, TEXT("Freezing"));
+		OutDeltas.Emplace(EStatType::Health_Core, -2.0f * DeltaTime, TEXT("Freezing"));
+		break;
+	case EFreezingStage::Hypothermia:
+		// Severe health drain
+		OutDeltas.Emplace(EStatType::Health_Core, -5.0f * DeltaTime, TEXT("Hypothermia"));
+		break;
+	case EFreezingStage::CriticalHypothermia:
+		// Critical health drain - near death
+		OutDeltas.Emplace(EStatType::Health_Core, -10.0f * DeltaTime, TEXT("CriticalHypothermia"));
+		break;
+	default:
+		break;
+	}
+
+	// Apply overheating damage
+	switch (OverheatingStage)
+	{
+	case EOverheatingStage::Warm:
+		// Minor stamina drain
+		OutDeltas.Emplace(EStatType::Stamina, -2.0f * DeltaTime, TEXT("Overheating"));
+		break;
+	case EOverheatingStage::Hot:
+		// Moderate stamina drain + thirst increase
+		OutDeltas.Emplace(EStatType::Stamina, -5.0f * DeltaTime, TEXT("Overheating"));
+		OutDeltas.Emplace(EStatType::Thirst, -3.0f * DeltaTime, TEXT("Overheating"));
+		break;
+	case EOverheatingStage::Overheating:
+		// Heavy stamina drain + thirst + minor health drain
+		OutDeltas.Emplace(EStatType::Stamina, -10.0f * DeltaTime, TEXT("Overheating"));
+		OutDeltas.Emplace(EStatType::Thirst, -5.0f * DeltaTime, TEXT("Overheating"));
+		OutDeltas.Emplace(EStatType::Health_Core, -1.0f * DeltaTime, TEXT("Overheating"));
+		break;
+	case EOverheatingStage::Heatstroke:
+		// Severe health drain
+		OutDeltas.Emplace(EStatType::Health_Core, -5.0f * DeltaTime, TEXT("Heatstroke"));
+		break;
+	case EOverheatingStage::CriticalHeatstroke:
+		// Critical health drain - near death
+		OutDeltas.Emplace(EStatType::Health_Core, -10.0f * DeltaTime, TEXT("CriticalHeatstroke"));
+		break;
+	default:
+		break;
+	}
+}
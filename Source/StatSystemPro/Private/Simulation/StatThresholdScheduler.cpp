@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/StatThresholdScheduler.h"
+#include "StatSystemProStats.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+
+bool UStatThresholdScheduler::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Stat simulation only runs in game worlds
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStatThresholdScheduler::Deinitialize()
+{
+	Queue.Empty();
+	DueScratch.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UStatThresholdScheduler::IsTickable() const
+{
+	// Nothing scheduled = nothing to do
+	return Queue.Num() > 0 && Super::IsTickable();
+}
+
+TStatId UStatThresholdScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UStatThresholdScheduler, STATGROUP_StatSystemPro);
+}
+
+double UStatThresholdScheduler::GetClockTime(const UWorld* World)
+{
+	if (!World)
+	{
+		return 0.0;
+	}
+
+	if (const AGameStateBase* GameState = World->GetGameState())
+	{
+		return GameState->GetServerWorldTimeSeconds();
+	}
+
+	return World->GetTimeSeconds();
+}
+
+void UStatThresholdScheduler::Schedule(UObject* Owner, IStatThresholdClient* Client, EStatType StatType, uint32 Serial, double FireTime)
+{
+	if (!Owner || !Client)
+	{
+		return;
+	}
+
+	FScheduledCrossing Entry;
+	Entry.FireTime = FireTime;
+	Entry.Owner = Owner;
+	Entry.Client = Client;
+	Entry.StatType = StatType;
+	Entry.Serial = Serial;
+	Queue.HeapPush(Entry, FEarliestFirst());
+
+	if (Queue.Num() >= CompactThreshold)
+	{
+		Compact();
+	}
+}
+
+void UStatThresholdScheduler::Compact()
+{
+	Queue.RemoveAllSwap([](const FScheduledCrossing& Entry)
+	{
+		return !Entry.Owner.IsValid() || !Entry.Client->IsStatThresholdScheduleCurrent(Entry.StatType, Entry.Serial);
+	});
+	Queue.Heapify(FEarliestFirst());
+
+	// Amortize: next compaction once the live set has doubled
+	CompactThreshold = FMath::Max(256, Queue.Num() * 2);
+}
+
+void UStatThresholdScheduler::Tick(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double Now = GetClockTime(World);
+
+	// Pop everything due first - callbacks reschedule into the queue
+	DueScratch.Reset();
+	while (Queue.Num() > 0 && Queue.HeapTop().FireTime <= Now)
+	{
+		DueScratch.Add(Queue.HeapTop());
+		Queue.HeapPopDiscard(FEarliestFirst());
+	}
+
+	for (const FScheduledCrossing& Entry : DueScratch)
+	{
+		if (Entry.Owner.IsValid())
+		{
+			Entry.Client->OnStatThresholdDue(Entry.StatType, Entry.Serial);
+		}
+	}
+}
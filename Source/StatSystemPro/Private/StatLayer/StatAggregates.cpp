@@ -0,0 +1,229 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatLayer/StatAggregates.h"
+
+FStatAggregates::FStatAggregates()
+	: CriticalThreshold(0.0f)
+{
+	Reset();
+}
+
+void FStatAggregates::Reset()
+{
+	PresentMask = 0;
+	CriticalMask = 0;
+	Sum = 0.0;
+	LowestIndex = INDEX_NONE;
+	HighestIndex = INDEX_NONE;
+}
+
+void FStatAggregates::Set(EStatType StatType, float Percentage)
+{
+	const int32 Index = (int32)StatType;
+	if (Index < 0 || Index >= StatSlots::Capacity)
+	{
+		return;
+	}
+
+	const uint32 StatBit = 1u << Index;
+	const bool bWasPresent = (PresentMask & StatBit) != 0;
+	const float OldPercentage = bWasPresent ? Percentages[Index] : 0.0f;
+	if (bWasPresent && OldPercentage == Percentage)
+	{
+		return;
+	}
+
+	Sum += (double)Percentage - (double)OldPercentage;
+	Percentages[Index] = Percentage;
+	PresentMask |= StatBit;
+	CriticalMask = Percentage < CriticalThreshold ? (CriticalMask | StatBit) : (CriticalMask & ~StatBit);
+
+	// Lowest: a smaller value takes over; the current lowest rising needs a rescan
+	if (LowestIndex == Index)
+	{
+		if (Percentage > OldPercentage)
+		{
+			LowestIndex = INDEX_NONE;
+		}
+	}
+	else if (LowestIndex != INDEX_NONE)
+	{
+		const float Lowest = Percentages[LowestIndex];
+		if (Percentage < Lowest || (Percentage == Lowest && Index < LowestIndex))
+		{
+			LowestIndex = Index;
+		}
+	}
+
+	// Highest: mirror image
+	if (HighestIndex == Index)
+	{
+		if (Percentage < OldPercentage)
+		{
+			HighestIndex = INDEX_NONE;
+		}
+	}
+	else if (HighestIndex != INDEX_NONE)
+	{
+		const float Highest = Percentages[HighestIndex];
+		if (Percentage > Highest || (Percentage == Highest && Index < HighestIndex))
+		{
+			HighestIndex = Index;
+		}
+	}
+}
+
+void FStatAggregates::Remove(EStatType StatType)
+{
+	const int32 Index = (int32)StatType;
+	const uint32 StatBit = (Index >= 0 && Index < StatSlots::Capacity) ? 1u << Index : 0;
+	if (!(PresentMask & StatBit))
+	{
+		return;
+	}
+
+	Sum -= Percentages[Index];
+	PresentMask &= ~StatBit;
+	CriticalMask &= ~StatBit;
+
+	if (LowestIndex == Index)
+	{
+		LowestIndex = INDEX_NONE;
+	}
+	if (HighestIndex == Index)
+	{
+		HighestIndex = INDEX_NONE;
+	}
+
+	// Keep the sum exact once empty
+	if (PresentMask == 0)
+	{
+		Sum = 0.0;
+	}
+}
+
+void FStatAggregates::SetCriticalThreshold(float Threshold)
+{
+	if (Threshold == CriticalThreshold)
+	{
+		return;
+	}
+
+	CriticalThreshold = Threshold;
+	CriticalMask = 0;
+
+	uint32 Mask = PresentMask;
+	while (Mask)
+	{
+		const int32 Index = FMath::CountTrailingZeros(Mask);
+		Mask &= Mask - 1;
+		if (Percentages[Index] < CriticalThreshold)
+		{
+			CriticalMask |= 1u << Index;
+		}
+	}
+}
+
+float FStatAggregates::GetAverage() const
+{
+	const int32 Count = Num();
+	return Count > 0 ? (float)(Sum / Count) : 1.0f;
+}
+
+EStatType FStatAggregates::GetLowest(float& OutPercentage) const
+{
+	if (LowestIndex == INDEX_NONE)
+	{
+		RescanLowest();
+	}
+
+	if (LowestIndex != INDEX_NONE && Percentages[LowestIndex] < 1.0f)
+	{
+		OutPercentage = Percentages[LowestIndex];
+		return (EStatType)LowestIndex;
+	}
+
+	OutPercentage = 1.0f;
+	return EStatType::Health_Core;
+}
+
+EStatType FStatAggregates::GetHighest(float& OutPercentage) const
+{
+	if (HighestIndex == INDEX_NONE)
+	{
+		RescanHighest();
+	}
+
+	if (HighestIndex != INDEX_NONE && Percentages[HighestIndex] > 0.0f)
+	{
+		OutPercentage = Percentages[HighestIndex];
+		return (EStatType)HighestIndex;
+	}
+
+	OutPercentage = 0.0f;
+	return EStatType::Health_Core;
+}
+
+int32 FStatAggregates::CountBelow(float Threshold) const
+{
+	if (Threshold == CriticalThreshold)
+	{
+		return FMath::CountBits(CriticalMask);
+	}
+
+	int32 Count = 0;
+	uint32 Mask = PresentMask;
+	while (Mask)
+	{
+		const int32 Index = FMath::CountTrailingZeros(Mask);
+		Mask &= Mask - 1;
+		Count += Percentages[Index] < Threshold ? 1 : 0;
+	}
+	return Count;
+}
+
+bool FStatAggregates::Matches(const FStatAggregates& Expected) const
+{
+	if (PresentMask != Expected.PresentMask || CriticalMask != Expected.CriticalMask
+		|| !FMath::IsNearlyEqual(GetAverage(), Expected.GetAverage(), KINDA_SMALL_NUMBER))
+	{
+		return false;
+	}
+
+	float Percentage = 0.0f;
+	float ExpectedPercentage = 0.0f;
+	return GetLowest(Percentage) == Expected.GetLowest(ExpectedPercentage) && Percentage == ExpectedPercentage
+		&& GetHighest(Percentage) == Expected.GetHighest(ExpectedPercentage) && Percentage == ExpectedPercentage;
+}
+
+void FStatAggregates::RescanLowest() const
+{
+	LowestIndex = INDEX_NONE;
+
+	uint32 Mask = PresentMask;
+	while (Mask)
+	{
+		const int32 Index = FMath::CountTrailingZeros(Mask);
+		Mask &= Mask - 1;
+		if (LowestIndex == INDEX_NONE || Percentages[Index] < Percentages[LowestIndex])
+		{
+			LowestIndex = Index;
+		}
+	}
+}
+
+void FStatAggregates::RescanHighest() const
+{
+	HighestIndex = INDEX_NONE;
+
+	uint32 Mask = PresentMask;
+	while (Mask)
+	{
+		const int32 Index = FMath::CountTrailingZeros(Mask);
+		Mask &= Mask - 1;
+		if (HighestIndex == INDEX_NONE || Percentages[Index] > Percentages[HighestIndex])
+		{
+			HighestIndex = Index;
+		}
+	}
+}
@@ -0,0 +1,22 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatLayer/StatCategories.h"
+#include "StatLayer/StatRegistry.h"
+
+uint32 StatCategories::GetMask(EStatCategory Category)
+{
+	return FStatRegistry::Get().GetCategoryMask(Category);
+}
+
+EStatCategory StatCategories::GetCategory(EStatType StatType)
+{
+	const uint32 StatBit = (int32)StatType < StatSlots::Capacity ? Bit(StatType) : 0;
+	for (int32 Category = 0; Category < (int32)EStatCategory::All; ++Category)
+	{
+		if (GetMask((EStatCategory)Category) & StatBit)
+		{
+			return (EStatCategory)Category;
+		}
+	}
+	return EStatCategory::MAX;
+}
@@ -1,7 +1,14 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "StatLayer/StatComponent.h"
+#include "StatLayer/StatRegistry.h"
+#include "StatLayer/StatCurveLUT.h"
+#include "StatSystemProSettings.h"
+#include "StatSystemProStats.h"
+#include "StatSystemProTrace.h"
+#include "Simulation/StatSignificanceSubsystem.h"
 #include "Engine/DataTable.h"
+#include "Engine/World.h"
 #include "Net/UnrealNetwork.h"
 
 UStatComponent::UStatComponent()
@@ -10,8 +17,35 @@ UStatComponent::UStatComponent()
 	bEnabled = true;
 	bUseSimpleMode = true;  // Simple by default!
 	bEnableAutoRegeneration = true;
+	bUseLazyEvaluation = false;
 	CriticalThreshold = 0.15f;  // 15%
 
+	StatSimulation = nullptr;
+	StatSimulationHandle = INDEX_NONE;
+
+	ThresholdScheduler = nullptr;
+	ChangeJournal = nullptr;
+	ZeroEdgeMask = 0;
+	MaxEdgeMask = 0;
+	CriticalEdgeMask = 0;
+	for (int32 Index = 0; Index < FStatContainer::Capacity; ++Index)
+	{
+		ThresholdSerials[Index] = 0;
+		ThresholdFireTimes[Index] = -1.0;
+		PendingStatChangeIndices[Index] = INDEX_NONE;
+	}
+
+	bBatchStatChangeEvents = false;
+	bStatChangeFlushQueued = false;
+
+	PendingModifierMasks[(int32)EStatModifierTarget::MaxValue] = 0;
+	PendingModifierMasks[(int32)EStatModifierTarget::RegenerationRate] = 0;
+	StatModifierBatchDepth = 0;
+
+	DriftingStatsMask = 0;
+	AggregatesSyncFrame = MAX_uint64;
+	StepValuesMask = 0;
+
 	// Enable replication
 	SetIsReplicatedByDefault(true);
 }
@@ -25,10 +59,107 @@ void UStatComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 	DOREPLIFETIME(UStatComponent, bEnabled);
 }
 
+void UStatComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// Only stats whose quantized values changed get marked dirty and sent
+	Stats.SyncReplicatedItems();
+}
+
 void UStatComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Predicted crossings are server-side; clients see edges as values replicate
+	if (GetOwnerRole() == ROLE_Authority && GetWorld())
+	{
+		ThresholdScheduler = GetWorld()->GetSubsystem<UStatThresholdScheduler>();
+	}
+
+	ChangeJournal = GetWorld() ? GetWorld()->GetSubsystem<UStatChangeJournalSubsystem>() : nullptr;
+
 	InitializeStats();
+	RegisterWithStatSimulation();
+	UpdateTickEnabled();
+
+	// Far-away and unseen owners tick less often
+	if (UStatSignificanceSubsystem* Significance = GetWorld() ? GetWorld()->GetSubsystem<UStatSignificanceSubsystem>() : nullptr)
+	{
+		Significance->RegisterComponent(this, EStatTickLayer::Stats);
+	}
+}
+
+void UStatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (StatSimulation)
+	{
+		StatSimulation->UnregisterClient(StatSimulationHandle);
+		StatSimulation = nullptr;
+		StatSimulationHandle = INDEX_NONE;
+	}
+
+	// Queued crossings are dropped by the scheduler once we're gone
+	ThresholdScheduler = nullptr;
+	ChangeJournal = nullptr;
+
+	// Deliver the last partial batch while listeners can still use it
+	FlushBatchedStatEvents();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UStatComponent::RegisterWithStatSimulation()
+{
+	// Regeneration is server-only, so only the server hands it to the subsystem
+	if (GetOwnerRole() != ROLE_Authority || !UStatSimulationSubsystem::IsBatchedSimulationEnabled())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UStatSimulationSubsystem* Subsystem = World ? World->GetSubsystem<UStatSimulationSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	StatSimulationHandle = Subsystem->RegisterClient(this, this);
+	if (StatSimulationHandle != INDEX_NONE)
+	{
+		StatSimulation = Subsystem;
+
+		// Subsystem runs regen and critical checks for us
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UStatComponent::MarkStatSimulationDirty()
+{
+	if (StatSimulation)
+	{
+		StatSimulation->MarkClientDirty(StatSimulationHandle);
+	}
+}
+
+void UStatComponent::OnSimulatedStatChanged(EStatType StatType, float OldValue, float NewValue)
+{
+	RefreshStatAggregate(StatType);
+	NotifyStatChanged(StatType, OldValue, NewValue);
+	JournalStatChange(StatType, NewValue - OldValue, NewValue, StatJournalSource::Regeneration, FGameplayTag());
+}
+
+void UStatComponent::OnSimulatedStatCrossedThreshold(EStatType StatType, float OldValue, float NewValue)
+{
+	UpdateThresholdEdges(StatType);
+}
+
+void UStatComponent::PostStatSimulation()
+{
+	// Steps below the notify threshold moved values silently - re-read drifting stats on the next query
+	AggregatesSyncFrame = MAX_uint64;
+
+	CaptureStepValues();
 }
 
 void UStatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -40,14 +171,18 @@ void UStatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorC
 		return;
 	}
 
-	// Only run regen if enabled and we have authority (server)
-	if (bEnableAutoRegeneration && GetOwnerRole() == ROLE_Authority)
+	INC_DWORD_STAT(STAT_StatSystemPro_ComponentsTicked);
+	TRACE_STATSYSTEMPRO_LAYER_SCOPE(this, EStatSystemProTraceLayer::Stat);
+
+	// Only run regen if enabled and we have authority (server), unless the subsystem does it for us
+	if (bEnableAutoRegeneration && GetOwnerRole() == ROLE_Authority && !StatSimulation)
 	{
-		UpdateStatRegeneration(DeltaTime);
+		RegenFixedStep.Run(DeltaTime, [this](float StepTime)
+		{
+			UpdateStatRegeneration(StepTime);
+			CaptureStepValues();
+		});
 	}
-
-	// Check for critical stats
-	CheckCriticalStats();
 }
 
 void UStatComponent::InitializeStats()
@@ -59,6 +194,7 @@ void UStatComponent::InitializeStats()
 	}
 
 	Stats.Empty();
+	Stats.ResetReplicationQuantization();
 
 	// SIMPLE MODE: Quick setup with defaults
 	if (bUseSimpleMode)
@@ -118,7 +254,14 @@ void UStatComponent::InitializeStats()
 				NewStat.RegenerationRate = Row->DefaultRegenerationRate;
 				NewStat.RegenerationCurve = Row->RegenerationCurve;
 
+				// Bake the curve's lookup table at load rather than on first tick
+				if (Row->RegenerationCurve && FStatCurveLUTCache::IsEnabled())
+				{
+					FStatCurveLUTCache::Get().FindOrBake(Row->RegenerationCurve);
+				}
+
 				Stats.Add(Row->StatType, NewStat);
+				Stats.SetReplicationQuantization(Row->StatType, FStatQuantizationSettings(Row->ReplicationQuantization, Row->ReplicationPrecision));
 			}
 		}
 
@@ -134,98 +277,390 @@ void UStatComponent::InitializeStats()
 			Stats.Add((EStatType)i, FStatValue(100.0f));
 		}
 	}
+
+	// Project-wide custom stats take the slots after the built-in ones
+	for (const FCustomStatInfo& CustomStat : FStatRegistry::Get().GetCustomStats())
+	{
+		if (!Stats.Contains(CustomStat.StatType))
+		{
+			Stats.Add(CustomStat.StatType, CustomStat.DefaultValue);
+		}
+	}
+
+	// Modifiers outlive re-initialization - apply them to the fresh values
+	ReapplyAllStatModifiers();
+
+	ResetLazyEvaluation();
 }
 
 void UStatComponent::ApplyStatChange(EStatType StatType, float Amount, FName Source, FGameplayTag ReasonTag)
 {
-	if (!bEnabled || !HasStat(StatType))
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_ApplyStatChange);
+
+	FStatValue* StatPtr = bEnabled ? Stats.Find(StatType) : nullptr;
+	if (!StatPtr)
 	{
 		return;
 	}
 
-	FStatValue& Stat = Stats[StatType];
+	INC_DWORD_STAT(STAT_StatSystemPro_StatChangesApplied);
+
+	FStatValue& Stat = *StatPtr;
+	RebaseLazyStat(Stat);
 	float OldValue = Stat.CurrentValue;
 	Stat.CurrentValue += Amount;
 	Stat.Clamp();
 
-	BroadcastStatEvents(StatType, OldValue, Stat.CurrentValue);
+	const FStatChangeReason Reason(Source, ReasonTag);
+	BroadcastStatEvents(StatType, OldValue, Stat.CurrentValue, MakeArrayView(&Reason, 1));
+
+	JournalStatChange(StatType, Amount, Stat.CurrentValue, Source, ReasonTag);
+}
+
+void UStatComponent::ApplyStatChanges(TConstArrayView<FStatDelta> Deltas)
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_ApplyStatChange);
+
+	if (!bEnabled || Deltas.Num() == 0)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT_BY(STAT_StatSystemPro_StatChangesApplied, Deltas.Num());
+
+	// Sum the deltas per stat first
+	float NetAmounts[FStatContainer::Capacity];
+	uint32 TouchedMask = 0;
+	for (const FStatDelta& Delta : Deltas)
+	{
+		if (!Stats.Contains(Delta.StatType))
+		{
+			continue;
+		}
+
+		const int32 Index = (int32)Delta.StatType;
+		const uint32 StatBit = 1u << Index;
+		NetAmounts[Index] = (TouchedMask & StatBit) ? NetAmounts[Index] + Delta.Amount : Delta.Amount;
+		TouchedMask |= StatBit;
+	}
+
+	// Then clamp and broadcast once per touched stat
+	TArray<FStatChangeReason, TInlineAllocator<4>> Reasons;
+	uint32 Mask = TouchedMask;
+	while (Mask)
+	{
+		const int32 Index = FMath::CountTrailingZeros(Mask);
+		Mask &= Mask - 1;
+		const EStatType StatType = (EStatType)Index;
+
+		FStatValue& Stat = Stats[StatType];
+		RebaseLazyStat(Stat);
+		const float OldValue = Stat.CurrentValue;
+		Stat.CurrentValue += NetAmounts[Index];
+		Stat.Clamp();
+
+		Reasons.Reset();
+		for (const FStatDelta& Delta : Deltas)
+		{
+			if (Delta.StatType == StatType)
+			{
+				Reasons.AddUnique(FStatChangeReason(Delta.Source, Delta.ReasonTag));
+				JournalStatChange(StatType, Delta.Amount, Stat.CurrentValue, Delta.Source, Delta.ReasonTag);
+			}
+		}
 
-	// Log the change for debugging
-	UE_LOG(LogTemp, Verbose, TEXT("Stat Change: %d | Amount: %.2f | Source: %s"),
-		(int32)StatType, Amount, *Source.ToString());
+		BroadcastStatEvents(StatType, OldValue, Stat.CurrentValue, Reasons);
+	}
+}
+
+void UStatComponent::ApplyStatChangesArray(const TArray<FStatDelta>& Deltas)
+{
+	ApplyStatChanges(Deltas);
+}
+
+void UStatComponent::JournalStatChange(EStatType StatType, float Amount, float NewValue, FName Source, FGameplayTag ReasonTag)
+{
+	if (ChangeJournal)
+	{
+		ChangeJournal->RecordChange(this, StatType, Amount, NewValue, Source, ReasonTag);
+	}
 }
 
 void UStatComponent::SetStatValue(EStatType StatType, float NewValue)
 {
-	if (!bEnabled || !HasStat(StatType))
+	FStatValue* StatPtr = bEnabled ? Stats.Find(StatType) : nullptr;
+	if (!StatPtr)
 	{
 		return;
 	}
 
-	FStatValue& Stat = Stats[StatType];
+	FStatValue& Stat = *StatPtr;
+	RebaseLazyStat(Stat);
 	float OldValue = Stat.CurrentValue;
 	Stat.CurrentValue = NewValue;
 	Stat.Clamp();
 
 	BroadcastStatEvents(StatType, OldValue, Stat.CurrentValue);
+
+	JournalStatChange(StatType, NewValue - OldValue, Stat.CurrentValue, StatJournalSource::SetValue, FGameplayTag());
 }
 
 void UStatComponent::SetStatMaxValue(EStatType StatType, float NewMaxValue)
 {
-	if (!bEnabled || !HasStat(StatType))
+	FStatValue* StatPtr = bEnabled ? Stats.Find(StatType) : nullptr;
+	if (!StatPtr)
 	{
 		return;
 	}
 
-	FStatValue& Stat = Stats[StatType];
+	FStatValue& Stat = *StatPtr;
+	RebaseLazyStat(Stat);
+	const float OldMaxValue = Stat.MaxValue;
+	const float OldValue = Stat.CurrentValue;
 	Stat.MaxValue = FMath::Max(0.0f, NewMaxValue);
 	Stat.Clamp();
 
 	OnStatMaxChanged.Broadcast(StatType, Stat.MaxValue);
+	NativeStatEvents.Broadcast(StatType, EStatEventKind::MaxChanged, OldMaxValue, Stat.MaxValue);
+
+	// A lower max clamps the current value
+	if (!FMath::IsNearlyEqual(OldValue, Stat.CurrentValue))
+	{
+		JournalStatChange(StatType, Stat.CurrentValue - OldValue, Stat.CurrentValue, StatJournalSource::SetMaxValue, FGameplayTag());
+	}
+
+	// Max moved, so at-max / critical state and predicted crossings may have too
+	UpdateThresholdEdges(StatType);
 }
 
 float UStatComponent::GetStatValue(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = Stats.Find(StatType))
 	{
-		return Stats[StatType].CurrentValue;
+		return GetLiveValue(*Stat);
 	}
 	return 0.0f;
 }
 
+float UStatComponent::GetInterpolatedStatValue(EStatType StatType) const
+{
+	const FStatValue* Stat = Stats.Find(StatType);
+	if (!Stat)
+	{
+		return 0.0f;
+	}
+
+	// Only regenerating, ticked stats move between steps; lazy ones are exact at any time
+	const uint32 StatBit = 1u << (uint32)StatType;
+	if (Stat->IsLazy() || !(DriftingStatsMask & StatBit) || !(StepValuesMask & StatBit) || !FStatFixedStepAccumulator::IsEnabled())
+	{
+		return GetLiveValue(*Stat);
+	}
+
+	const int32 Index = (int32)StatType;
+	return FMath::Lerp(PreviousStepValues[Index], LastStepValues[Index], GetFixedStepAlpha());
+}
+
 float UStatComponent::GetStatMaxValue(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = Stats.Find(StatType))
 	{
-		return Stats[StatType].MaxValue;
+		return Stat->MaxValue;
 	}
 	return 0.0f;
 }
 
 float UStatComponent::GetStatPercentage(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = Stats.Find(StatType))
 	{
-		return Stats[StatType].GetPercentage();
+		return GetLiveStat(*Stat).GetPercentage();
 	}
 	return 0.0f;
 }
 
 void UStatComponent::SetStatRegenerationRate(EStatType StatType, float Rate)
 {
-	if (!bEnabled || !HasStat(StatType))
+	if (!bEnabled || !Stats.Contains(StatType))
+	{
+		return;
+	}
+
+	// With regen modifiers active, the given rate is the new base they apply to
+	if (StatModifiers.HasModifiers(StatType, EStatModifierTarget::RegenerationRate))
+	{
+		StatModifiers.SetBaseRegenerationRate(StatType, Rate);
+		Rate = StatModifiers.Evaluate(StatType, EStatModifierTarget::RegenerationRate, Rate);
+	}
+
+	ApplyRegenerationRate(StatType, Rate);
+}
+
+void UStatComponent::ApplyRegenerationRate(EStatType StatType, float Rate)
+{
+	FStatValue* Stat = Stats.Find(StatType);
+	if (!Stat)
 	{
 		return;
 	}
 
-	Stats[StatType].RegenerationRate = Rate;
+	// Rebase after setting: elapsed time is folded in at the old rate, then the new rate applies
+	Stat->RegenerationRate = Rate;
+	RebaseLazyStat(*Stat);
+	MarkStatSimulationDirty();
+
+	// New rate = new predicted crossing time
+	UpdateThresholdEdges(StatType);
+}
+
+// ========== STAT MODIFIERS ==========
+
+FStatModifierHandle UStatComponent::AddStatModifier(EStatType StatType, EStatModifierTarget Target, EStatModifierOp Op, float Magnitude, FName Source)
+{
+	const FStatValue* Stat = Stats.Find(StatType);
+	const bool bFirstRegenModifier = Target == EStatModifierTarget::RegenerationRate
+		&& !StatModifiers.HasModifiers(StatType, EStatModifierTarget::RegenerationRate);
+
+	const FStatModifierHandle Handle = StatModifiers.Add(StatType, Target, Op, Magnitude, Source);
+	if (!Handle.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StatComponent: Invalid stat modifier (stat %d, target %d)"), (int32)StatType, (int32)Target);
+		return Handle;
+	}
+
+	// Remember the unmodified rate so it comes back when the last modifier is removed
+	if (bFirstRegenModifier)
+	{
+		StatModifiers.SetBaseRegenerationRate(StatType, Stat ? Stat->RegenerationRate : 0.0f);
+	}
+
+	ApplyStatModifiers(StatType, Target);
+	return Handle;
+}
+
+bool UStatComponent::UpdateStatModifier(FStatModifierHandle Handle, float NewMagnitude)
+{
+	if (!StatModifiers.Update(Handle, NewMagnitude))
+	{
+		return false;
+	}
+
+	ApplyStatModifiers(Handle.StatType, Handle.Target);
+	return true;
+}
+
+bool UStatComponent::RemoveStatModifier(FStatModifierHandle& Handle)
+{
+	if (!StatModifiers.Remove(Handle))
+	{
+		Handle.Invalidate();
+		return false;
+	}
+
+	ApplyStatModifiers(Handle.StatType, Handle.Target);
+	Handle.Invalidate();
+	return true;
+}
+
+int32 UStatComponent::RemoveStatModifiersFromSource(FName Source)
+{
+	uint32 DirtyMasks[(int32)EStatModifierTarget::MAX];
+	const int32 NumRemoved = StatModifiers.RemoveBySource(Source, DirtyMasks);
+
+	for (int32 Target = 0; Target < (int32)EStatModifierTarget::MAX; ++Target)
+	{
+		uint32 Mask = DirtyMasks[Target];
+		while (Mask)
+		{
+			const int32 StatIndex = FMath::CountTrailingZeros(Mask);
+			Mask &= Mask - 1;
+			ApplyStatModifiers((EStatType)StatIndex, (EStatModifierTarget)Target);
+		}
+	}
+
+	return NumRemoved;
+}
+
+void UStatComponent::BeginStatModifierBatch()
+{
+	++StatModifierBatchDepth;
+}
+
+void UStatComponent::EndStatModifierBatch()
+{
+	if (StatModifierBatchDepth <= 0 || --StatModifierBatchDepth > 0)
+	{
+		return;
+	}
+
+	for (int32 Target = 0; Target < (int32)EStatModifierTarget::MAX; ++Target)
+	{
+		uint32 Mask = PendingModifierMasks[Target];
+		PendingModifierMasks[Target] = 0;
+		while (Mask)
+		{
+			const int32 StatIndex = FMath::CountTrailingZeros(Mask);
+			Mask &= Mask - 1;
+			ApplyStatModifiers((EStatType)StatIndex, (EStatModifierTarget)Target);
+		}
+	}
+}
+
+void UStatComponent::ApplyStatModifiers(EStatType StatType, EStatModifierTarget Target)
+{
+	if (StatModifierBatchDepth > 0)
+	{
+		PendingModifierMasks[(int32)Target] |= 1u << (uint32)StatType;
+		return;
+	}
+
+	const FStatValue* Stat = bEnabled ? Stats.Find(StatType) : nullptr;
+	if (!Stat)
+	{
+		return;
+	}
+
+	if (Target == EStatModifierTarget::MaxValue)
+	{
+		const float NewMaxValue = FMath::Max(0.0f, StatModifiers.Evaluate(StatType, Target, Stat->BaseMaxValue));
+		if (!FMath::IsNearlyEqual(NewMaxValue, Stat->MaxValue))
+		{
+			SetStatMaxValue(StatType, NewMaxValue);
+		}
+	}
+	else
+	{
+		const float NewRate = StatModifiers.Evaluate(StatType, Target, StatModifiers.GetBaseRegenerationRate(StatType));
+		if (!FMath::IsNearlyEqual(NewRate, Stat->RegenerationRate))
+		{
+			ApplyRegenerationRate(StatType, NewRate);
+		}
+	}
+}
+
+void UStatComponent::ReapplyAllStatModifiers()
+{
+	for (const auto& StatPair : Stats)
+	{
+		// Freshly initialized rates are the new base
+		if (StatModifiers.HasModifiers(StatPair.Key, EStatModifierTarget::RegenerationRate))
+		{
+			StatModifiers.SetBaseRegenerationRate(StatPair.Key, StatPair.Value.RegenerationRate);
+			ApplyStatModifiers(StatPair.Key, EStatModifierTarget::RegenerationRate);
+		}
+
+		if (StatModifiers.HasModifiers(StatPair.Key, EStatModifierTarget::MaxValue))
+		{
+			ApplyStatModifiers(StatPair.Key, EStatModifierTarget::MaxValue);
+		}
+	}
 }
 
 FStatValue UStatComponent::GetStat(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = Stats.Find(StatType))
 	{
-		return Stats[StatType];
+		return GetLiveStat(*Stat);
 	}
 	return FStatValue();
 }
@@ -235,11 +670,28 @@ bool UStatComponent::HasStat(EStatType StatType) const
 	return Stats.Contains(StatType);
 }
 
+TMap<EStatType, FStatValue> UStatComponent::GetStatsMap() const
+{
+	TMap<EStatType, FStatValue> Map = Stats.ToMap();
+	for (auto& StatPair : Map)
+	{
+		StatPair.Value = GetLiveStat(StatPair.Value);
+	}
+	return Map;
+}
+
 void UStatComponent::UpdateStatRegeneration(float DeltaTime)
 {
-	for (auto& StatPair : Stats)
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_StatLayer);
+
+	for (auto StatPair : Stats)
 	{
 		FStatValue& Stat = StatPair.Value;
+		if (Stat.IsLazy())
+		{
+			continue;
+		}
+
 		float OldValue = Stat.CurrentValue;
 
 		float RegenerationAmount = 0.0f;
@@ -247,10 +699,21 @@ void UStatComponent::UpdateStatRegeneration(float DeltaTime)
 		// If there's a curve, use it directly (X-axis = 0-1 percentage, Y-axis = regen rate to add)
 		if (Stat.RegenerationCurve)
 		{
-			float CurrentPercentage = Stat.GetPercentage();
-			// Y-axis value IS the regeneration amount per second
-			float CurveValue = Stat.RegenerationCurve->GetFloatValue(CurrentPercentage);
-			RegenerationAmount = CurveValue * DeltaTime;
+			// The rate depends on the percentage, so long ticks (tick LOD) are integrated in short steps
+			constexpr float MaxCurveStep = 0.1f;
+			const int32 NumSteps = FMath::Max(1, FMath::CeilToInt(DeltaTime / MaxCurveStep));
+			const float StepTime = DeltaTime / NumSteps;
+
+			FStatValue Stepped = Stat;
+			for (int32 Step = 0; Step < NumSteps; ++Step)
+			{
+				float CurrentPercentage = Stepped.GetPercentage();
+				// Y-axis value IS the regeneration amount per second
+				float CurveValue = FStatCurveLUTCache::Get().Evaluate(Stat.RegenerationCurve, CurrentPercentage);
+				Stepped.CurrentValue += CurveValue * StepTime;
+				Stepped.Clamp();
+			}
+			RegenerationAmount = Stepped.CurrentValue - Stat.CurrentValue;
 		}
 		// Otherwise, use flat regeneration rate
 		else if (!FMath::IsNearlyZero(Stat.RegenerationRate))
@@ -268,52 +731,190 @@ void UStatComponent::UpdateStatRegeneration(float DeltaTime)
 			if (!FMath::IsNearlyEqual(OldValue, Stat.CurrentValue, 0.01f))
 			{
 				BroadcastStatEvents(StatPair.Key, OldValue, Stat.CurrentValue);
+				JournalStatChange(StatPair.Key, RegenerationAmount, Stat.CurrentValue, StatJournalSource::Regeneration, FGameplayTag());
+			}
+			else
+			{
+				// Small steps can still land on zero/max/critical
+				UpdateThresholdEdges(StatPair.Key);
 			}
 		}
 	}
 }
 
-void UStatComponent::BroadcastStatEvents(EStatType StatType, float OldValue, float NewValue)
-{
-	if (!FMath::IsNearlyEqual(OldValue, NewValue))
+void UStatComponent::BroadcastStatEvents(EStatType StatType, float OldValue, float NewValue, TConstArrayView<FStatChangeReason> Reasons)
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_BroadcastStatEvents);
+
+	if (!FMath::IsNearlyEqual(OldValue, NewValue))
+	{
+		NotifyStatChanged(StatType, OldValue, NewValue, Reasons);
+		UpdateThresholdEdges(StatType);
+	}
+}
+
+void UStatComponent::NotifyStatChanged(EStatType StatType, float OldValue, float NewValue, TConstArrayView<FStatChangeReason> Reasons)
+{
+	TRACE_STATSYSTEMPRO_STAT_CHANGED(this, StatType, OldValue, NewValue,
+		Reasons.Num() > 0 ? Reasons[0].Source : NAME_None, Reasons.Num() > 0 ? Reasons[0].ReasonTag : FGameplayTag());
+	INC_DWORD_STAT(STAT_StatSystemPro_EventsBroadcast);
+	OnStatChanged.Broadcast(StatType, OldValue, NewValue);
+	NativeStatEvents.Broadcast(StatType, EStatEventKind::Changed, OldValue, NewValue);
+
+	if (!bBatchStatChangeEvents)
+	{
+		return;
+	}
+
+	const int32 Index = (int32)StatType;
+	if (PendingStatChangeIndices[Index] == INDEX_NONE)
+	{
+		// First change this frame keeps the old value
+		PendingStatChangeIndices[Index] = PendingStatChanges.Num();
+		FStatChangeRecord& Record = PendingStatChanges.AddDefaulted_GetRef();
+		Record.StatType = StatType;
+		Record.OldValue = OldValue;
+	}
+
+	FStatChangeRecord& Record = PendingStatChanges[PendingStatChangeIndices[Index]];
+	Record.NewValue = NewValue;
+
+	for (const FStatChangeReason& Reason : Reasons)
+	{
+		if (!Reason.Source.IsNone() || Reason.ReasonTag.IsValid())
+		{
+			Record.Reasons.AddUnique(Reason);
+		}
+	}
+
+	if (!bStatChangeFlushQueued)
+	{
+		UWorld* World = GetWorld();
+		UStatEventBatchSubsystem* EventBatch = World ? World->GetSubsystem<UStatEventBatchSubsystem>() : nullptr;
+		if (EventBatch)
+		{
+			EventBatch->QueueFlush(this, this);
+			bStatChangeFlushQueued = true;
+		}
+		else
+		{
+			// No world to flush at end of frame - deliver immediately
+			FlushBatchedStatEvents();
+		}
+	}
+}
+
+void UStatComponent::FlushBatchedStatEvents()
+{
+	bStatChangeFlushQueued = false;
+
+	if (PendingStatChanges.Num() == 0)
+	{
+		return;
+	}
+
+	// Move out first so listeners that change stats start a new batch
+	TArray<FStatChangeRecord> Changes = MoveTemp(PendingStatChanges);
+	PendingStatChanges.Reset();
+	for (const FStatChangeRecord& Record : Changes)
+	{
+		PendingStatChangeIndices[(int32)Record.StatType] = INDEX_NONE;
+	}
+
+	// Stats that ended the frame where they started are dropped
+	Changes.RemoveAll([](const FStatChangeRecord& Record)
+	{
+		return FMath::IsNearlyEqual(Record.OldValue, Record.NewValue);
+	});
+
+	if (Changes.Num() > 0)
+	{
+		OnStatsChangedBatch.Broadcast(Changes);
+	}
+}
+
+void UStatComponent::UpdateThresholdEdges(EStatType StatType, bool bBroadcast)
+{
+	RefreshStatAggregate(StatType);
+
+	const uint32 StatBit = 1u << (uint32)StatType;
+	const FStatValue* StoredStat = Stats.Find(StatType);
+	if (!StoredStat)
+	{
+		// Removed stats re-arm so they report again if they come back
+		ZeroEdgeMask &= ~StatBit;
+		MaxEdgeMask &= ~StatBit;
+		CriticalEdgeMask &= ~StatBit;
+		return;
+	}
+
+	const FStatValue Stat = GetLiveStat(*StoredStat);
+
+	const bool bAtZero = Stat.IsAtZero();
+	const bool bAtMax = Stat.IsAtMax();
+	const bool bCritical = Stat.GetPercentage() < CriticalThreshold && Stat.CurrentValue > 0.0f;
+
+	// Report each state once on entry; it re-arms when the stat leaves it
+	const bool bEnteredZero = bAtZero && !(ZeroEdgeMask & StatBit);
+	const bool bEnteredMax = bAtMax && !(MaxEdgeMask & StatBit);
+	const bool bEnteredCritical = bCritical && !(CriticalEdgeMask & StatBit);
+
+	ZeroEdgeMask = bAtZero ? (ZeroEdgeMask | StatBit) : (ZeroEdgeMask & ~StatBit);
+	MaxEdgeMask = bAtMax ? (MaxEdgeMask | StatBit) : (MaxEdgeMask & ~StatBit);
+	CriticalEdgeMask = bCritical ? (CriticalEdgeMask | StatBit) : (CriticalEdgeMask & ~StatBit);
+
+	// Edges are committed before broadcasting, so listeners may safely modify the stat
+	ScheduleThresholdCrossing(StatType);
+
+	if (!bBroadcast)
 	{
-		OnStatChanged.Broadcast(StatType, OldValue, NewValue);
+		return;
+	}
 
-		const FStatValue& Stat = Stats[StatType];
+	if (bEnteredZero)
+	{
+		OnStatReachedZero.Broadcast(StatType);
+		NativeStatEvents.Broadcast(StatType, EStatEventKind::ReachedZero, Stat.CurrentValue, Stat.CurrentValue);
+	}
 
-		// Check for zero
-		if (Stat.IsAtZero() && !FMath::IsNearlyZero(OldValue))
-		{
-			OnStatReachedZero.Broadcast(StatType);
-		}
+	if (bEnteredMax)
+	{
+		OnStatReachedMax.Broadcast(StatType);
+		NativeStatEvents.Broadcast(StatType, EStatEventKind::ReachedMax, Stat.CurrentValue, Stat.CurrentValue);
+	}
 
-		// Check for max
-		if (Stat.IsAtMax() && !FMath::IsNearlyEqual(OldValue, Stat.MaxValue))
-		{
-			OnStatReachedMax.Broadcast(StatType);
-		}
+	if (bEnteredCritical)
+	{
+		OnStatCritical.Broadcast(StatType, Stat.CurrentValue);
+		NativeStatEvents.Broadcast(StatType, EStatEventKind::Critical, Stat.CurrentValue, Stat.CurrentValue);
 	}
 }
 
 void UStatComponent::OnRep_Stats()
 {
 	// Called on clients when stats are replicated from server
-	// Broadcast events so UI can update
-	for (const auto& StatPair : Stats)
+	// Only the stats that actually arrived are broadcast, with their previous values
+	for (const FStatReplicatedChange& Change : Stats.GetReplicatedChanges())
 	{
-		OnStatChanged.Broadcast(StatPair.Key, StatPair.Value.CurrentValue, StatPair.Value.CurrentValue);
-	}
-}
+		const FStatValue* Stat = Stats.Find(Change.StatType);
+		const float OldValue = Change.bWasPresent ? GetLiveValue(Change.OldStat) : 0.0f;
+		const float NewValue = Stat ? GetLiveValue(*Stat) : 0.0f;
 
-void UStatComponent::CheckCriticalStats()
-{
-	for (const auto& StatPair : Stats)
-	{
-		if (StatPair.Value.GetPercentage() < CriticalThreshold && StatPair.Value.CurrentValue > 0.0f)
+		if (Stat && Change.bWasPresent && !FMath::IsNearlyEqual(Change.OldStat.MaxValue, Stat->MaxValue))
 		{
-			OnStatCritical.Broadcast(StatPair.Key, StatPair.Value.CurrentValue);
+			OnStatMaxChanged.Broadcast(Change.StatType, Stat->MaxValue);
+			NativeStatEvents.Broadcast(Change.StatType, EStatEventKind::MaxChanged, Change.OldStat.MaxValue, Stat->MaxValue);
 		}
+
+		if (!Change.bWasPresent || !FMath::IsNearlyEqual(OldValue, NewValue))
+		{
+			NotifyStatChanged(Change.StatType, OldValue, NewValue);
+		}
+
+		UpdateThresholdEdges(Change.StatType);
 	}
+
+	Stats.ConsumeReplicatedChanges();
 }
 
 // ========== NEW GETTER FUNCTIONS ==========
@@ -325,54 +926,54 @@ float UStatComponent::GetStatPercentage100(EStatType StatType) const
 
 float UStatComponent::GetStatMissingAmount(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = Stats.Find(StatType))
 	{
-		return Stats[StatType].MaxValue - Stats[StatType].CurrentValue;
+		return Stat->MaxValue - GetLiveValue(*Stat);
 	}
 	return 0.0f;
 }
 
 bool UStatComponent::IsStatAtMax(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = Stats.Find(StatType))
 	{
-		return Stats[StatType].IsAtMax();
+		return GetLiveStat(*Stat).IsAtMax();
 	}
 	return false;
 }
 
 bool UStatComponent::IsStatAtZero(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = Stats.Find(StatType))
 	{
-		return Stats[StatType].IsAtZero();
+		return GetLiveStat(*Stat).IsAtZero();
 	}
 	return false;
 }
 
 bool UStatComponent::IsStatCritical(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = Stats.Find(StatType))
 	{
-		return Stats[StatType].GetPercentage() < CriticalThreshold;
+		return GetLiveStat(*Stat).GetPercentage() < CriticalThreshold;
 	}
 	return false;
 }
 
 float UStatComponent::GetStatRegenRate(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = Stats.Find(StatType))
 	{
-		return Stats[StatType].RegenerationRate;
+		return Stat->RegenerationRate;
 	}
 	return 0.0f;
 }
 
 float UStatComponent::GetStatBaseMax(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = Stats.Find(StatType))
 	{
-		return Stats[StatType].BaseMaxValue;
+		return Stat->BaseMaxValue;
 	}
 	return 0.0f;
 }
@@ -386,103 +987,39 @@ TArray<EStatType> UStatComponent::GetAllStatTypes() const
 
 bool UStatComponent::IsAnyStatCritical() const
 {
-	for (const auto& StatPair : Stats)
-	{
-		if (StatPair.Value.GetPercentage() < CriticalThreshold)
-		{
-			return true;
-		}
-	}
-	return false;
+	SyncStatAggregates();
+	return StatAggregates.IsAnyCritical();
 }
 
 float UStatComponent::GetAverageStatHealth() const
 {
-	if (Stats.Num() == 0)
-	{
-		return 1.0f;
-	}
-
-	float TotalPercentage = 0.0f;
-	for (const auto& StatPair : Stats)
-	{
-		TotalPercentage += StatPair.Value.GetPercentage();
-	}
-
-	return TotalPercentage / Stats.Num();
+	SyncStatAggregates();
+	return StatAggregates.GetAverage();
 }
 
 // ========== CATEGORY-BASED FUNCTIONS ==========
 
 TArray<EStatType> UStatComponent::GetStatsInCategory(EStatCategory Category) const
 {
-	TArray<EStatType> CategoryStats;
-
-	switch (Category)
-	{
-	case EStatCategory::Core:
-		CategoryStats = {
-			EStatType::Health_Core,
-			EStatType::Stamina,
-			EStatType::Energy
-		};
-		break;
-
-	case EStatCategory::Survival:
-		CategoryStats = {
-			EStatType::Hunger,
-			EStatType::Thirst,
-			EStatType::Fatigue
-		};
-		break;
-
-	case EStatCategory::Environmental:
-		CategoryStats = {
-			EStatType::BodyTemperature,
-			EStatType::Wetness
-		};
-		break;
-
-	case EStatCategory::HealthConditions:
-		CategoryStats = {
-			EStatType::HeartRate,
-			EStatType::BloodLevel,
-			EStatType::BloodPressure,
-			EStatType::Sanity,
-			EStatType::Infection_Level,
-			EStatType::Toxicity
-		};
-		break;
-
-	case EStatCategory::RPGAttributes:
-		CategoryStats = {
-			EStatType::Strength,
-			EStatType::Dexterity,
-			EStatType::Intelligence,
-			EStatType::Endurance
-		};
-		break;
-
-	case EStatCategory::All:
-		// Return all stats
-		for (int32 i = 0; i < (int32)EStatType::MAX; ++i)
-		{
-			CategoryStats.Add((EStatType)i);
-		}
-		break;
+	const FStatMaskView CategoryStats(StatCategories::GetMask(Category));
 
-	default:
-		break;
+	TArray<EStatType> Result;
+	Result.Reserve(CategoryStats.Num());
+	for (EStatType StatType : CategoryStats)
+	{
+		Result.Add(StatType);
 	}
+	return Result;
+}
 
-	return CategoryStats;
+FStatMaskView UStatComponent::GetPresentStatsInCategory(EStatCategory Category) const
+{
+	return FStatMaskView(StatCategories::GetMask(Category) & Stats.GetPresenceMask());
 }
 
 bool UStatComponent::IsAnyCriticalInCategory(EStatCategory Category) const
 {
-	TArray<EStatType> CategoryStats = GetStatsInCategory(Category);
-
-	for (EStatType StatType : CategoryStats)
+	for (EStatType StatType : GetPresentStatsInCategory(Category))
 	{
 		if (IsStatCritical(StatType))
 		{
@@ -508,8 +1045,7 @@ bool UStatComponent::IsAnyCriticalInList(const TArray<EStatType>& StatsToCheck)
 
 EStatType UStatComponent::GetLowestStatInCategory(EStatCategory Category, float& OutPercentage) const
 {
-	TArray<EStatType> CategoryStats = GetStatsInCategory(Category);
-	return GetLowestStatInList(CategoryStats, OutPercentage);
+	return GetLowestStatInMask(StatCategories::GetMask(Category), OutPercentage);
 }
 
 EStatType UStatComponent::GetLowestStatInList(const TArray<EStatType>& StatsToCheck, float& OutPercentage) const
@@ -519,9 +1055,9 @@ EStatType UStatComponent::GetLowestStatInList(const TArray<EStatType>& StatsToCh
 
 	for (EStatType StatType : StatsToCheck)
 	{
-		if (HasStat(StatType))
+		if (const FStatValue* Stat = Stats.Find(StatType))
 		{
-			float Percentage = GetStatPercentage(StatType);
+			float Percentage = GetLiveStat(*Stat).GetPercentage();
 			if (Percentage < LowestPercentage)
 			{
 				LowestPercentage = Percentage;
@@ -534,25 +1070,34 @@ EStatType UStatComponent::GetLowestStatInList(const TArray<EStatType>& StatsToCh
 	return LowestStat;
 }
 
-float UStatComponent::GetAverageHealthInCategory(EStatCategory Category) const
+EStatType UStatComponent::GetLowestStatInMask(uint32 StatMask, float& OutPercentage) const
 {
-	TArray<EStatType> CategoryStats = GetStatsInCategory(Category);
+	EStatType LowestStat = EStatType::Health_Core;
+	float LowestPercentage = 1.0f;
 
-	if (CategoryStats.Num() == 0)
+	for (EStatType StatType : FStatMaskView(StatMask & Stats.GetPresenceMask()))
 	{
-		return 1.0f;
+		const float Percentage = GetLiveStat(Stats[StatType]).GetPercentage();
+		if (Percentage < LowestPercentage)
+		{
+			LowestPercentage = Percentage;
+			LowestStat = StatType;
+		}
 	}
 
+	OutPercentage = LowestPercentage;
+	return LowestStat;
+}
+
+float UStatComponent::GetAverageHealthInCategory(EStatCategory Category) const
+{
 	float TotalPercentage = 0.0f;
 	int32 ValidStats = 0;
 
-	for (EStatType StatType : CategoryStats)
+	for (EStatType StatType : GetPresentStatsInCategory(Category))
 	{
-		if (HasStat(StatType))
-		{
-			TotalPercentage += GetStatPercentage(StatType);
-			ValidStats++;
-		}
+		TotalPercentage += GetLiveStat(Stats[StatType]).GetPercentage();
+		ValidStats++;
 	}
 
 	return ValidStats > 0 ? TotalPercentage / ValidStats : 1.0f;
@@ -560,8 +1105,19 @@ float UStatComponent::GetAverageHealthInCategory(EStatCategory Category) const
 
 void UStatComponent::RestoreAllStatsInCategory(EStatCategory Category, float Amount)
 {
-	TArray<EStatType> CategoryStats = GetStatsInCategory(Category);
-	RestoreStatsInList(CategoryStats, Amount);
+	// Only server can modify stats
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	const FStatMaskView CategoryStats(StatCategories::GetMask(Category));
+	for (EStatType StatType : CategoryStats)
+	{
+		ApplyStatChange(StatType, Amount, TEXT("BatchRestore"), FGameplayTag());
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("StatComponent: Restored %d stats by %.2f"), CategoryStats.Num(), Amount);
 }
 
 void UStatComponent::RestoreStatsInList(const TArray<EStatType>& StatsToRestore, float Amount)
@@ -584,22 +1140,19 @@ void UStatComponent::RestoreStatsInList(const TArray<EStatType>& StatsToRestore,
 
 EStatType UStatComponent::GetLowestStat(float& OutPercentage) const
 {
-	TArray<EStatType> AllStats;
-	Stats.GetKeys(AllStats);
-	return GetLowestStatInList(AllStats, OutPercentage);
+	SyncStatAggregates();
+	return StatAggregates.GetLowest(OutPercentage);
 }
 
 EStatType UStatComponent::GetHighestStat(float& OutPercentage) const
 {
-	TArray<EStatType> AllStats;
-	Stats.GetKeys(AllStats);
-	return GetHighestStatInList(AllStats, OutPercentage);
+	SyncStatAggregates();
+	return StatAggregates.GetHighest(OutPercentage);
 }
 
 EStatType UStatComponent::GetHighestStatInCategory(EStatCategory Category, float& OutPercentage) const
 {
-	TArray<EStatType> CategoryStats = GetStatsInCategory(Category);
-	return GetHighestStatInList(CategoryStats, OutPercentage);
+	return GetHighestStatInMask(StatCategories::GetMask(Category), OutPercentage);
 }
 
 EStatType UStatComponent::GetHighestStatInList(const TArray<EStatType>& StatsToCheck, float& OutPercentage) const
@@ -609,9 +1162,9 @@ EStatType UStatComponent::GetHighestStatInList(const TArray<EStatType>& StatsToC
 
 	for (EStatType StatType : StatsToCheck)
 	{
-		if (HasStat(StatType))
+		if (const FStatValue* Stat = Stats.Find(StatType))
 		{
-			float Percentage = GetStatPercentage(StatType);
+			float Percentage = GetLiveStat(*Stat).GetPercentage();
 			if (Percentage > HighestPercentage)
 			{
 				HighestPercentage = Percentage;
@@ -624,6 +1177,25 @@ EStatType UStatComponent::GetHighestStatInList(const TArray<EStatType>& StatsToC
 	return HighestStat;
 }
 
+EStatType UStatComponent::GetHighestStatInMask(uint32 StatMask, float& OutPercentage) const
+{
+	EStatType HighestStat = EStatType::Health_Core;
+	float HighestPercentage = 0.0f;
+
+	for (EStatType StatType : FStatMaskView(StatMask & Stats.GetPresenceMask()))
+	{
+		const float Percentage = GetLiveStat(Stats[StatType]).GetPercentage();
+		if (Percentage > HighestPercentage)
+		{
+			HighestPercentage = Percentage;
+			HighestStat = StatType;
+		}
+	}
+
+	OutPercentage = HighestPercentage;
+	return HighestStat;
+}
+
 void UStatComponent::TransferStatValue(EStatType FromStat, EStatType ToStat, float Amount)
 {
 	// Only server can modify stats
@@ -656,16 +1228,18 @@ void UStatComponent::RestoreAllStatsToMax()
 		return;
 	}
 
-	for (auto& StatPair : Stats)
+	for (auto StatPair : Stats)
 	{
 		EStatType StatType = StatPair.Key;
 		FStatValue& Stat = StatPair.Value;
+		RebaseLazyStat(Stat);
 		float OldValue = Stat.CurrentValue;
 		Stat.CurrentValue = Stat.MaxValue;
 
 		if (!FMath::IsNearlyEqual(OldValue, Stat.CurrentValue))
 		{
 			BroadcastStatEvents(StatType, OldValue, Stat.CurrentValue);
+			JournalStatChange(StatType, Stat.CurrentValue - OldValue, Stat.CurrentValue, StatJournalSource::RestoreToMax, FGameplayTag());
 		}
 	}
 
@@ -680,7 +1254,7 @@ void UStatComponent::SetAllStatsToValue(float Value)
 		return;
 	}
 
-	for (auto& StatPair : Stats)
+	for (auto StatPair : Stats)
 	{
 		SetStatValue(StatPair.Key, Value);
 	}
@@ -696,8 +1270,7 @@ void UStatComponent::SetCategoryStatsToValue(EStatCategory Category, float Value
 		return;
 	}
 
-	TArray<EStatType> CategoryStats = GetStatsInCategory(Category);
-	for (EStatType StatType : CategoryStats)
+	for (EStatType StatType : GetPresentStatsInCategory(Category))
 	{
 		SetStatValue(StatType, Value);
 	}
@@ -716,12 +1289,19 @@ bool UStatComponent::IsStatGreaterThan(EStatType StatA, EStatType StatB) const
 }
 
 int32 UStatComponent::GetStatsBelowThresholdCount(float Threshold) const
+{
+	SyncStatAggregates();
+	return StatAggregates.CountBelow(Threshold);
+}
+
+int32 UStatComponent::GetCategoryStatsBelowThresholdCount(EStatCategory Category, float Threshold) const
 {
 	int32 Count = 0;
 
-	for (const auto& StatPair : Stats)
+	// Absent stats read as 0% and count as below
+	for (EStatType StatType : FStatMaskView(StatCategories::GetMask(Category)))
 	{
-		if (GetStatPercentage(StatPair.Key) < Threshold)
+		if (GetStatPercentage(StatType) < Threshold)
 		{
 			Count++;
 		}
@@ -730,18 +1310,319 @@ int32 UStatComponent::GetStatsBelowThresholdCount(float Threshold) const
 	return Count;
 }
 
-int32 UStatComponent::GetCategoryStatsBelowThresholdCount(EStatCategory Category, float Threshold) const
+// ========== LAZY EVALUATION ==========
+
+namespace StatComponentLazy
 {
-	int32 Count = 0;
-	TArray<EStatType> CategoryStats = GetStatsInCategory(Category);
+	/** Schedule crossings slightly late so the crossing has definitely happened */
+	static constexpr float ThresholdSlack = 0.01f;
 
-	for (EStatType StatType : CategoryStats)
+	/** Reschedules closer than this to the queued time keep the queued entry */
+	static constexpr double RescheduleTolerance = 0.001;
+}
+
+double UStatComponent::GetStatClockTime() const
+{
+	// Server: world time. Clients: replicated server clock, so lazy values match the server
+	return UStatThresholdScheduler::GetClockTime(GetWorld());
+}
+
+float UStatComponent::GetLazyRate(const FStatValue& Stat) const
+{
+	return (bEnabled && bEnableAutoRegeneration) ? Stat.RegenerationRate : 0.0f;
+}
+
+FStatValue UStatComponent::GetLiveStat(const FStatValue& Stat) const
+{
+	if (!Stat.IsLazy())
 	{
-		if (GetStatPercentage(StatType) < Threshold)
+		return Stat;
+	}
+
+	FStatValue LiveStat = Stat;
+	LiveStat.CurrentValue = Stat.GetValueAt(GetStatClockTime());
+	return LiveStat;
+}
+
+float UStatComponent::GetLiveValue(const FStatValue& Stat) const
+{
+	return Stat.IsLazy() ? Stat.GetValueAt(GetStatClockTime()) : Stat.CurrentValue;
+}
+
+void UStatComponent::RebaseLazyStat(FStatValue& Stat)
+{
+	if (Stat.IsLazy())
+	{
+		Stat.RebaseLazy(GetStatClockTime(), GetLazyRate(Stat));
+	}
+}
+
+void UStatComponent::ResetLazyEvaluation()
+{
+	const double Now = GetStatClockTime();
+
+	for (auto StatPair : Stats)
+	{
+		FStatValue& Stat = StatPair.Value;
+
+		// Curve-driven stats depend on their own percentage, so they stay ticked
+		const bool bLazy = bUseLazyEvaluation && !Stat.RegenerationCurve;
+		Stat.LazyTimestamp = bLazy ? Now : -1.0;
+		Stat.LazyRate = bLazy ? GetLazyRate(Stat) : 0.0f;
+	}
+
+	// Lazy stats have no simulation lane
+	MarkStatSimulationDirty();
+	UpdateTickEnabled();
+
+	// Fresh start (init / load): adopt the current states silently and schedule crossings
+	StatAggregates.Reset();
+	DriftingStatsMask = 0;
+	StepValuesMask = 0;
+	for (const auto& StatPair : Stats)
+	{
+		UpdateThresholdEdges(StatPair.Key, false);
+	}
+}
+
+void UStatComponent::RebaseLazyStats()
+{
+	if (!bUseLazyEvaluation)
+	{
+		return;
+	}
+
+	for (auto StatPair : Stats)
+	{
+		RebaseLazyStat(StatPair.Value);
+		UpdateThresholdEdges(StatPair.Key);
+	}
+}
+
+void UStatComponent::UpdateTickEnabled()
+{
+	// Only the server regenerates, and only stats the subsystem isn't driving and that aren't lazy (curve-driven)
+	bool bNeedsTick = false;
+	if (GetOwnerRole() == ROLE_Authority && !StatSimulation)
+	{
+		for (const auto& StatPair : Stats)
 		{
-			Count++;
+			if (!StatPair.Value.IsLazy())
+			{
+				bNeedsTick = true;
+				break;
+			}
 		}
 	}
 
-	return Count;
+	SetComponentTickEnabled(bNeedsTick);
+}
+
+// ========== THRESHOLD EDGES ==========
+
+void UStatComponent::ScheduleThresholdCrossing(EStatType StatType)
+{
+	if (!ThresholdScheduler || !GetWorld())
+	{
+		return;
+	}
+
+	const int32 Index = (int32)StatType;
+	const FStatValue* Stat = Stats.Find(StatType);
+
+	// Eager stats report edges as they are written (or via the simulation subsystem)
+	if (!Stat || !Stat->IsLazy() || FMath::IsNearlyZero(Stat->LazyRate))
+	{
+		if (ThresholdFireTimes[Index] >= 0.0)
+		{
+			++ThresholdSerials[Index];
+			ThresholdFireTimes[Index] = -1.0;
+		}
+		return;
+	}
+
+	const double Now = GetStatClockTime();
+	const float LiveValue = Stat->GetValueAt(Now);
+	const float CriticalValue = Stat->MaxValue * CriticalThreshold;
+	float TargetValue;
+
+	// Next threshold ahead in the direction of travel
+	if (Stat->LazyRate > 0.0f)
+	{
+		if (LiveValue < CriticalValue)
+		{
+			TargetValue = CriticalValue;
+		}
+		else if (LiveValue < Stat->MaxValue)
+		{
+			TargetValue = Stat->MaxValue;
+		}
+		else
+		{
+			TargetValue = LiveValue;
+		}
+	}
+	else if (LiveValue >= CriticalValue && CriticalValue > 0.0f)
+	{
+		TargetValue = CriticalValue;
+	}
+	else if (LiveValue > 0.0f)
+	{
+		TargetValue = 0.0f;
+	}
+	else
+	{
+		TargetValue = LiveValue;
+	}
+
+	if (TargetValue == LiveValue)
+	{
+		// Pinned at a bound - nothing ahead
+		if (ThresholdFireTimes[Index] >= 0.0)
+		{
+			++ThresholdSerials[Index];
+			ThresholdFireTimes[Index] = -1.0;
+		}
+		return;
+	}
+
+	const double FireTime = Now
+		+ FMath::Max((TargetValue - LiveValue) / Stat->LazyRate, 0.0f) + StatComponentLazy::ThresholdSlack;
+
+	// Unchanged prediction (e.g. a mutation on another stat's path) - keep the queued entry
+	if (ThresholdFireTimes[Index] >= 0.0 && FMath::IsNearlyEqual(ThresholdFireTimes[Index], FireTime, StatComponentLazy::RescheduleTolerance))
+	{
+		return;
+	}
+
+	++ThresholdSerials[Index];
+	ThresholdFireTimes[Index] = FireTime;
+	ThresholdScheduler->Schedule(this, this, StatType, ThresholdSerials[Index], FireTime);
+}
+
+bool UStatComponent::IsStatThresholdScheduleCurrent(EStatType StatType, uint32 Serial) const
+{
+	const int32 Index = (int32)StatType;
+	return Index >= 0 && Index < FStatContainer::Capacity && ThresholdSerials[Index] == Serial;
+}
+
+void UStatComponent::OnStatThresholdDue(EStatType StatType, uint32 Serial)
+{
+	if (!IsStatThresholdScheduleCurrent(StatType, Serial))
+	{
+		return;
+	}
+
+	ThresholdFireTimes[(int32)StatType] = -1.0;
+
+	FStatValue* Stat = Stats.Find(StatType);
+	if (!Stat)
+	{
+		return;
+	}
+
+	// Rebase only the crossing stat, so it replicates and the rest stay quiet
+	const float OldValue = Stat->CurrentValue;
+	RebaseLazyStat(*Stat);
+
+	if (FMath::IsNearlyEqual(OldValue, Stat->CurrentValue))
+	{
+		UpdateThresholdEdges(StatType);
+	}
+	else
+	{
+		BroadcastStatEvents(StatType, OldValue, Stat->CurrentValue);
+	}
+}
+
+// ========== AGGREGATES ==========
+
+void UStatComponent::RefreshStatAggregate(EStatType StatType)
+{
+	const uint32 StatBit = 1u << (uint32)StatType;
+	const FStatValue* Stat = Stats.Find(StatType);
+	if (!Stat)
+	{
+		StatAggregates.Remove(StatType);
+		DriftingStatsMask &= ~StatBit;
+		return;
+	}
+
+	StatAggregates.Set(StatType, GetLiveStat(*Stat).GetPercentage());
+
+	const bool bDrifting = Stat->IsLazy()
+		? !FMath::IsNearlyZero(Stat->LazyRate)
+		: (Stat->RegenerationCurve || !FMath::IsNearlyZero(Stat->RegenerationRate));
+	DriftingStatsMask = bDrifting ? (DriftingStatsMask | StatBit) : (DriftingStatsMask & ~StatBit);
+}
+
+void UStatComponent::SyncStatAggregates() const
+{
+	StatAggregates.SetCriticalThreshold(CriticalThreshold);
+
+	if (DriftingStatsMask && AggregatesSyncFrame != GFrameCounter)
+	{
+		AggregatesSyncFrame = GFrameCounter;
+		for (EStatType StatType : FStatMaskView(DriftingStatsMask))
+		{
+			if (const FStatValue* Stat = Stats.Find(StatType))
+			{
+				StatAggregates.Set(StatType, GetLiveStat(*Stat).GetPercentage());
+			}
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	if (Settings && Settings->bValidateStatAggregates)
+	{
+		ValidateStatAggregates();
+	}
+#endif
+}
+
+void UStatComponent::ValidateStatAggregates() const
+{
+	FStatAggregates Expected;
+	Expected.SetCriticalThreshold(CriticalThreshold);
+	for (const auto& StatPair : Stats)
+	{
+		Expected.Set(StatPair.Key, GetLiveStat(StatPair.Value).GetPercentage());
+	}
+
+	if (!StatAggregates.Matches(Expected))
+	{
+		float Lowest = 0.0f;
+		float ExpectedLowest = 0.0f;
+		const EStatType LowestStat = StatAggregates.GetLowest(Lowest);
+		const EStatType ExpectedLowestStat = Expected.GetLowest(ExpectedLowest);
+
+		UE_LOG(LogTemp, Warning, TEXT("StatComponent: Aggregates out of date on %s - average %.4f (expected %.4f), lowest %d at %.4f (expected %d at %.4f), critical mask 0x%08x (expected 0x%08x)"),
+			*GetNameSafe(GetOwner()),
+			StatAggregates.GetAverage(), Expected.GetAverage(),
+			(int32)LowestStat, Lowest, (int32)ExpectedLowestStat, ExpectedLowest,
+			StatAggregates.GetCriticalMask(), Expected.GetCriticalMask());
+	}
+}
+
+// ========== FIXED TIMESTEP ==========
+
+void UStatComponent::CaptureStepValues()
+{
+	for (const auto& StatPair : Stats)
+	{
+		const int32 Index = (int32)StatPair.Key;
+		const uint32 StatBit = 1u << Index;
+
+		// First capture has nothing to blend from
+		PreviousStepValues[Index] = (StepValuesMask & StatBit) ? LastStepValues[Index] : StatPair.Value.CurrentValue;
+		LastStepValues[Index] = StatPair.Value.CurrentValue;
+	}
+
+	StepValuesMask = Stats.GetPresenceMask();
+}
+
+float UStatComponent::GetFixedStepAlpha() const
+{
+	return StatSimulation ? StatSimulation->GetFixedStepAlpha() : RegenFixedStep.GetAlpha();
 }
@@ -0,0 +1,109 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatLayer/StatContainer.h"
+
+void FStatContainer::SetReplicationQuantization(EStatType StatType, const FStatQuantizationSettings& Settings)
+{
+	const int32 Index = (int32)StatType;
+	if (Index >= 0 && Index < Capacity)
+	{
+		Quantization[Index] = Settings;
+	}
+}
+
+void FStatContainer::ResetReplicationQuantization()
+{
+	for (FStatQuantizationSettings& Settings : Quantization)
+	{
+		Settings = FStatQuantizationSettings();
+	}
+}
+
+void FStatContainer::SyncReplicatedItems()
+{
+	uint32 ReplicatedMask = 0;
+
+	// Update or remove existing items
+	for (int32 ItemIndex = ReplicatedItems.Num() - 1; ItemIndex >= 0; --ItemIndex)
+	{
+		FStatReplicatedItem& Item = ReplicatedItems[ItemIndex];
+		const int32 Index = Item.StatIndex;
+
+		if (!ContainsIndex(Index))
+		{
+			ReplicatedItems.RemoveAtSwap(ItemIndex);
+			MarkArrayDirty();
+			continue;
+		}
+
+		ReplicatedMask |= (1u << Index);
+		if (Item.Value.SetFromStat(Values[Index], Quantization[Index]))
+		{
+			MarkItemDirty(Item);
+		}
+	}
+
+	// Add items for newly present stats
+	uint32 MissingMask = PresenceMask & ~ReplicatedMask;
+	while (MissingMask)
+	{
+		const int32 Index = FMath::CountTrailingZeros(MissingMask);
+		MissingMask &= MissingMask - 1;
+
+		FStatReplicatedItem& Item = ReplicatedItems.AddDefaulted_GetRef();
+		Item.StatIndex = (uint8)Index;
+		Item.Value.SetFromStat(Values[Index], Quantization[Index]);
+		MarkItemDirty(Item);
+	}
+}
+
+void FStatContainer::ApplyReplicatedItems(const TArrayView<int32>& Indices)
+{
+	for (const int32 ItemIndex : Indices)
+	{
+		const FStatReplicatedItem& Item = ReplicatedItems[ItemIndex];
+		const int32 Index = Item.StatIndex;
+		if (Index < 0 || Index >= Capacity)
+		{
+			continue;
+		}
+
+		FStatReplicatedChange& Change = ReplicatedChanges.AddDefaulted_GetRef();
+		Change.StatType = (EStatType)Item.StatIndex;
+		Change.bWasPresent = ContainsIndex(Index);
+		Change.OldStat = Values[Index];
+
+		Item.Value.ApplyToStat(Values[Index]);
+		PresenceMask |= (1u << Index);
+	}
+}
+
+void FStatContainer::PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize)
+{
+	for (const int32 ItemIndex : RemovedIndices)
+	{
+		const EStatType StatType = (EStatType)ReplicatedItems[ItemIndex].StatIndex;
+		if (!Contains(StatType))
+		{
+			continue;
+		}
+
+		FStatReplicatedChange& Change = ReplicatedChanges.AddDefaulted_GetRef();
+		Change.StatType = StatType;
+		Change.bWasPresent = true;
+		Change.bRemoved = true;
+		Change.OldStat = Values[(int32)StatType];
+
+		Remove(StatType);
+	}
+}
+
+void FStatContainer::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize)
+{
+	ApplyReplicatedItems(AddedIndices);
+}
+
+void FStatContainer::PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize)
+{
+	ApplyReplicatedItems(ChangedIndices);
+}
@@ -0,0 +1,189 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatLayer/StatCurveLUT.h"
+#include "StatSystemProSettings.h"
+#include "Curves/CurveFloat.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace StatCurveLUT
+{
+	/** Upper bound when auto-increasing resolution to meet the max-error setting */
+	static constexpr int32 MaxResolution = 1024;
+
+	/** Error-check probes between each pair of samples */
+	static constexpr int32 ProbesPerSegment = 4;
+
+	static TUniquePtr<FStatCurveLUTCache> Instance;
+}
+
+FStatCurveLUTCache& FStatCurveLUTCache::Get()
+{
+	if (!StatCurveLUT::Instance)
+	{
+		StatCurveLUT::Instance = TUniquePtr<FStatCurveLUTCache>(new FStatCurveLUTCache());
+	}
+	return *StatCurveLUT::Instance;
+}
+
+void FStatCurveLUTCache::Shutdown()
+{
+	StatCurveLUT::Instance.Reset();
+}
+
+bool FStatCurveLUTCache::IsEnabled()
+{
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	return Settings && Settings->bUseCurveLUTs;
+}
+
+FStatCurveLUTCache::FStatCurveLUTCache()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FStatCurveLUTCache::HandlePostGarbageCollect);
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FStatCurveLUTCache::HandleObjectModified);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FStatCurveLUTCache::HandleObjectPropertyChanged);
+#endif
+}
+
+FStatCurveLUTCache::~FStatCurveLUTCache()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectModified.RemoveAll(this);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.RemoveAll(this);
+#endif
+}
+
+const FStatCurveLUT* FStatCurveLUTCache::FindOrBake(const UCurveFloat* Curve)
+{
+	if (!Curve)
+	{
+		return nullptr;
+	}
+
+	RebakeModified();
+
+	const FObjectKey Key(Curve);
+	if (TUniquePtr<FStatCurveLUT>* Existing = Tables.Find(Key))
+	{
+		return Existing->Get();
+	}
+
+	TUniquePtr<FStatCurveLUT>& LUT = Tables.Add(Key, MakeUnique<FStatCurveLUT>());
+	Bake(Curve, *LUT);
+	return LUT.Get();
+}
+
+float FStatCurveLUTCache::Evaluate(const UCurveFloat* Curve, float Percentage)
+{
+	if (!Curve)
+	{
+		return 0.0f;
+	}
+
+	if (IsEnabled())
+	{
+		return FindOrBake(Curve)->Evaluate(Percentage);
+	}
+
+	return Curve->GetFloatValue(Percentage);
+}
+
+void FStatCurveLUTCache::RebakeModified()
+{
+	if (ModifiedCurves.Num() == 0)
+	{
+		return;
+	}
+
+	for (const FObjectKey& Key : ModifiedCurves)
+	{
+		TUniquePtr<FStatCurveLUT>* LUT = Tables.Find(Key);
+		const UCurveFloat* Curve = Cast<UCurveFloat>(Key.ResolveObjectPtr());
+		if (LUT && Curve)
+		{
+			// Rebake in place so pointers held by components stay valid
+			Bake(Curve, **LUT);
+		}
+	}
+
+	ModifiedCurves.Reset();
+}
+
+void FStatCurveLUTCache::Bake(const UCurveFloat* Curve, FStatCurveLUT& OutLUT)
+{
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	const float MaxAllowedError = Settings ? Settings->CurveLUTMaxError : 0.01f;
+	int32 Resolution = FMath::Clamp(Settings ? Settings->CurveLUTResolution : 64, 2, StatCurveLUT::MaxResolution);
+
+	OutLUT.SourceCurve = Curve;
+
+	while (true)
+	{
+		// Sample at X = 0, 1/Resolution, ..., 1
+		OutLUT.Samples.SetNumUninitialized(Resolution + 1);
+		for (int32 Index = 0; Index <= Resolution; ++Index)
+		{
+			OutLUT.Samples[Index] = Curve->GetFloatValue((float)Index / Resolution);
+		}
+
+		// Max-error check: probe between samples against the source curve
+		OutLUT.MeasuredMaxError = 0.0f;
+		const int32 NumProbes = Resolution * StatCurveLUT::ProbesPerSegment;
+		for (int32 Probe = 0; Probe <= NumProbes; ++Probe)
+		{
+			const float X = (float)Probe / NumProbes;
+			const float Error = FMath::Abs(OutLUT.Evaluate(X) - Curve->GetFloatValue(X));
+			OutLUT.MeasuredMaxError = FMath::Max(OutLUT.MeasuredMaxError, Error);
+		}
+
+		if (OutLUT.MeasuredMaxError <= MaxAllowedError || Resolution >= StatCurveLUT::MaxResolution)
+		{
+			break;
+		}
+
+		Resolution = FMath::Min(Resolution * 2, StatCurveLUT::MaxResolution);
+	}
+
+	if (OutLUT.MeasuredMaxError > MaxAllowedError)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StatCurveLUT: '%s' error %.4f exceeds max %.4f at resolution %d"),
+			*Curve->GetName(), OutLUT.MeasuredMaxError, MaxAllowedError, Resolution);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("StatCurveLUT: Baked '%s' (%d samples, error %.5f)"),
+			*Curve->GetName(), OutLUT.Samples.Num(), OutLUT.MeasuredMaxError);
+	}
+}
+
+void FStatCurveLUTCache::HandlePostGarbageCollect()
+{
+	for (auto It = Tables.CreateIterator(); It; ++It)
+	{
+		if (!It.Value()->SourceCurve.IsValid())
+		{
+			ModifiedCurves.Remove(It.Key());
+			It.RemoveCurrent();
+			++Generation;
+		}
+	}
+}
+
+#if WITH_EDITOR
+void FStatCurveLUTCache::HandleObjectModified(UObject* Object)
+{
+	// Fires before the edit lands - queue it, RebakeModified picks up the new keys next tick
+	if (Object && Object->IsA<UCurveFloat>() && Tables.Contains(FObjectKey(Object)))
+	{
+		ModifiedCurves.Add(FObjectKey(Object));
+	}
+}
+
+void FStatCurveLUTCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	HandleObjectModified(Object);
+}
+#endif
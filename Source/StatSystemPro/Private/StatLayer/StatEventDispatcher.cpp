@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatLayer/StatEventDispatcher.h"
+
+FStatEventSubscription FStatEventDispatcher::Subscribe(EStatType StatType, EStatEventKind Kind, FStatNativeEventDelegate&& Delegate)
+{
+	FStatEventSubscription Subscription;
+	Subscription.StatType = StatType;
+	Subscription.Kind = Kind;
+
+	if ((int32)StatType >= NumStats || (int32)Kind >= NumKinds || !Delegate.IsBound())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StatEventDispatcher: Ignoring invalid subscription (stat %d, event %d)"), (int32)StatType, (int32)Kind);
+		return Subscription;
+	}
+
+	if (Listeners.Num() == 0)
+	{
+		Listeners.SetNum(NumKinds * NumStats);
+	}
+
+	Subscription.Handle = GetListeners(StatType, Kind).Add(MoveTemp(Delegate));
+	SubscribedMask[(int32)Kind] |= (1u << (uint32)StatType);
+	return Subscription;
+}
+
+bool FStatEventDispatcher::Unsubscribe(FStatEventSubscription& Subscription)
+{
+	if (!Subscription.IsValid() || Listeners.Num() == 0)
+	{
+		return false;
+	}
+
+	const bool bRemoved = GetListeners(Subscription.StatType, Subscription.Kind).Remove(Subscription.Handle);
+	UpdateSubscribedBit(Subscription.StatType, Subscription.Kind);
+	Subscription.Reset();
+	return bRemoved;
+}
+
+void FStatEventDispatcher::UnsubscribeAll(const void* UserObject)
+{
+	if (!UserObject || Listeners.Num() == 0)
+	{
+		return;
+	}
+
+	for (int32 Kind = 0; Kind < NumKinds; ++Kind)
+	{
+		for (int32 Stat = 0; Stat < NumStats; ++Stat)
+		{
+			if (SubscribedMask[Kind] & (1u << Stat))
+			{
+				GetListeners((EStatType)Stat, (EStatEventKind)Kind).RemoveAll(UserObject);
+				UpdateSubscribedBit((EStatType)Stat, (EStatEventKind)Kind);
+			}
+		}
+	}
+}
+
+void FStatEventDispatcher::UpdateSubscribedBit(EStatType StatType, EStatEventKind Kind)
+{
+	const uint32 StatBit = 1u << (uint32)StatType;
+	if (GetListeners(StatType, Kind).IsBound())
+	{
+		SubscribedMask[(int32)Kind] |= StatBit;
+	}
+	else
+	{
+		SubscribedMask[(int32)Kind] &= ~StatBit;
+	}
+}
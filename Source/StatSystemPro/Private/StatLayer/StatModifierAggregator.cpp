@@ -0,0 +1,174 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatLayer/StatModifierAggregator.h"
+
+FStatModifierAggregator::FAggregate* FStatModifierAggregator::FindAggregate(EStatType StatType, EStatModifierTarget Target)
+{
+	const int32 StatIndex = (int32)StatType;
+	const int32 TargetIndex = (int32)Target;
+	if (Aggregates.Num() == 0 || StatIndex >= NumStats || TargetIndex >= NumTargets)
+	{
+		return nullptr;
+	}
+	return &Aggregates[TargetIndex * NumStats + StatIndex];
+}
+
+const FStatModifierAggregator::FAggregate* FStatModifierAggregator::FindAggregate(EStatType StatType, EStatModifierTarget Target) const
+{
+	return const_cast<FStatModifierAggregator*>(this)->FindAggregate(StatType, Target);
+}
+
+FStatModifierHandle FStatModifierAggregator::Add(EStatType StatType, EStatModifierTarget Target, EStatModifierOp Op, float Magnitude, FName Source)
+{
+	FStatModifierHandle Handle;
+	if ((int32)StatType >= NumStats || (int32)Target >= NumTargets)
+	{
+		return Handle;
+	}
+
+	if (Aggregates.Num() == 0)
+	{
+		Aggregates.SetNum(NumTargets * NumStats);
+	}
+
+	FAggregate& Aggregate = *FindAggregate(StatType, Target);
+
+	FModifier& Modifier = Aggregate.Modifiers.AddDefaulted_GetRef();
+	Modifier.Id = ++LastId;
+	Modifier.Op = Op;
+	Modifier.Magnitude = Magnitude;
+	Modifier.Source = Source;
+	Aggregate.bDirty = true;
+
+	Handle.Id = Modifier.Id;
+	Handle.StatType = StatType;
+	Handle.Target = Target;
+	return Handle;
+}
+
+bool FStatModifierAggregator::Update(const FStatModifierHandle& Handle, float NewMagnitude)
+{
+	FAggregate* Aggregate = Handle.IsValid() ? FindAggregate(Handle.StatType, Handle.Target) : nullptr;
+	if (!Aggregate)
+	{
+		return false;
+	}
+
+	for (FModifier& Modifier : Aggregate->Modifiers)
+	{
+		if (Modifier.Id == Handle.Id)
+		{
+			if (Modifier.Magnitude != NewMagnitude)
+			{
+				Modifier.Magnitude = NewMagnitude;
+				Aggregate->bDirty = true;
+			}
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FStatModifierAggregator::Remove(const FStatModifierHandle& Handle)
+{
+	FAggregate* Aggregate = Handle.IsValid() ? FindAggregate(Handle.StatType, Handle.Target) : nullptr;
+	if (!Aggregate)
+	{
+		return false;
+	}
+
+	const int32 NumRemoved = Aggregate->Modifiers.RemoveAll([&Handle](const FModifier& Modifier)
+	{
+		return Modifier.Id == Handle.Id;
+	});
+
+	Aggregate->bDirty |= NumRemoved > 0;
+	return NumRemoved > 0;
+}
+
+int32 FStatModifierAggregator::RemoveBySource(FName Source, uint32 (&OutDirtyMasks)[(int32)EStatModifierTarget::MAX])
+{
+	int32 TotalRemoved = 0;
+	for (int32 Target = 0; Target < NumTargets; ++Target)
+	{
+		OutDirtyMasks[Target] = 0;
+	}
+
+	for (int32 Index = 0; Index < Aggregates.Num(); ++Index)
+	{
+		FAggregate& Aggregate = Aggregates[Index];
+		if (Aggregate.Modifiers.Num() == 0)
+		{
+			continue;
+		}
+
+		const int32 NumRemoved = Aggregate.Modifiers.RemoveAll([Source](const FModifier& Modifier)
+		{
+			return Modifier.Source == Source;
+		});
+
+		if (NumRemoved > 0)
+		{
+			Aggregate.bDirty = true;
+			OutDirtyMasks[Index / NumStats] |= 1u << (Index % NumStats);
+			TotalRemoved += NumRemoved;
+		}
+	}
+
+	return TotalRemoved;
+}
+
+bool FStatModifierAggregator::HasModifiers(EStatType StatType, EStatModifierTarget Target) const
+{
+	const FAggregate* Aggregate = FindAggregate(StatType, Target);
+	return Aggregate && Aggregate->Modifiers.Num() > 0;
+}
+
+float FStatModifierAggregator::Evaluate(EStatType StatType, EStatModifierTarget Target, float BaseValue)
+{
+	FAggregate* Aggregate = FindAggregate(StatType, Target);
+	if (!Aggregate)
+	{
+		return BaseValue;
+	}
+
+	if (Aggregate->bDirty)
+	{
+		Aggregate->FlatSum = 0.0f;
+		Aggregate->Multiplier = 1.0f;
+		for (const FModifier& Modifier : Aggregate->Modifiers)
+		{
+			if (Modifier.Op == EStatModifierOp::Additive)
+			{
+				Aggregate->FlatSum += Modifier.Magnitude;
+			}
+			else
+			{
+				Aggregate->Multiplier *= Modifier.Magnitude;
+			}
+		}
+		Aggregate->bDirty = false;
+	}
+
+	return (BaseValue + Aggregate->FlatSum) * Aggregate->Multiplier;
+}
+
+float FStatModifierAggregator::GetBaseRegenerationRate(EStatType StatType) const
+{
+	const FAggregate* Aggregate = FindAggregate(StatType, EStatModifierTarget::RegenerationRate);
+	return Aggregate ? Aggregate->BaseValue : 0.0f;
+}
+
+void FStatModifierAggregator::SetBaseRegenerationRate(EStatType StatType, float Rate)
+{
+	if (FAggregate* Aggregate = FindAggregate(StatType, EStatModifierTarget::RegenerationRate))
+	{
+		Aggregate->BaseValue = Rate;
+	}
+}
+
+void FStatModifierAggregator::Reset()
+{
+	Aggregates.Empty();
+}
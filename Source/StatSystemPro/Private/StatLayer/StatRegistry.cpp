@@ -0,0 +1,159 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatLayer/StatRegistry.h"
+#include "StatSystemProSettings.h"
+#include "DataTableOverrides/OverrideTypes.h"
+#include "StatLayer/StatCurveLUT.h"
+#include "Engine/DataTable.h"
+
+namespace StatRegistry
+{
+	static TUniquePtr<FStatRegistry> Instance;
+}
+
+FStatRegistry& FStatRegistry::Get()
+{
+	if (!StatRegistry::Instance)
+	{
+		StatRegistry::Instance = TUniquePtr<FStatRegistry>(new FStatRegistry());
+	}
+	return *StatRegistry::Instance;
+}
+
+void FStatRegistry::Shutdown()
+{
+	StatRegistry::Instance.Reset();
+}
+
+FStatRegistry::FStatRegistry()
+{
+	check(IsInGameThread());
+
+	RegisterBuiltInStats();
+
+	for (int32 Category = 0; Category < (int32)EStatCategory::MAX; ++Category)
+	{
+		CategoryMasks[Category] = StatCategories::GetBuiltInMask((EStatCategory)Category);
+	}
+
+	if (const UStatSystemProSettings* Settings = UStatSystemProSettings::Get())
+	{
+		for (const TSoftObjectPtr<UDataTable>& TablePtr : Settings->CustomStatTables)
+		{
+			if (UDataTable* Table = TablePtr.LoadSynchronous())
+			{
+				LoadedTables.Emplace(Table);
+				RegisterCustomStatTable(Table);
+			}
+			else if (!TablePtr.IsNull())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("StatRegistry: Could not load custom stat table %s"), *TablePtr.ToString());
+			}
+		}
+	}
+
+	if (CustomStats.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("StatRegistry: Registered %d custom stats"), CustomStats.Num());
+	}
+}
+
+void FStatRegistry::RegisterBuiltInStats()
+{
+	const UEnum* StatEnum = StaticEnum<EStatType>();
+	if (!StatEnum)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < StatSlots::NumBuiltIn; ++i)
+	{
+		const EStatType StatType = (EStatType)StatEnum->GetValueByIndex(i);
+		NameToStat.Add(FName(*StatEnum->GetNameStringByIndex(i)), StatType);
+		NameToStat.FindOrAdd(FName(*StatEnum->GetDisplayNameTextByIndex(i).ToString()), StatType);
+	}
+}
+
+void FStatRegistry::RegisterCustomStatTable(const UDataTable* Table)
+{
+	if (Table->GetRowStruct() != FCustomStatDefinitionRow::StaticStruct())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StatRegistry: %s is not a Custom Stat Definition table"), *Table->GetName());
+		return;
+	}
+
+	// Row order is stable for a given asset, so every machine assigns the same slots
+	Table->ForeachRow<FCustomStatDefinitionRow>(TEXT("FStatRegistry::RegisterCustomStatTable"),
+		[this, Table](const FName& RowName, const FCustomStatDefinitionRow& Row)
+		{
+			const FName StatID = Row.StatID.IsNone() ? RowName : Row.StatID;
+
+			if (NameToStat.Contains(StatID))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("StatRegistry: Duplicate stat '%s' in %s ignored"), *StatID.ToString(), *Table->GetName());
+				return;
+			}
+
+			if (CustomStats.Num() >= StatSlots::MaxCustom)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("StatRegistry: Custom stat '%s' ignored - all %d custom slots are used"), *StatID.ToString(), StatSlots::MaxCustom);
+				return;
+			}
+
+			const int32 CustomIndex = CustomStats.Num();
+
+			FCustomStatInfo& Info = CustomStats.AddDefaulted_GetRef();
+			Info.StatType = (EStatType)(StatSlots::NumBuiltIn + CustomIndex);
+			Info.StatID = StatID;
+			Info.DisplayName = Row.DisplayName.IsEmpty() ? FText::FromName(StatID) : Row.DisplayName;
+			Info.Category = Row.Category;
+
+			Info.DefaultValue.BaseMaxValue = FMath::Max(0.0f, Row.MaxValue);
+			Info.DefaultValue.MaxValue = Info.DefaultValue.BaseMaxValue;
+			Info.DefaultValue.CurrentValue = FMath::Clamp(Row.DefaultValue, 0.0f, Info.DefaultValue.MaxValue);
+			Info.DefaultValue.RegenerationRate = Row.RegenerationRate;
+			Info.DefaultValue.RegenerationCurve = Row.RegenerationCurve;
+
+			if (Row.RegenerationCurve && FStatCurveLUTCache::IsEnabled())
+			{
+				FStatCurveLUTCache::Get().FindOrBake(Row.RegenerationCurve);
+			}
+
+			const uint32 StatBit = StatCategories::Bit(Info.StatType);
+			if ((int32)Row.Category < (int32)EStatCategory::All)
+			{
+				CategoryMasks[(int32)Row.Category] |= StatBit;
+			}
+			CategoryMasks[(int32)EStatCategory::All] |= StatBit;
+
+			NameToStat.Add(StatID, Info.StatType);
+		});
+}
+
+EStatType FStatRegistry::FindStat(FName StatName) const
+{
+	const EStatType* StatType = NameToStat.Find(StatName);
+	return StatType ? *StatType : EStatType::MAX;
+}
+
+const FCustomStatInfo* FStatRegistry::FindCustomStat(EStatType StatType) const
+{
+	const int32 CustomIndex = (int32)StatType - StatSlots::NumBuiltIn;
+	return CustomStats.IsValidIndex(CustomIndex) ? &CustomStats[CustomIndex] : nullptr;
+}
+
+FName FStatRegistry::GetStatName(EStatType StatType) const
+{
+	if (const FCustomStatInfo* Info = FindCustomStat(StatType))
+	{
+		return Info->StatID;
+	}
+
+	const UEnum* StatEnum = StaticEnum<EStatType>();
+	if (StatEnum && (int32)StatType < StatSlots::NumBuiltIn)
+	{
+		return FName(*StatEnum->GetNameStringByValue((int64)StatType));
+	}
+
+	return NAME_None;
+}
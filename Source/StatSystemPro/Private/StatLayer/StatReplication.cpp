@@ -0,0 +1,179 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatLayer/StatReplication.h"
+#include "UObject/CoreNet.h"
+
+namespace StatReplication
+{
+	/** Full range of a 16-bit percentage */
+	static constexpr float Percentage16Scale = 65535.0f;
+
+	/** Quantize a non-negative value to a step count */
+	FORCEINLINE static uint32 ToSteps(float Value, float Step)
+	{
+		return (uint32)FMath::Clamp<double>(FMath::RoundToDouble(FMath::Max(Value, 0.0f) / Step), 0.0, (double)MAX_uint32);
+	}
+
+	/** Quantize a value to a 16-bit fraction of Max */
+	FORCEINLINE static uint16 ToPercentage16(float Value, float Max)
+	{
+		const float Percentage = Max > 0.0f ? FMath::Clamp(Value / Max, 0.0f, 1.0f) : 0.0f;
+		return (uint16)FMath::RoundToInt(Percentage * Percentage16Scale);
+	}
+}
+
+FStatQuantizationSettings::FStatQuantizationSettings(EStatReplicationQuantization InMode, float InPrecision)
+	: Mode(InMode)
+	, StepMillis((uint32)FMath::Clamp(FMath::RoundToInt(InPrecision * 1000.0f), 1, 1000000))
+{
+}
+
+bool FStatNetValue::SetFromStat(const FStatValue& Stat, const FStatQuantizationSettings& Settings)
+{
+	FStatNetValue Quantized;
+	Quantized.Mode = Settings.Mode;
+	Quantized.StepMillis = Settings.StepMillis;
+	Quantized.BaseMaxValue = Stat.BaseMaxValue;
+	Quantized.RegenerationRate = Stat.RegenerationRate;
+	Quantized.RegenerationCurve = Stat.RegenerationCurve;
+	Quantized.LazyRate = Stat.LazyRate;
+	Quantized.LazyTimestamp = Stat.LazyTimestamp;
+
+	// Round exactly as NetSerialize will, so the comparison sees what clients would see
+	switch (Settings.Mode)
+	{
+	case EStatReplicationQuantization::Precision:
+	{
+		const float Step = Settings.GetStep();
+		Quantized.CurrentValue = StatReplication::ToSteps(Stat.CurrentValue, Step) * Step;
+		Quantized.MaxValue = StatReplication::ToSteps(Stat.MaxValue, Step) * Step;
+		if (Stat.BaseMaxValue == Stat.MaxValue)
+		{
+			// Keep the one-bit "base max = max" encoding
+			Quantized.BaseMaxValue = Quantized.MaxValue;
+		}
+		break;
+	}
+	case EStatReplicationQuantization::Percentage16:
+		Quantized.MaxValue = Stat.MaxValue;
+		Quantized.CurrentValue = StatReplication::ToPercentage16(Stat.CurrentValue, Stat.MaxValue) / StatReplication::Percentage16Scale * Stat.MaxValue;
+		break;
+	default:
+		Quantized.CurrentValue = Stat.CurrentValue;
+		Quantized.MaxValue = Stat.MaxValue;
+		break;
+	}
+
+	const bool bChanged = Quantized.CurrentValue != CurrentValue
+		|| Quantized.MaxValue != MaxValue
+		|| Quantized.BaseMaxValue != BaseMaxValue
+		|| Quantized.RegenerationRate != RegenerationRate
+		|| Quantized.RegenerationCurve != RegenerationCurve
+		|| Quantized.LazyRate != LazyRate
+		|| Quantized.LazyTimestamp != LazyTimestamp
+		|| Quantized.Mode != Mode
+		|| Quantized.StepMillis != StepMillis;
+
+	if (bChanged)
+	{
+		*this = Quantized;
+	}
+	return bChanged;
+}
+
+void FStatNetValue::ApplyToStat(FStatValue& OutStat) const
+{
+	OutStat.CurrentValue = CurrentValue;
+	OutStat.MaxValue = MaxValue;
+	OutStat.BaseMaxValue = BaseMaxValue;
+	OutStat.RegenerationRate = RegenerationRate;
+	OutStat.RegenerationCurve = RegenerationCurve;
+	OutStat.LazyRate = LazyRate;
+	OutStat.LazyTimestamp = LazyTimestamp;
+}
+
+bool FStatNetValue::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	// 2 bits of mode, then the step only when it's used
+	uint8 ModeBits = (uint8)Mode;
+	Ar.SerializeBits(&ModeBits, 2);
+	Mode = (EStatReplicationQuantization)ModeBits;
+
+	if (Mode == EStatReplicationQuantization::Precision)
+	{
+		Ar.SerializeIntPacked(StepMillis);
+		StepMillis = FMath::Max<uint32>(StepMillis, 1);
+	}
+
+	switch (Mode)
+	{
+	case EStatReplicationQuantization::Precision:
+	{
+		const float Step = StepMillis * 0.001f;
+		uint32 CurrentSteps = StatReplication::ToSteps(CurrentValue, Step);
+		uint32 MaxSteps = StatReplication::ToSteps(MaxValue, Step);
+		Ar.SerializeIntPacked(CurrentSteps);
+		Ar.SerializeIntPacked(MaxSteps);
+		if (Ar.IsLoading())
+		{
+			CurrentValue = CurrentSteps * Step;
+			MaxValue = MaxSteps * Step;
+		}
+		break;
+	}
+	case EStatReplicationQuantization::Percentage16:
+	{
+		uint16 CurrentPercentage = StatReplication::ToPercentage16(CurrentValue, MaxValue);
+		Ar << MaxValue;
+		Ar << CurrentPercentage;
+		if (Ar.IsLoading())
+		{
+			CurrentValue = CurrentPercentage / StatReplication::Percentage16Scale * MaxValue;
+		}
+		break;
+	}
+	default:
+		Ar << CurrentValue;
+		Ar << MaxValue;
+		break;
+	}
+
+	// Base max almost always equals max - one bit instead of a float
+	uint8 bBaseMaxIsMax = (BaseMaxValue == MaxValue) ? 1 : 0;
+	Ar.SerializeBits(&bBaseMaxIsMax, 1);
+	if (bBaseMaxIsMax)
+	{
+		BaseMaxValue = MaxValue;
+	}
+	else
+	{
+		Ar << BaseMaxValue;
+	}
+
+	Ar << RegenerationRate;
+
+	UObject* Curve = RegenerationCurve;
+	bOutSuccess &= Map ? Map->SerializeObject(Ar, UCurveFloat::StaticClass(), Curve) : true;
+	if (Ar.IsLoading())
+	{
+		RegenerationCurve = Cast<UCurveFloat>(Curve);
+	}
+
+	// Lazy stats also need their clock so clients can extrapolate
+	uint8 bLazy = LazyTimestamp >= 0.0 ? 1 : 0;
+	Ar.SerializeBits(&bLazy, 1);
+	if (bLazy)
+	{
+		Ar << LazyRate;
+		Ar << LazyTimestamp;
+	}
+	else
+	{
+		LazyRate = 0.0f;
+		LazyTimestamp = -1.0;
+	}
+
+	return true;
+}
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "StatSystemPro.h"
+#include "StatLayer/StatCurveLUT.h"
+#include "StatLayer/StatRegistry.h"
 
 #define LOCTEXT_NAMESPACE "FStatSystemProModule"
 
@@ -13,6 +15,9 @@ void FStatSystemProModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	FStatRegistry::Shutdown();
+	FStatCurveLUTCache::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
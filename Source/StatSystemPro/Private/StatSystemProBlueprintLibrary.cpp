@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "StatSystemProBlueprintLibrary.h"
+#include "StatLayer/StatRegistry.h"
 
 // ========== Component Access ==========
 
@@ -104,6 +105,17 @@ float UStatSystemProBlueprintLibrary::GetStatPercentage(AActor* Actor, EStatType
 	return 0.0f;
 }
 
+bool UStatSystemProBlueprintLibrary::FindStatByName(FName StatName, EStatType& OutStatType)
+{
+	OutStatType = FStatRegistry::Get().FindStat(StatName);
+	return OutStatType != EStatType::MAX;
+}
+
+FName UStatSystemProBlueprintLibrary::GetStatName(EStatType StatType)
+{
+	return FStatRegistry::Get().GetStatName(StatType);
+}
+
 // ========== Quick Body Functions ==========
 
 void UStatSystemProBlueprintLibrary::DamageBodyPart(AActor* Actor, EBodyPart BodyPart, float Damage)
@@ -1,6 +1,12 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "StatSystemProComponent.h"
+#include "StatLayer/StatCurveLUT.h"
+#include "StatLayer/StatRegistry.h"
+#include "Simulation/StatSurvivalFormulas.h"
+#include "StatSystemProSettings.h"
+#include "StatSystemProStats.h"
+#include "StatSystemProTrace.h"
 #include "GameFramework/Actor.h"
 #include "Engine/DataTable.h"
 #include "Kismet/GameplayStatics.h"
@@ -8,7 +14,21 @@
 
 UStatSystemProComponent::UStatSystemProComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Layers tick through their own tick functions (see RegisterComponentTickFunctions)
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// Layer tick intervals (seconds, 0 = every frame)
+	StatLayerTickInterval = 0.0f;
+	BodyLayerTickInterval = 0.1f;
+	WeatherLayerTickInterval = 0.5f;
+	StatusEffectLayerTickInterval = 0.1f;
+	ProgressionLayerTickInterval = 1.0f;
+	TimeLayerTickInterval = 0.25f;
+
+	// Enabled layers get their object (and start awake) on registration; idle ones sleep after BeginPlay
+	ActiveLayerMask = 0;
+	WokenLayerMask = 0;
+	ReadyLayerMask = 0;
 
 	// Layer toggles - all enabled by default
 	bEnableStatLayer = true;
@@ -18,43 +38,41 @@ UStatSystemProComponent::UStatSystemProComponent()
 	bEnableProgressionLayer = true;
 	bEnableTimeLayer = true;
 
+	// Layer objects are created for enabled layers when the component registers
+	StatLayer = nullptr;
+	BodyLayer = nullptr;
+	WeatherLayer = nullptr;
+	StatusEffectLayer = nullptr;
+	ProgressionLayer = nullptr;
+	TimeLayer = nullptr;
+
 	// Stat Layer defaults
 	CriticalThreshold = 0.15f;
 	bUseSimpleMode = true;
 	bEnableAutoRegeneration = true;
 	StatConfigTable = nullptr;
+	StatSimulation = nullptr;
+	StatSimulationHandle = INDEX_NONE;
+	ChangeJournal = nullptr;
+	bFastForwarding = false;
+	bBatchStatChangeEvents = false;
 
 	// Body Layer defaults
 	BodyPartConfigTable = nullptr;
 
-	// Weather Layer defaults
-	CurrentWeather = EWeatherType::Clear;
-	AmbientTemperature = 20.0f;
-	WindSpeed = 5.0f;
-	WetnessLevel = 0.0f;
-	ShelterLevel = 0.0f;
-	CurrentFreezingStage = EFreezingStage::None;
-	CurrentOverheatingStage = EOverheatingStage::None;
-
 	// Status Effect Layer defaults
 	StatusEffectTable = nullptr;
 
 	// Progression Layer defaults
-	CurrentLevel = 1;
-	CurrentXP = 0;
-	StatPoints = 0;
 	SkillTreeTable = nullptr;
 	XPCurve = nullptr;
 
 	// Time Layer defaults
-	CurrentGameTime = 0.0f;
 	TimeMultiplier = 1.0f;
-	CurrentHour = 8; // Start at 8 AM
-	CurrentDay = 1;
-	CurrentTimeOfDay = ETimeOfDay::Morning;
 
-	// Enable replication
+	// Enable replication (layer objects replicate as registered subobjects)
 	SetIsReplicatedByDefault(true);
+	bReplicateUsingRegisteredSubObjectList = true;
 }
 
 void UStatSystemProComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -69,90 +87,821 @@ void UStatSystemProComponent::GetLifetimeReplicatedProps(TArray<FLifetimePropert
 	DOREPLIFETIME(UStatSystemProComponent, bEnableProgressionLayer);
 	DOREPLIFETIME(UStatSystemProComponent, bEnableTimeLayer);
 
-	// Stat Layer
-	DOREPLIFETIME(UStatSystemProComponent, Stats);
-
-	// Body Layer
-	DOREPLIFETIME(UStatSystemProComponent, BodyParts);
-
-	// Weather Layer
-	DOREPLIFETIME(UStatSystemProComponent, CurrentWeather);
-	DOREPLIFETIME(UStatSystemProComponent, AmbientTemperature);
-	DOREPLIFETIME(UStatSystemProComponent, WindSpeed);
-	DOREPLIFETIME(UStatSystemProComponent, WetnessLevel);
-	DOREPLIFETIME(UStatSystemProComponent, ShelterLevel);
-	DOREPLIFETIME(UStatSystemProComponent, EquippedClothing);
-	DOREPLIFETIME(UStatSystemProComponent, CurrentFreezingStage);
-	DOREPLIFETIME(UStatSystemProComponent, CurrentOverheatingStage);
-
-	// Status Effect Layer
-	DOREPLIFETIME(UStatSystemProComponent, ActiveEffects);
-
-	// Progression Layer
-	DOREPLIFETIME(UStatSystemProComponent, CurrentLevel);
-	DOREPLIFETIME(UStatSystemProComponent, CurrentXP);
-	DOREPLIFETIME(UStatSystemProComponent, StatPoints);
-	DOREPLIFETIME(UStatSystemProComponent, UnlockedSkills);
+	// Layer objects (their data replicates with them - see StatSystemProLayers.cpp)
+	DOREPLIFETIME(UStatSystemProComponent, StatLayer);
+	DOREPLIFETIME(UStatSystemProComponent, BodyLayer);
+	DOREPLIFETIME(UStatSystemProComponent, WeatherLayer);
+	DOREPLIFETIME(UStatSystemProComponent, StatusEffectLayer);
+	DOREPLIFETIME(UStatSystemProComponent, ProgressionLayer);
+	DOREPLIFETIME(UStatSystemProComponent, TimeLayer);
 
 	// Time Layer
-	DOREPLIFETIME(UStatSystemProComponent, CurrentGameTime);
 	DOREPLIFETIME(UStatSystemProComponent, TimeMultiplier);
-	DOREPLIFETIME(UStatSystemProComponent, CurrentHour);
-	DOREPLIFETIME(UStatSystemProComponent, CurrentDay);
-	DOREPLIFETIME(UStatSystemProComponent, CurrentTimeOfDay);
+}
+
+void UStatSystemProComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// Only stats whose quantized values changed get marked dirty and sent
+	if (StatLayer)
+	{
+		StatLayer->Stats.SyncReplicatedItems();
+	}
 }
 
 void UStatSystemProComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	ChangeJournal = GetWorld() ? GetWorld()->GetSubsystem<UStatChangeJournalSubsystem>() : nullptr;
+
 	// Only server initializes
 	if (GetOwnerRole() == ROLE_Authority)
 	{
+		CreateEnabledLayers();
 		InitializeAllLayers();
+		RegisterWithStatSimulation();
 	}
+
+	RefreshDormancy();
+}
+
+void UStatSystemProComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromStatSimulation();
+
+	ChangeJournal = nullptr;
+
+	// Deliver the last partial batch while listeners can still use it
+	FlushBatchedStatEvents();
+
+	Super::EndPlay(EndPlayReason);
 }
 
-void UStatSystemProComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UStatSystemProComponent::JournalStatChange(EStatType StatType, float Amount, float NewValue, FName Source, FGameplayTag ReasonTag)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	if (ChangeJournal)
+	{
+		ChangeJournal->RecordChange(this, StatType, Amount, NewValue, Source, ReasonTag);
+	}
+}
+
+void UStatSystemProComponent::RegisterWithStatSimulation()
+{
+	// The subsystem simulates the stat layer's container
+	if (!StatLayer || StatSimulation || !UStatSimulationSubsystem::IsBatchedSimulationEnabled())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UStatSimulationSubsystem* Subsystem = World ? World->GetSubsystem<UStatSimulationSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	StatSimulationHandle = Subsystem->RegisterClient(this, this);
+	if (StatSimulationHandle != INDEX_NONE)
+	{
+		StatSimulation = Subsystem;
+
+		// The subsystem regenerates for us
+		SetLayerActive(EStatSystemProLayer::Stat, false);
+	}
+}
+
+void UStatSystemProComponent::UnregisterFromStatSimulation()
+{
+	if (StatSimulation)
+	{
+		StatSimulation->UnregisterClient(StatSimulationHandle);
+		StatSimulation = nullptr;
+		StatSimulationHandle = INDEX_NONE;
+	}
+}
 
+void UStatSystemProComponent::MarkStatSimulationDirty()
+{
+	if (StatSimulation)
+	{
+		StatSimulation->MarkClientDirty(StatSimulationHandle);
+	}
+}
+
+void UStatSystemProComponent::OnSimulatedStatChanged(EStatType StatType, float OldValue, float NewValue)
+{
+	NotifyStatChanged(StatType, OldValue, NewValue, StatJournalSource::Regeneration, FGameplayTag());
+	JournalStatChange(StatType, NewValue - OldValue, NewValue, StatJournalSource::Regeneration, FGameplayTag());
+
+	// Regen moved body temperature away from equilibrium
+	if (StatType == EStatType::BodyTemperature)
+	{
+		WakeLayer(EStatSystemProLayer::Weather);
+	}
+}
+
+void UStatSystemProComponent::OnSimulatedStatCrossedThreshold(EStatType StatType, float OldValue, float NewValue)
+{
+	const FStatValue* Stat = StatLayer ? StatLayer->Stats.Find(StatType) : nullptr;
+	if (!Stat || FMath::IsNearlyEqual(OldValue, NewValue))
+	{
+		return;
+	}
+
+	if (Stat->IsAtZero() && !FMath::IsNearlyZero(OldValue))
+	{
+		StatLayer->OnStatReachedZero.Broadcast(StatType);
+		NativeStatEvents.Broadcast(StatType, EStatEventKind::ReachedZero, Stat->CurrentValue, Stat->CurrentValue);
+	}
+
+	if (Stat->IsAtMax() && !FMath::IsNearlyEqual(OldValue, Stat->MaxValue))
+	{
+		StatLayer->OnStatReachedMax.Broadcast(StatType);
+		NativeStatEvents.Broadcast(StatType, EStatEventKind::ReachedMax, Stat->CurrentValue, Stat->CurrentValue);
+	}
+
+	// The kernel flags crossings in both directions - only entering critical (from at/above it) fires
+	if (Stat->GetPercentage() < CriticalThreshold && OldValue >= Stat->MaxValue * CriticalThreshold)
+	{
+		StatLayer->OnStatCritical.Broadcast(StatType, Stat->CurrentValue);
+		NativeStatEvents.Broadcast(StatType, EStatEventKind::Critical, Stat->CurrentValue, Stat->CurrentValue);
+	}
+}
+
+void UStatSystemProComponent::NotifyStatChanged(EStatType StatType, float OldValue, float NewValue, FName Source, const FGameplayTag& ReasonTag)
+{
+	// Stat changes come from the stat layer
+	if (!StatLayer)
+	{
+		return;
+	}
+
+	TRACE_STATSYSTEMPRO_STAT_CHANGED(this, StatType, OldValue, NewValue, Source, ReasonTag);
+	INC_DWORD_STAT(STAT_StatSystemPro_EventsBroadcast);
+	StatLayer->OnStatChanged.Broadcast(StatType, OldValue, NewValue);
+	NativeStatEvents.Broadcast(StatType, EStatEventKind::Changed, OldValue, NewValue);
+
+	if (!bBatchStatChangeEvents)
+	{
+		return;
+	}
+
+	const int32 Index = (int32)StatType;
+	if (StatLayer->PendingStatChangeIndices[Index] == INDEX_NONE)
+	{
+		// First change this frame keeps the old value
+		StatLayer->PendingStatChangeIndices[Index] = StatLayer->PendingStatChanges.Num();
+		FStatChangeRecord& Record = StatLayer->PendingStatChanges.AddDefaulted_GetRef();
+		Record.StatType = StatType;
+		Record.OldValue = OldValue;
+	}
+
+	FStatChangeRecord& Record = StatLayer->PendingStatChanges[StatLayer->PendingStatChangeIndices[Index]];
+	Record.NewValue = NewValue;
+
+	// Regeneration gives no reason (same as UStatComponent)
+	if (Source != StatJournalSource::Regeneration && (!Source.IsNone() || ReasonTag.IsValid()))
+	{
+		Record.Reasons.AddUnique(FStatChangeReason(Source, ReasonTag));
+	}
+
+	if (!StatLayer->bStatChangeFlushQueued)
+	{
+		UWorld* World = GetWorld();
+		UStatEventBatchSubsystem* EventBatch = World ? World->GetSubsystem<UStatEventBatchSubsystem>() : nullptr;
+		if (EventBatch)
+		{
+			EventBatch->QueueFlush(this, this);
+			StatLayer->bStatChangeFlushQueued = true;
+		}
+		else
+		{
+			// No world to flush at end of frame - deliver immediately
+			FlushBatchedStatEvents();
+		}
+	}
+}
+
+void UStatSystemProComponent::FlushBatchedStatEvents()
+{
+	if (!StatLayer)
+	{
+		return;
+	}
+
+	StatLayer->bStatChangeFlushQueued = false;
+
+	if (StatLayer->PendingStatChanges.Num() == 0)
+	{
+		return;
+	}
+
+	// Move out first so listeners that change stats start a new batch
+	TArray<FStatChangeRecord> Changes = MoveTemp(StatLayer->PendingStatChanges);
+	StatLayer->PendingStatChanges.Reset();
+	for (const FStatChangeRecord& Record : Changes)
+	{
+		StatLayer->PendingStatChangeIndices[(int32)Record.StatType] = INDEX_NONE;
+	}
+
+	// Stats that ended the frame where they started are dropped
+	Changes.RemoveAll([](const FStatChangeRecord& Record)
+	{
+		return FMath::IsNearlyEqual(Record.OldValue, Record.NewValue);
+	});
+
+	if (Changes.Num() > 0)
+	{
+		StatLayer->OnStatsChangedBatch.Broadcast(Changes);
+	}
+}
+
+void UStatSystemProComponent::RegisterComponentTickFunctions(bool bRegister)
+{
+	Super::RegisterComponentTickFunctions(bRegister);
+
+	if (!bRegister)
+	{
+		for (int32 LayerIndex = 0; LayerIndex < (int32)EStatSystemProLayer::MAX; ++LayerIndex)
+		{
+			const EStatSystemProLayer Layer = (EStatSystemProLayer)LayerIndex;
+			UStatSystemProLayer* LayerObject = GetLayer(Layer);
+			if (!LayerObject)
+			{
+				continue;
+			}
+
+			if (LayerObject->TickFunction.IsTickFunctionRegistered())
+			{
+				LayerObject->TickFunction.UnRegisterTickFunction();
+			}
+
+			// Nothing is ticking now, so objects of layers switched off at runtime can go
+			if (!IsLayerEnabled(Layer))
+			{
+				DestroyLayer(Layer);
+			}
+		}
+		return;
+	}
+
+	// Disabled layers get no object and no tick
+	CreateEnabledLayers();
+	for (int32 LayerIndex = 0; LayerIndex < (int32)EStatSystemProLayer::MAX; ++LayerIndex)
+	{
+		if (UStatSystemProLayer* LayerObject = GetLayer((EStatSystemProLayer)LayerIndex))
+		{
+			RegisterLayerTickFunction(*LayerObject);
+		}
+	}
+}
+
+UStatSystemProLayer* UStatSystemProComponent::GetLayer(EStatSystemProLayer Layer) const
+{
+	switch (Layer)
+	{
+	case EStatSystemProLayer::Stat:
+		return StatLayer;
+	case EStatSystemProLayer::Body:
+		return BodyLayer;
+	case EStatSystemProLayer::Weather:
+		return WeatherLayer;
+	case EStatSystemProLayer::StatusEffect:
+		return StatusEffectLayer;
+	case EStatSystemProLayer::Progression:
+		return ProgressionLayer;
+	case EStatSystemProLayer::Time:
+		return TimeLayer;
+	default:
+		return nullptr;
+	}
+}
+
+bool UStatSystemProComponent::IsLayerEnabled(EStatSystemProLayer Layer) const
+{
+	switch (Layer)
+	{
+	case EStatSystemProLayer::Stat:
+		return bEnableStatLayer;
+	case EStatSystemProLayer::Body:
+		return bEnableBodyLayer;
+	case EStatSystemProLayer::Weather:
+		return bEnableWeatherLayer;
+	case EStatSystemProLayer::StatusEffect:
+		return bEnableStatusEffectLayer;
+	case EStatSystemProLayer::Progression:
+		return bEnableProgressionLayer;
+	case EStatSystemProLayer::Time:
+		return bEnableTimeLayer;
+	default:
+		return false;
+	}
+}
+
+namespace StatLayerObjects
+{
+	/** Create the object of an enabled layer that doesn't have one yet (returns the new object) */
+	template<typename LayerType>
+	static UStatSystemProLayer* CreateIfEnabled(UStatSystemProComponent* Outer, LayerType*& LayerObject, bool bEnabled)
+	{
+		if (LayerObject || !bEnabled)
+		{
+			return nullptr;
+		}
+
+		LayerObject = NewObject<LayerType>(Outer);
+		return LayerObject;
+	}
+}
+
+void UStatSystemProComponent::CreateEnabledLayers()
+{
+	// Clients get the server's layer objects by replication; editor previews never need them
+	const UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld() || GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	UStatSystemProLayer* CreatedLayers[] =
+	{
+		StatLayerObjects::CreateIfEnabled(this, StatLayer, bEnableStatLayer),
+		StatLayerObjects::CreateIfEnabled(this, BodyLayer, bEnableBodyLayer),
+		StatLayerObjects::CreateIfEnabled(this, WeatherLayer, bEnableWeatherLayer),
+		StatLayerObjects::CreateIfEnabled(this, StatusEffectLayer, bEnableStatusEffectLayer),
+		StatLayerObjects::CreateIfEnabled(this, ProgressionLayer, bEnableProgressionLayer),
+		StatLayerObjects::CreateIfEnabled(this, TimeLayer, bEnableTimeLayer)
+	};
+
+	for (UStatSystemProLayer* LayerObject : CreatedLayers)
+	{
+		if (!LayerObject)
+		{
+			continue;
+		}
+
+		const EStatSystemProLayer Layer = LayerObject->GetLayerType();
+		const uint8 LayerBit = (uint8)(1 << (int32)Layer);
+
+		FStatSystemProLayerTickFunction& TickFunction = LayerObject->TickFunction;
+		TickFunction.Target = this;
+		TickFunction.Layer = Layer;
+		TickFunction.bCanEverTick = true;
+		TickFunction.bStartWithTickEnabled = true;
+		TickFunction.bAllowTickOnDedicatedServer = true;
+
+		// New layers start awake
+		ActiveLayerMask |= LayerBit;
+
+		AddReplicatedSubObject(LayerObject);
+
+		// Layers switched on mid-play start from their config like they would at BeginPlay
+		if (HasBegunPlay())
+		{
+			if (Layer == EStatSystemProLayer::Stat)
+			{
+				InitializeStats();
+				RegisterWithStatSimulation();
+			}
+			else if (Layer == EStatSystemProLayer::Body)
+			{
+				InitializeBodyParts();
+			}
+		}
+
+		ReadyLayerMask |= LayerBit;
+		OnLayerReady.Broadcast(LayerObject);
+	}
+}
+
+void UStatSystemProComponent::DestroyLayer(EStatSystemProLayer Layer)
+{
+	UStatSystemProLayer* LayerObject = GetLayer(Layer);
+	if (!LayerObject || GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	// The stat tick keeps the body/weather ticks as prerequisites
+	if (StatLayer && StatLayer != LayerObject)
+	{
+		StatLayer->TickFunction.RemovePrerequisite(LayerObject, LayerObject->TickFunction);
+	}
+
+	// The simulation subsystem holds on to the stat container
+	if (Layer == EStatSystemProLayer::Stat)
+	{
+		UnregisterFromStatSimulation();
+	}
+
+	RemoveReplicatedSubObject(LayerObject);
+
+	const uint8 LayerBit = (uint8)(1 << (int32)Layer);
+	ActiveLayerMask &= ~LayerBit;
+	WokenLayerMask &= ~LayerBit;
+	ReadyLayerMask &= ~LayerBit;
+
+	switch (Layer)
+	{
+	case EStatSystemProLayer::Stat:
+		StatLayer = nullptr;
+		break;
+	case EStatSystemProLayer::Body:
+		BodyLayer = nullptr;
+		break;
+	case EStatSystemProLayer::Weather:
+		WeatherLayer = nullptr;
+		break;
+	case EStatSystemProLayer::StatusEffect:
+		StatusEffectLayer = nullptr;
+		break;
+	case EStatSystemProLayer::Progression:
+		ProgressionLayer = nullptr;
+		break;
+	case EStatSystemProLayer::Time:
+		TimeLayer = nullptr;
+		break;
+	default:
+		break;
+	}
+}
+
+void UStatSystemProComponent::RegisterLayerTickFunction(UStatSystemProLayer& LayerObject)
+{
+	// Replicated layers (clients) don't simulate - only layers created here tick
+	FStatSystemProLayerTickFunction& TickFunction = LayerObject.TickFunction;
+	if (TickFunction.Target != this || TickFunction.IsTickFunctionRegistered())
+	{
+		return;
+	}
+
+	TickFunction.TickInterval = GetLayerTickInterval(TickFunction.Layer);
+
+	// Clock and progression don't feed other layers - keep them off the physics critical path
+	const bool bLateLayer = TickFunction.Layer == EStatSystemProLayer::Progression || TickFunction.Layer == EStatSystemProLayer::Time;
+	TickFunction.TickGroup = bLateLayer ? TG_PostUpdateWork : PrimaryComponentTick.TickGroup;
+
+	SetupActorComponentTickFunction(&TickFunction);
+
+	// Re-registration enables every tick - keep sleeping layers asleep
+	TickFunction.SetTickFunctionEnable((ActiveLayerMask & (1 << (int32)TickFunction.Layer)) != 0);
+
+	// Weather and body change stats, so the stat layer regenerates after them
+	if (!StatLayer)
+	{
+		return;
+	}
+
+	for (const EStatSystemProLayer FeedingLayer : { EStatSystemProLayer::Weather, EStatSystemProLayer::Body })
+	{
+		if (UStatSystemProLayer* FeedingObject = GetLayer(FeedingLayer))
+		{
+			StatLayer->TickFunction.AddPrerequisite(FeedingObject, FeedingObject->TickFunction);
+		}
+	}
+}
+
+float UStatSystemProComponent::GetLayerTickInterval(EStatSystemProLayer Layer) const
+{
+	switch (Layer)
+	{
+	case EStatSystemProLayer::Stat:
+		return StatLayerTickInterval;
+	case EStatSystemProLayer::Body:
+		return BodyLayerTickInterval;
+	case EStatSystemProLayer::Weather:
+		return WeatherLayerTickInterval;
+	case EStatSystemProLayer::StatusEffect:
+		return StatusEffectLayerTickInterval;
+	case EStatSystemProLayer::Progression:
+		return ProgressionLayerTickInterval;
+	case EStatSystemProLayer::Time:
+		return TimeLayerTickInterval;
+	default:
+		return 0.0f;
+	}
+}
+
+namespace StatLayerTrace
+{
+	/** Trace layer of each EStatSystemProLayer */
+	static constexpr EStatSystemProTraceLayer Layers[] =
+	{
+		EStatSystemProTraceLayer::Stat,
+		EStatSystemProTraceLayer::Body,
+		EStatSystemProTraceLayer::Weather,
+		EStatSystemProTraceLayer::StatusEffect,
+		EStatSystemProTraceLayer::Progression,
+		EStatSystemProTraceLayer::Time
+	};
+	static_assert(UE_ARRAY_COUNT(Layers) == (int32)EStatSystemProLayer::MAX, "One trace layer per EStatSystemProLayer");
+}
+
+void UStatSystemProComponent::TickLayer(EStatSystemProLayer Layer, float DeltaTime)
+{
 	// Only server updates
 	if (GetOwnerRole() != ROLE_Authority)
 	{
 		return;
 	}
 
-	// Update each enabled layer
-	if (bEnableStatLayer)
+	INC_DWORD_STAT(STAT_StatSystemPro_ComponentsTicked);
+	TRACE_STATSYSTEMPRO_LAYER_SCOPE(this, StatLayerTrace::Layers[(int32)Layer]);
+
+	switch (Layer)
+	{
+	case EStatSystemProLayer::Stat:
+		// Stat regen runs in the simulation subsystem when registered
+		if (bEnableStatLayer && !StatSimulation)
+		{
+			UpdateStatLayer(DeltaTime);
+		}
+		break;
+	case EStatSystemProLayer::Body:
+		if (bEnableBodyLayer)
+		{
+			UpdateBodyLayer(DeltaTime);
+		}
+		break;
+	case EStatSystemProLayer::Weather:
+		if (bEnableWeatherLayer)
+		{
+			UpdateWeatherLayer(DeltaTime);
+		}
+		break;
+	case EStatSystemProLayer::StatusEffect:
+		if (bEnableStatusEffectLayer)
+		{
+			UpdateStatusEffectLayer(DeltaTime);
+		}
+		break;
+	case EStatSystemProLayer::Progression:
+		if (bEnableProgressionLayer)
+		{
+			UpdateProgressionLayer(DeltaTime);
+		}
+		break;
+	case EStatSystemProLayer::Time:
+		if (bEnableTimeLayer)
+		{
+			UpdateTimeLayer(DeltaTime);
+		}
+		break;
+	default:
+		break;
+	}
+
+	// Nothing left to advance - sleep until a mutating call wakes the layer
+	if (IsDormancyEnabled() && !LayerHasPendingWork(Layer))
+	{
+		SetLayerActive(Layer, false);
+	}
+}
+
+// ============================================================================
+// DORMANCY
+// ============================================================================
+
+namespace StatDormancy
+{
+	/** Body temperature this close to the effective temperature counts as settled (Celsius) */
+	static constexpr float TemperatureTolerance = 0.05f;
+}
+
+bool UStatSystemProComponent::IsDormancyEnabled()
+{
+	const UStatSystemProSettings* Settings = UStatSystemProSettings::Get();
+	return Settings && Settings->bUseComponentDormancy;
+}
+
+bool UStatSystemProComponent::LayerHasPendingWork(EStatSystemProLayer Layer) const
+{
+	switch (Layer)
+	{
+	case EStatSystemProLayer::Stat:
+		if (!bEnableStatLayer || !bEnableAutoRegeneration || !StatLayer)
+		{
+			return false;
+		}
+
+		// Regen that would still move a stat
+		for (const auto& StatPair : StatLayer->Stats)
+		{
+			const FStatValue& Stat = StatPair.Value;
+			const float Rate = Stat.RegenerationCurve
+				? FStatCurveLUTCache::Get().Evaluate(Stat.RegenerationCurve, Stat.GetPercentage())
+				: Stat.RegenerationRate;
+
+			if ((Rate > KINDA_SMALL_NUMBER && !Stat.IsAtMax()) || (Rate < -KINDA_SMALL_NUMBER && !Stat.IsAtZero()))
+			{
+				return true;
+			}
+		}
+		return false;
+
+	case EStatSystemProLayer::Body:
+		if (!bEnableBodyLayer || !BodyLayer)
+		{
+			return false;
+		}
+
+		// Bleeding drains blood; infection grows until maxed, then keeps damaging the limb
+		for (const auto& PartPair : BodyLayer->BodyParts)
+		{
+			const FBodyPartState& Part = PartPair.Value;
+			if (Part.BleedingRate > 0.0f)
+			{
+				return true;
+			}
+
+			if (Part.InfectionRate > 0.0f && (Part.InfectionRate < StatSurvivalFormulas::MaxInfection || Part.Condition > 0.0f))
+			{
+				return true;
+			}
+		}
+		return false;
+
+	case EStatSystemProLayer::Weather:
+	{
+		if (!bEnableWeatherLayer || !WeatherLayer)
+		{
+			return false;
+		}
+
+		// Stages past Cold/Warm drain stats every tick
+		const EFreezingStage FreezingStage = WeatherLayer->CurrentFreezingStage;
+		const EOverheatingStage OverheatingStage = WeatherLayer->CurrentOverheatingStage;
+		if ((FreezingStage != EFreezingStage::None && FreezingStage != EFreezingStage::Cold) ||
+			(OverheatingStage != EOverheatingStage::None && OverheatingStage != EOverheatingStage::Warm))
+		{
+			return true;
+		}
+
+		// Body temperature still approaching the effective temperature
+		const FStatValue* BodyTemperature = bEnableStatLayer && StatLayer ? StatLayer->Stats.Find(EStatType::BodyTemperature) : nullptr;
+		if (!BodyTemperature)
+		{
+			return false;
+		}
+
+		const float Difference = CalculateEffectiveTemperature().EffectiveTemperature - BodyTemperature->CurrentValue;
+		return (Difference > StatDormancy::TemperatureTolerance && !BodyTemperature->IsAtMax()) ||
+			(Difference < -StatDormancy::TemperatureTolerance && !BodyTemperature->IsAtZero());
+	}
+
+	case EStatSystemProLayer::StatusEffect:
+		if (!bEnableStatusEffectLayer || !StatusEffectLayer)
+		{
+			return false;
+		}
+
+		// Only timed effects count down
+		for (const FActiveStatusEffect& Effect : StatusEffectLayer->ActiveEffects)
+		{
+			if (Effect.TimeRemaining > 0.0f)
+			{
+				return true;
+			}
+		}
+		return false;
+
+	case EStatSystemProLayer::Progression:
+		// UpdateProgressionLayer has no per-tick work yet
+		return false;
+
+	case EStatSystemProLayer::Time:
+		return bEnableTimeLayer && TimeLayer && TimeMultiplier > 0.0f;
+
+	default:
+		return false;
+	}
+}
+
+void UStatSystemProComponent::SetLayerActive(EStatSystemProLayer Layer, bool bActive)
+{
+	// Layers without an object are off, and replicated (client) layers don't tick
+	UStatSystemProLayer* LayerObject = GetLayer(Layer);
+	const uint8 LayerBit = (uint8)(1 << (int32)Layer);
+	if (!LayerObject || LayerObject->TickFunction.Target != this || bActive == ((ActiveLayerMask & LayerBit) != 0))
+	{
+		return;
+	}
+
+	if (bActive)
+	{
+		ActiveLayerMask |= LayerBit;
+		WokenLayerMask |= LayerBit;
+
+		const UWorld* World = GetWorld();
+		LayerObject->WakeTime = World ? World->GetTimeSeconds() : 0.0;
+	}
+	else
+	{
+		ActiveLayerMask &= ~LayerBit;
+	}
+
+	LayerObject->TickFunction.SetTickFunctionEnable(bActive);
+}
+
+void UStatSystemProComponent::WakeLayer(EStatSystemProLayer Layer)
+{
+	// Only the server simulates, and regen belongs to the stat simulation subsystem when registered
+	if (GetOwnerRole() != ROLE_Authority || (Layer == EStatSystemProLayer::Stat && StatSimulation))
+	{
+		return;
+	}
+
+	SetLayerActive(Layer, true);
+}
+
+void UStatSystemProComponent::WakeLayersForStat(EStatType StatType)
+{
+	WakeLayer(EStatSystemProLayer::Stat);
+
+	if (StatType == EStatType::BodyTemperature)
 	{
-		UpdateStatLayer(DeltaTime);
+		WakeLayer(EStatSystemProLayer::Weather);
 	}
+}
 
-	if (bEnableBodyLayer)
+void UStatSystemProComponent::RefreshDormancy()
+{
+	// Layers switched on since registration get their object and tick now
+	CreateEnabledLayers();
+	if (IsRegistered())
 	{
-		UpdateBodyLayer(DeltaTime);
+		for (int32 LayerIndex = 0; LayerIndex < (int32)EStatSystemProLayer::MAX; ++LayerIndex)
+		{
+			if (UStatSystemProLayer* LayerObject = GetLayer((EStatSystemProLayer)LayerIndex))
+			{
+				RegisterLayerTickFunction(*LayerObject);
+			}
+		}
 	}
 
-	if (bEnableWeatherLayer)
-	{
-		UpdateWeatherLayer(DeltaTime);
-	}
+	const bool bAuthority = GetOwnerRole() == ROLE_Authority;
+	const bool bDormancy = IsDormancyEnabled();
 
-	if (bEnableStatusEffectLayer)
+	for (int32 LayerIndex = 0; LayerIndex < (int32)EStatSystemProLayer::MAX; ++LayerIndex)
 	{
-		UpdateStatusEffectLayer(DeltaTime);
+		const EStatSystemProLayer Layer = (EStatSystemProLayer)LayerIndex;
+
+		// Clients never simulate, so their layers always sleep
+		bool bActive = !bDormancy || (bAuthority && LayerHasPendingWork(Layer));
+		if (Layer == EStatSystemProLayer::Stat && StatSimulation)
+		{
+			bActive = false;
+		}
+
+		SetLayerActive(Layer, bActive);
 	}
+}
 
-	if (bEnableProgressionLayer)
+float UStatSystemProComponent::ClampDeltaAfterWake(EStatSystemProLayer Layer, float DeltaTime)
+{
+	const uint8 LayerBit = (uint8)(1 << (int32)Layer);
+	if (!(WokenLayerMask & LayerBit))
 	{
-		UpdateProgressionLayer(DeltaTime);
+		return DeltaTime;
 	}
 
-	if (bEnableTimeLayer)
+	WokenLayerMask &= ~LayerBit;
+
+	// An interval tick's delta reaches back to its last tick, before the layer slept
+	const UWorld* World = GetWorld();
+	const UStatSystemProLayer* LayerObject = GetLayer(Layer);
+	return World && LayerObject ? FMath::Clamp((float)(World->GetTimeSeconds() - LayerObject->WakeTime), 0.0f, DeltaTime) : DeltaTime;
+}
+
+// ============================================================================
+// LAYER TICK FUNCTION
+// ============================================================================
+
+void FStatSystemProLayerTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (!Target || !IsValid(Target) || TickType == LEVELTICK_ViewportsOnly)
 	{
-		UpdateTimeLayer(DeltaTime);
+		return;
 	}
+
+	// The first tick after sleeping only covers the time since the layer woke
+	DeltaTime = Target->ClampDeltaAfterWake(Layer, DeltaTime);
+
+	// Same time dilation the component's own tick would get
+	const AActor* Owner = Target->GetOwner();
+	Target->TickLayer(Layer, Owner ? DeltaTime * Owner->CustomTimeDilation : DeltaTime);
+}
+
+FString FStatSystemProLayerTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("%s[Layer %d]"), Target ? *Target->GetFullName() : TEXT("None"), (int32)Layer);
+}
+
+FName FStatSystemProLayerTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return Target ? Target->GetClass()->GetFName() : NAME_None;
 }
 
 // ============================================================================
@@ -175,26 +924,26 @@ void UStatSystemProComponent::InitializeAllLayers()
 
 	if (bEnableWeatherLayer)
 	{
-		// Weather layer initialized via defaults in constructor
+		// Weather layer initialized via the layer object's defaults
 		UE_LOG(LogTemp, Log, TEXT("  ✓ Weather Layer initialized"));
 	}
 
-	if (bEnableStatusEffectLayer)
+	if (bEnableStatusEffectLayer && StatusEffectLayer)
 	{
 		// Status effects start empty
-		ActiveEffects.Empty();
+		StatusEffectLayer->ActiveEffects.Empty();
 		UE_LOG(LogTemp, Log, TEXT("  ✓ Status Effect Layer initialized"));
 	}
 
 	if (bEnableProgressionLayer)
 	{
 		// Progression starts at level 1
-		UE_LOG(LogTemp, Log, TEXT("  ✓ Progression Layer initialized (Level %d)"), CurrentLevel);
+		UE_LOG(LogTemp, Log, TEXT("  ✓ Progression Layer initialized (Level %d)"), GetCurrentLevel());
 	}
 
 	if (bEnableTimeLayer)
 	{
-		UE_LOG(LogTemp, Log, TEXT("  ✓ Time Layer initialized (Day %d, %02d:00)"), CurrentDay, CurrentHour);
+		UE_LOG(LogTemp, Log, TEXT("  ✓ Time Layer initialized (Day %d, %02d:00)"), GetCurrentDay(), GetCurrentHour());
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("StatSystemPro: All enabled layers initialized!"));
@@ -206,12 +955,14 @@ void UStatSystemProComponent::InitializeAllLayers()
 
 void UStatSystemProComponent::InitializeStats()
 {
-	if (!bEnableStatLayer)
+	if (!bEnableStatLayer || !StatLayer)
 	{
 		return;
 	}
 
+	FStatContainer& Stats = StatLayer->Stats;
 	Stats.Empty();
+	Stats.ResetReplicationQuantization();
 
 	if (bUseSimpleMode)
 	{
@@ -269,7 +1020,14 @@ void UStatSystemProComponent::InitializeStats()
 				NewStat.RegenerationRate = Row->DefaultRegenerationRate;
 				NewStat.RegenerationCurve = Row->RegenerationCurve;
 
+				// Bake the curve's lookup table at load rather than on first tick
+				if (Row->RegenerationCurve && FStatCurveLUTCache::IsEnabled())
+				{
+					FStatCurveLUTCache::Get().FindOrBake(Row->RegenerationCurve);
+				}
+
 				Stats.Add(Row->StatType, NewStat);
+				Stats.SetReplicationQuantization(Row->StatType, FStatQuantizationSettings(Row->ReplicationQuantization, Row->ReplicationPrecision));
 			}
 		}
 
@@ -285,148 +1043,193 @@ void UStatSystemProComponent::InitializeStats()
 
 		UE_LOG(LogTemp, Warning, TEXT("  ⚠ Stat Layer: No data table in Advanced Mode, using defaults"));
 	}
+
+	// Project-wide custom stats take the slots after the built-in ones
+	for (const FCustomStatInfo& CustomStat : FStatRegistry::Get().GetCustomStats())
+	{
+		if (!Stats.Contains(CustomStat.StatType))
+		{
+			Stats.Add(CustomStat.StatType, CustomStat.DefaultValue);
+		}
+	}
+
+	MarkStatSimulationDirty();
+	WakeLayersForStat(EStatType::BodyTemperature);
 }
 
 void UStatSystemProComponent::ApplyStatChange(EStatType StatType, float Amount, FName Source, FGameplayTag ReasonTag)
 {
-	if (!bEnableStatLayer || !HasStat(StatType))
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_ApplyStatChange);
+
+	FStatValue* StatPtr = bEnableStatLayer && StatLayer ? StatLayer->Stats.Find(StatType) : nullptr;
+	if (!StatPtr)
 	{
 		return;
 	}
 
-	FStatValue& Stat = Stats[StatType];
+	INC_DWORD_STAT(STAT_StatSystemPro_StatChangesApplied);
+
+	FStatValue& Stat = *StatPtr;
 	float OldValue = Stat.CurrentValue;
 	Stat.CurrentValue += Amount;
 	Stat.Clamp();
+	WakeLayersForStat(StatType);
+	JournalStatChange(StatType, Amount, Stat.CurrentValue, Source, ReasonTag);
 
-	// Broadcast events
-	if (!FMath::IsNearlyEqual(OldValue, Stat.CurrentValue))
+	// Broadcast events (once at the end when fast-forwarding)
+	if (!bFastForwarding && !FMath::IsNearlyEqual(OldValue, Stat.CurrentValue))
 	{
-		OnStatChanged.Broadcast(StatType, OldValue, Stat.CurrentValue);
+		NotifyStatChanged(StatType, OldValue, Stat.CurrentValue, Source, ReasonTag);
 
 		if (Stat.IsAtZero() && !FMath::IsNearlyZero(OldValue))
 		{
-			OnStatReachedZero.Broadcast(StatType);
+			StatLayer->OnStatReachedZero.Broadcast(StatType);
+			NativeStatEvents.Broadcast(StatType, EStatEventKind::ReachedZero, Stat.CurrentValue, Stat.CurrentValue);
 		}
 
 		if (Stat.IsAtMax() && !FMath::IsNearlyEqual(OldValue, Stat.MaxValue))
 		{
-			OnStatReachedMax.Broadcast(StatType);
+			StatLayer->OnStatReachedMax.Broadcast(StatType);
+			NativeStatEvents.Broadcast(StatType, EStatEventKind::ReachedMax, Stat.CurrentValue, Stat.CurrentValue);
 		}
 
 		if (Stat.GetPercentage() < CriticalThreshold)
 		{
-			OnStatCritical.Broadcast(StatType, Stat.CurrentValue);
+			StatLayer->OnStatCritical.Broadcast(StatType, Stat.CurrentValue);
+			NativeStatEvents.Broadcast(StatType, EStatEventKind::Critical, Stat.CurrentValue, Stat.CurrentValue);
 		}
 	}
 }
 
 void UStatSystemProComponent::SetStatValue(EStatType StatType, float NewValue)
 {
-	if (!bEnableStatLayer || !HasStat(StatType))
+	FStatValue* StatPtr = bEnableStatLayer && StatLayer ? StatLayer->Stats.Find(StatType) : nullptr;
+	if (!StatPtr)
 	{
 		return;
 	}
 
-	FStatValue& Stat = Stats[StatType];
+	FStatValue& Stat = *StatPtr;
 	float OldValue = Stat.CurrentValue;
 	Stat.CurrentValue = NewValue;
 	Stat.Clamp();
+	WakeLayersForStat(StatType);
 
 	if (!FMath::IsNearlyEqual(OldValue, Stat.CurrentValue))
 	{
-		OnStatChanged.Broadcast(StatType, OldValue, Stat.CurrentValue);
+		NotifyStatChanged(StatType, OldValue, Stat.CurrentValue, StatJournalSource::SetValue, FGameplayTag());
 	}
+
+	JournalStatChange(StatType, NewValue - OldValue, Stat.CurrentValue, StatJournalSource::SetValue, FGameplayTag());
 }
 
 void UStatSystemProComponent::SetStatMaxValue(EStatType StatType, float NewMaxValue)
 {
-	if (!bEnableStatLayer || !HasStat(StatType))
+	FStatValue* StatPtr = bEnableStatLayer && StatLayer ? StatLayer->Stats.Find(StatType) : nullptr;
+	if (!StatPtr)
 	{
 		return;
 	}
 
-	FStatValue& Stat = Stats[StatType];
+	FStatValue& Stat = *StatPtr;
+	const float OldMaxValue = Stat.MaxValue;
+	const float OldValue = Stat.CurrentValue;
 	Stat.MaxValue = FMath::Max(0.0f, NewMaxValue);
 	Stat.Clamp();
+	WakeLayersForStat(StatType);
+
+	StatLayer->OnStatMaxChanged.Broadcast(StatType, Stat.MaxValue);
+	NativeStatEvents.Broadcast(StatType, EStatEventKind::MaxChanged, OldMaxValue, Stat.MaxValue);
 
-	OnStatMaxChanged.Broadcast(StatType, Stat.MaxValue);
+	// A lower max clamps the current value
+	if (!FMath::IsNearlyEqual(OldValue, Stat.CurrentValue))
+	{
+		JournalStatChange(StatType, Stat.CurrentValue - OldValue, Stat.CurrentValue, StatJournalSource::SetMaxValue, FGameplayTag());
+	}
 }
 
 void UStatSystemProComponent::SetStatRegenerationRate(EStatType StatType, float Rate)
 {
-	if (!bEnableStatLayer || !HasStat(StatType))
+	FStatValue* Stat = bEnableStatLayer && StatLayer ? StatLayer->Stats.Find(StatType) : nullptr;
+	if (!Stat)
 	{
 		return;
 	}
 
-	Stats[StatType].RegenerationRate = Rate;
+	Stat->RegenerationRate = Rate;
+	MarkStatSimulationDirty();
+	WakeLayersForStat(StatType);
 }
 
 float UStatSystemProComponent::GetStatValue(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = LayerOrDefault(StatLayer).Stats.Find(StatType))
 	{
-		return Stats[StatType].CurrentValue;
+		return Stat->CurrentValue;
 	}
 	return 0.0f;
 }
 
 float UStatSystemProComponent::GetStatMaxValue(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = LayerOrDefault(StatLayer).Stats.Find(StatType))
 	{
-		return Stats[StatType].MaxValue;
+		return Stat->MaxValue;
 	}
 	return 0.0f;
 }
 
 float UStatSystemProComponent::GetStatPercentage(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = LayerOrDefault(StatLayer).Stats.Find(StatType))
 	{
-		return Stats[StatType].GetPercentage();
+		return Stat->GetPercentage();
 	}
 	return 0.0f;
 }
 
 FStatValue UStatSystemProComponent::GetStat(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = LayerOrDefault(StatLayer).Stats.Find(StatType))
 	{
-		return Stats[StatType];
+		return *Stat;
 	}
 	return FStatValue();
 }
 
 bool UStatSystemProComponent::HasStat(EStatType StatType) const
 {
-	return Stats.Contains(StatType);
+	return LayerOrDefault(StatLayer).Stats.Contains(StatType);
+}
+
+TMap<EStatType, FStatValue> UStatSystemProComponent::GetStatsMap() const
+{
+	return LayerOrDefault(StatLayer).Stats.ToMap();
 }
 
 bool UStatSystemProComponent::IsStatAtMax(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = LayerOrDefault(StatLayer).Stats.Find(StatType))
 	{
-		return Stats[StatType].IsAtMax();
+		return Stat->IsAtMax();
 	}
 	return false;
 }
 
 bool UStatSystemProComponent::IsStatAtZero(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = LayerOrDefault(StatLayer).Stats.Find(StatType))
 	{
-		return Stats[StatType].IsAtZero();
+		return Stat->IsAtZero();
 	}
 	return false;
 }
 
 bool UStatSystemProComponent::IsStatCritical(EStatType StatType) const
 {
-	if (HasStat(StatType))
+	if (const FStatValue* Stat = LayerOrDefault(StatLayer).Stats.Find(StatType))
 	{
-		return Stats[StatType].GetPercentage() < CriticalThreshold;
+		return Stat->GetPercentage() < CriticalThreshold;
 	}
 	return false;
 }
@@ -436,7 +1239,7 @@ EStatType UStatSystemProComponent::GetLowestStat() const
 	EStatType LowestStat = EStatType::Health_Core;
 	float LowestPercentage = 1.0f;
 
-	for (const auto& StatPair : Stats)
+	for (const auto& StatPair : LayerOrDefault(StatLayer).Stats)
 	{
 		float Percentage = StatPair.Value.GetPercentage();
 		if (Percentage < LowestPercentage)
@@ -454,7 +1257,7 @@ EStatType UStatSystemProComponent::GetHighestStat() const
 	EStatType HighestStat = EStatType::Health_Core;
 	float HighestPercentage = 0.0f;
 
-	for (const auto& StatPair : Stats)
+	for (const auto& StatPair : LayerOrDefault(StatLayer).Stats)
 	{
 		float Percentage = StatPair.Value.GetPercentage();
 		if (Percentage > HighestPercentage)
@@ -469,7 +1272,7 @@ EStatType UStatSystemProComponent::GetHighestStat() const
 
 bool UStatSystemProComponent::IsAnyCritical() const
 {
-	for (const auto& StatPair : Stats)
+	for (const auto& StatPair : LayerOrDefault(StatLayer).Stats)
 	{
 		if (StatPair.Value.GetPercentage() < CriticalThreshold)
 		{
@@ -482,7 +1285,7 @@ bool UStatSystemProComponent::IsAnyCritical() const
 int32 UStatSystemProComponent::GetStatsBelowThresholdCount(float Threshold) const
 {
 	int32 Count = 0;
-	for (const auto& StatPair : Stats)
+	for (const auto& StatPair : LayerOrDefault(StatLayer).Stats)
 	{
 		if (StatPair.Value.GetPercentage() < Threshold)
 		{
@@ -505,42 +1308,60 @@ void UStatSystemProComponent::TransferStatValue(EStatType FromStat, EStatType To
 
 void UStatSystemProComponent::RestoreAllStats()
 {
-	if (!bEnableStatLayer)
+	if (!bEnableStatLayer || !StatLayer)
 	{
 		return;
 	}
 
-	for (auto& StatPair : Stats)
+	for (auto StatPair : StatLayer->Stats)
 	{
+		const float OldValue = StatPair.Value.CurrentValue;
 		StatPair.Value.CurrentValue = StatPair.Value.MaxValue;
+
+		if (!FMath::IsNearlyEqual(OldValue, StatPair.Value.CurrentValue))
+		{
+			JournalStatChange(StatPair.Key, StatPair.Value.CurrentValue - OldValue, StatPair.Value.CurrentValue, StatJournalSource::RestoreToMax, FGameplayTag());
+		}
 	}
 
+	WakeLayersForStat(EStatType::BodyTemperature);
+
 	UE_LOG(LogTemp, Log, TEXT("StatSystemPro: All stats restored to max"));
 }
 
 void UStatSystemProComponent::DepleteAllStats()
 {
-	if (!bEnableStatLayer)
+	if (!bEnableStatLayer || !StatLayer)
 	{
 		return;
 	}
 
-	for (auto& StatPair : Stats)
+	for (auto StatPair : StatLayer->Stats)
 	{
+		const float OldValue = StatPair.Value.CurrentValue;
 		StatPair.Value.CurrentValue = 0.0f;
+
+		if (!FMath::IsNearlyZero(OldValue))
+		{
+			JournalStatChange(StatPair.Key, -OldValue, 0.0f, StatJournalSource::DepleteAll, FGameplayTag());
+		}
 	}
 
+	WakeLayersForStat(EStatType::BodyTemperature);
+
 	UE_LOG(LogTemp, Warning, TEXT("StatSystemPro: All stats depleted to zero"));
 }
 
 void UStatSystemProComponent::UpdateStatLayer(float DeltaTime)
 {
-	if (!bEnableAutoRegeneration)
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_StatLayer);
+
+	if (!bEnableAutoRegeneration || !StatLayer)
 	{
 		return;
 	}
 
-	for (auto& StatPair : Stats)
+	for (auto StatPair : StatLayer->Stats)
 	{
 		FStatValue& Stat = StatPair.Value;
 		float OldValue = Stat.CurrentValue;
@@ -550,7 +1371,7 @@ void UStatSystemProComponent::UpdateStatLayer(float DeltaTime)
 		if (Stat.RegenerationCurve)
 		{
 			float CurrentPercentage = Stat.GetPercentage();
-			float CurveValue = Stat.RegenerationCurve->GetFloatValue(CurrentPercentage);
+			float CurveValue = FStatCurveLUTCache::Get().Evaluate(Stat.RegenerationCurve, CurrentPercentage);
 			RegenerationAmount = CurveValue * DeltaTime;
 		}
 		// Otherwise use flat rate
@@ -564,9 +1385,16 @@ void UStatSystemProComponent::UpdateStatLayer(float DeltaTime)
 			Stat.CurrentValue += RegenerationAmount;
 			Stat.Clamp();
 
-			if (!FMath::IsNearlyEqual(OldValue, Stat.CurrentValue, 0.01f))
+			// Regen moved body temperature away from equilibrium
+			if (StatPair.Key == EStatType::BodyTemperature)
+			{
+				WakeLayer(EStatSystemProLayer::Weather);
+			}
+
+			if (!bFastForwarding && !FMath::IsNearlyEqual(OldValue, Stat.CurrentValue, 0.01f))
 			{
-				OnStatChanged.Broadcast(StatPair.Key, OldValue, Stat.CurrentValue);
+				NotifyStatChanged(StatPair.Key, OldValue, Stat.CurrentValue, StatJournalSource::Regeneration, FGameplayTag());
+				JournalStatChange(StatPair.Key, RegenerationAmount, Stat.CurrentValue, StatJournalSource::Regeneration, FGameplayTag());
 			}
 		}
 	}
@@ -578,11 +1406,12 @@ void UStatSystemProComponent::UpdateStatLayer(float DeltaTime)
 
 void UStatSystemProComponent::InitializeBodyParts()
 {
-	if (!bEnableBodyLayer)
+	if (!bEnableBodyLayer || !BodyLayer)
 	{
 		return;
 	}
 
+	TMap<EBodyPart, FBodyPartState>& BodyParts = BodyLayer->BodyParts;
 	BodyParts.Empty();
 
 	// Initialize all body parts
@@ -590,12 +1419,12 @@ void UStatSystemProComponent::InitializeBodyParts()
 	{
 		EBodyPart BodyPart = (EBodyPart)i;
 		FBodyPartState NewPart;
-		NewPart.Health = 100.0f;
-		NewPart.MaxHealth = 100.0f;
+		NewPart.Condition = 100.0f;
+		NewPart.MaxCondition = 100.0f;
 		NewPart.bFractured = false;
 		NewPart.BleedingRate = 0.0f;
 		NewPart.BurnLevel = EBurnLevel::None;
-		NewPart.InfectionLevel = 0.0f;
+		NewPart.InfectionRate = 0.0f;
 		NewPart.PainLevel = 0.0f;
 
 		BodyParts.Add(BodyPart, NewPart);
@@ -606,16 +1435,18 @@ void UStatSystemProComponent::InitializeBodyParts()
 
 void UStatSystemProComponent::DamageBodyPart(EBodyPart BodyPart, float Damage)
 {
-	if (!bEnableBodyLayer || !BodyParts.Contains(BodyPart))
+	FBodyPartState* PartPtr = bEnableBodyLayer && BodyLayer ? BodyLayer->BodyParts.Find(BodyPart) : nullptr;
+	if (!PartPtr)
 	{
 		return;
 	}
 
-	FBodyPartState& Part = BodyParts[BodyPart];
-	Part.Health = FMath::Max(0.0f, Part.Health - Damage);
+	FBodyPartState& Part = *PartPtr;
+	Part.Condition = FMath::Max(0.0f, Part.Condition - Damage);
 	Part.PainLevel = FMath::Min(100.0f, Part.PainLevel + Damage * 0.5f);
 
-	OnBodyPartDamaged.Broadcast(BodyPart, Damage);
+	TRACE_STATSYSTEMPRO_BODY_PART_DAMAGED(this, BodyPart, Damage, Part.Condition);
+	BodyLayer->OnBodyPartDamaged.Broadcast(BodyPart, Damage);
 
 	// Also damage health stat if enabled
 	if (bEnableStatLayer)
@@ -626,39 +1457,43 @@ void UStatSystemProComponent::DamageBodyPart(EBodyPart BodyPart, float Damage)
 
 void UStatSystemProComponent::FractureLimb(EBodyPart BodyPart)
 {
-	if (!bEnableBodyLayer || !BodyParts.Contains(BodyPart))
+	FBodyPartState* PartPtr = bEnableBodyLayer && BodyLayer ? BodyLayer->BodyParts.Find(BodyPart) : nullptr;
+	if (!PartPtr)
 	{
 		return;
 	}
 
-	FBodyPartState& Part = BodyParts[BodyPart];
+	FBodyPartState& Part = *PartPtr;
 	Part.bFractured = true;
 	Part.PainLevel = FMath::Min(100.0f, Part.PainLevel + 50.0f);
 
-	OnBodyPartFractured.Broadcast(BodyPart);
+	BodyLayer->OnBodyPartFractured.Broadcast(BodyPart);
 }
 
 void UStatSystemProComponent::SetBleedingRate(EBodyPart BodyPart, float Rate)
 {
-	if (!bEnableBodyLayer || !BodyParts.Contains(BodyPart))
+	FBodyPartState* PartPtr = bEnableBodyLayer && BodyLayer ? BodyLayer->BodyParts.Find(BodyPart) : nullptr;
+	if (!PartPtr)
 	{
 		return;
 	}
 
-	FBodyPartState& Part = BodyParts[BodyPart];
+	FBodyPartState& Part = *PartPtr;
 	Part.BleedingRate = FMath::Max(0.0f, Rate);
+	WakeLayer(EStatSystemProLayer::Body);
 
-	OnBodyPartBleeding.Broadcast(BodyPart, Part.BleedingRate);
+	BodyLayer->OnBodyPartBleeding.Broadcast(BodyPart, Part.BleedingRate);
 }
 
 void UStatSystemProComponent::SetBurnLevel(EBodyPart BodyPart, EBurnLevel BurnLevel)
 {
-	if (!bEnableBodyLayer || !BodyParts.Contains(BodyPart))
+	FBodyPartState* PartPtr = bEnableBodyLayer && BodyLayer ? BodyLayer->BodyParts.Find(BodyPart) : nullptr;
+	if (!PartPtr)
 	{
 		return;
 	}
 
-	FBodyPartState& Part = BodyParts[BodyPart];
+	FBodyPartState& Part = *PartPtr;
 	Part.BurnLevel = BurnLevel;
 
 	// Add pain based on burn severity
@@ -677,45 +1512,52 @@ void UStatSystemProComponent::SetBurnLevel(EBodyPart BodyPart, EBurnLevel BurnLe
 		break;
 	}
 
-	OnBodyPartBurned.Broadcast(BodyPart, BurnLevel);
+	BodyLayer->OnBodyPartBurned.Broadcast(BodyPart, BurnLevel);
 }
 
 void UStatSystemProComponent::ApplyInfection(EBodyPart BodyPart, float InfectionAmount)
 {
-	if (!bEnableBodyLayer || !BodyParts.Contains(BodyPart))
+	FBodyPartState* PartPtr = bEnableBodyLayer && BodyLayer ? BodyLayer->BodyParts.Find(BodyPart) : nullptr;
+	if (!PartPtr)
 	{
 		return;
 	}
 
-	FBodyPartState& Part = BodyParts[BodyPart];
-	Part.InfectionLevel = FMath::Clamp(Part.InfectionLevel + InfectionAmount, 0.0f, 100.0f);
+	FBodyPartState& Part = *PartPtr;
+	Part.InfectionRate = FMath::Clamp(Part.InfectionRate + InfectionAmount, 0.0f, 100.0f);
+	WakeLayer(EStatSystemProLayer::Body);
 
-	OnBodyPartInfected.Broadcast(BodyPart, Part.InfectionLevel);
+	BodyLayer->OnBodyPartInfected.Broadcast(BodyPart, Part.InfectionRate);
 }
 
 void UStatSystemProComponent::HealLimb(EBodyPart BodyPart, float HealAmount)
 {
-	if (!bEnableBodyLayer || !BodyParts.Contains(BodyPart))
+	FBodyPartState* PartPtr = bEnableBodyLayer && BodyLayer ? BodyLayer->BodyParts.Find(BodyPart) : nullptr;
+	if (!PartPtr)
 	{
 		return;
 	}
 
-	FBodyPartState& Part = BodyParts[BodyPart];
-	Part.Health = FMath::Min(Part.MaxHealth, Part.Health + HealAmount);
+	FBodyPartState& Part = *PartPtr;
+	Part.Condition = FMath::Min(Part.MaxCondition, Part.Condition + HealAmount);
 	Part.PainLevel = FMath::Max(0.0f, Part.PainLevel - HealAmount * 0.5f);
+
+	// A healed limb can take infection damage again
+	WakeLayer(EStatSystemProLayer::Body);
 }
 
 FBodyPartState UStatSystemProComponent::GetBodyPartState(EBodyPart BodyPart) const
 {
-	if (BodyParts.Contains(BodyPart))
+	if (const FBodyPartState* Part = LayerOrDefault(BodyLayer).BodyParts.Find(BodyPart))
 	{
-		return BodyParts[BodyPart];
+		return *Part;
 	}
 	return FBodyPartState();
 }
 
 float UStatSystemProComponent::GetTotalBodyCondition() const
 {
+	const TMap<EBodyPart, FBodyPartState>& BodyParts = LayerOrDefault(BodyLayer).BodyParts;
 	if (!bEnableBodyLayer || BodyParts.Num() == 0)
 	{
 		return 100.0f;
@@ -724,7 +1566,7 @@ float UStatSystemProComponent::GetTotalBodyCondition() const
 	float TotalHealth = 0.0f;
 	for (const auto& PartPair : BodyParts)
 	{
-		TotalHealth += (PartPair.Value.Health / PartPair.Value.MaxHealth) * 100.0f;
+		TotalHealth += (PartPair.Value.Condition / PartPair.Value.MaxCondition) * 100.0f;
 	}
 
 	return TotalHealth / BodyParts.Num();
@@ -738,7 +1580,7 @@ float UStatSystemProComponent::GetTotalBleedingRate() const
 	}
 
 	float TotalBleeding = 0.0f;
-	for (const auto& PartPair : BodyParts)
+	for (const auto& PartPair : LayerOrDefault(BodyLayer).BodyParts)
 	{
 		TotalBleeding += PartPair.Value.BleedingRate;
 	}
@@ -748,6 +1590,7 @@ float UStatSystemProComponent::GetTotalBleedingRate() const
 
 float UStatSystemProComponent::GetTotalPainLevel() const
 {
+	const TMap<EBodyPart, FBodyPartState>& BodyParts = LayerOrDefault(BodyLayer).BodyParts;
 	if (!bEnableBodyLayer || BodyParts.Num() == 0)
 	{
 		return 0.0f;
@@ -769,13 +1612,13 @@ bool UStatSystemProComponent::HasCriticalInjury() const
 		return false;
 	}
 
-	for (const auto& PartPair : BodyParts)
+	for (const auto& PartPair : LayerOrDefault(BodyLayer).BodyParts)
 	{
 		const FBodyPartState& Part = PartPair.Value;
 
 		// Critical if head/torso heavily damaged
 		if ((PartPair.Key == EBodyPart::Head || PartPair.Key == EBodyPart::Torso) &&
-			(Part.Health / Part.MaxHealth) < 0.3f)
+			(Part.Condition / Part.MaxCondition) < 0.3f)
 		{
 			return true;
 		}
@@ -804,17 +1647,18 @@ FBodyPartEffectMultipliers UStatSystemProComponent::CalculateEffectMultipliers()
 	Multipliers.StaminaRegenMultiplier = 1.0f;
 	Multipliers.PainMultiplier = 1.0f;
 
-	if (!bEnableBodyLayer)
+	if (!bEnableBodyLayer || !BodyLayer)
 	{
 		return Multipliers;
 	}
 
 	// Calculate based on body condition
+	const TMap<EBodyPart, FBodyPartState>& BodyParts = BodyLayer->BodyParts;
 	float LegCondition = 0.0f;
 	if (BodyParts.Contains(EBodyPart::LeftLeg) && BodyParts.Contains(EBodyPart::RightLeg))
 	{
-		LegCondition = ((BodyParts[EBodyPart::LeftLeg].Health / BodyParts[EBodyPart::LeftLeg].MaxHealth) +
-						(BodyParts[EBodyPart::RightLeg].Health / BodyParts[EBodyPart::RightLeg].MaxHealth)) / 2.0f;
+		LegCondition = ((BodyParts[EBodyPart::LeftLeg].Condition / BodyParts[EBodyPart::LeftLeg].MaxCondition) +
+						(BodyParts[EBodyPart::RightLeg].Condition / BodyParts[EBodyPart::RightLeg].MaxCondition)) / 2.0f;
 	}
 
 	Multipliers.MovementSpeedMultiplier = FMath::Clamp(LegCondition, 0.3f, 1.0f);
@@ -822,8 +1666,8 @@ FBodyPartEffectMultipliers UStatSystemProComponent::CalculateEffectMultipliers()
 	float ArmCondition = 0.0f;
 	if (BodyParts.Contains(EBodyPart::LeftArm) && BodyParts.Contains(EBodyPart::RightArm))
 	{
-		ArmCondition = ((BodyParts[EBodyPart::LeftArm].Health / BodyParts[EBodyPart::LeftArm].MaxHealth) +
-						(BodyParts[EBodyPart::RightArm].Health / BodyParts[EBodyPart::RightArm].MaxHealth)) / 2.0f;
+		ArmCondition = ((BodyParts[EBodyPart::LeftArm].Condition / BodyParts[EBodyPart::LeftArm].MaxCondition) +
+						(BodyParts[EBodyPart::RightArm].Condition / BodyParts[EBodyPart::RightArm].MaxCondition)) / 2.0f;
 	}
 
 	Multipliers.AccuracyMultiplier = FMath::Clamp(ArmCondition, 0.2f, 1.0f);
@@ -836,17 +1680,17 @@ FBodyPartEffectMultipliers UStatSystemProComponent::CalculateEffectMultipliers()
 
 void UStatSystemProComponent::HealAllBodyParts()
 {
-	if (!bEnableBodyLayer)
+	if (!bEnableBodyLayer || !BodyLayer)
 	{
 		return;
 	}
 
-	for (auto& PartPair : BodyParts)
+	for (auto& PartPair : BodyLayer->BodyParts)
 	{
-		PartPair.Value.Health = PartPair.Value.MaxHealth;
+		PartPair.Value.Condition = PartPair.Value.MaxCondition;
 		PartPair.Value.PainLevel = 0.0f;
 		PartPair.Value.bFractured = false;
-		PartPair.Value.InfectionLevel = 0.0f;
+		PartPair.Value.InfectionRate = 0.0f;
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("StatSystemPro: All body parts healed"));
@@ -854,12 +1698,12 @@ void UStatSystemProComponent::HealAllBodyParts()
 
 void UStatSystemProComponent::StopAllBleeding()
 {
-	if (!bEnableBodyLayer)
+	if (!bEnableBodyLayer || !BodyLayer)
 	{
 		return;
 	}
 
-	for (auto& PartPair : BodyParts)
+	for (auto& PartPair : BodyLayer->BodyParts)
 	{
 		PartPair.Value.BleedingRate = 0.0f;
 	}
@@ -869,22 +1713,29 @@ void UStatSystemProComponent::StopAllBleeding()
 
 void UStatSystemProComponent::UpdateBodyLayer(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_BodyLayer);
+
+	if (!BodyLayer)
+	{
+		return;
+	}
+
 	UpdateBleeding(DeltaTime);
 
 	// Update infections
-	for (auto& PartPair : BodyParts)
+	for (auto& PartPair : BodyLayer->BodyParts)
 	{
 		FBodyPartState& Part = PartPair.Value;
 
-		if (Part.InfectionLevel > 0.0f)
+		if (Part.InfectionRate > 0.0f)
 		{
 			// Infection spreads slowly
-			Part.InfectionLevel = FMath::Min(100.0f, Part.InfectionLevel + DeltaTime * 0.5f);
+			Part.InfectionRate = StatSurvivalFormulas::GrowInfection(Part.InfectionRate, DeltaTime);
 
 			// Infection causes damage
-			if (Part.InfectionLevel > 50.0f)
+			if (Part.InfectionRate > 50.0f)
 			{
-				Part.Health = FMath::Max(0.0f, Part.Health - DeltaTime * 0.2f);
+				Part.Condition = FMath::Max(0.0f, Part.Condition - DeltaTime * 0.2f);
 			}
 		}
 	}
@@ -897,7 +1748,7 @@ void UStatSystemProComponent::UpdateBleeding(float DeltaTime)
 	if (TotalBleeding > 0.0f && bEnableStatLayer)
 	{
 		// Bleeding drains blood level
-		ApplyStatChange(EStatType::BloodLevel, -TotalBleeding * DeltaTime, TEXT("Bleeding"), FGameplayTag());
+		ApplyStatChange(EStatType::BloodLevel, -StatSurvivalFormulas::BloodLoss(TotalBleeding, DeltaTime), TEXT("Bleeding"), FGameplayTag());
 	}
 }
 
@@ -907,108 +1758,119 @@ void UStatSystemProComponent::UpdateBleeding(float DeltaTime)
 
 void UStatSystemProComponent::SetWeather(EWeatherType NewWeather)
 {
-	if (!bEnableWeatherLayer)
+	if (!bEnableWeatherLayer || !WeatherLayer)
 	{
 		return;
 	}
 
-	EWeatherType OldWeather = CurrentWeather;
-	CurrentWeather = NewWeather;
+	EWeatherType OldWeather = WeatherLayer->CurrentWeather;
+	WeatherLayer->CurrentWeather = NewWeather;
+	WakeLayer(EStatSystemProLayer::Weather);
 
 	if (OldWeather != NewWeather)
 	{
-		OnWeatherChanged.Broadcast(OldWeather, NewWeather);
+		WeatherLayer->OnWeatherChanged.Broadcast(OldWeather, NewWeather);
 	}
 }
 
 void UStatSystemProComponent::SetAmbientTemperature(float Temperature)
 {
-	if (!bEnableWeatherLayer)
+	if (!bEnableWeatherLayer || !WeatherLayer)
 	{
 		return;
 	}
 
-	float OldTemp = AmbientTemperature;
-	AmbientTemperature = Temperature;
+	float OldTemp = WeatherLayer->AmbientTemperature;
+	WeatherLayer->AmbientTemperature = Temperature;
+	WakeLayer(EStatSystemProLayer::Weather);
 
-	if (!FMath::IsNearlyEqual(OldTemp, AmbientTemperature))
+	if (!FMath::IsNearlyEqual(OldTemp, WeatherLayer->AmbientTemperature))
 	{
-		OnTemperatureChanged.Broadcast(OldTemp, AmbientTemperature);
+		WeatherLayer->OnTemperatureChanged.Broadcast(OldTemp, WeatherLayer->AmbientTemperature);
 	}
 }
 
 void UStatSystemProComponent::SetWindSpeed(float Speed)
 {
-	if (!bEnableWeatherLayer)
+	if (!bEnableWeatherLayer || !WeatherLayer)
 	{
 		return;
 	}
 
-	WindSpeed = FMath::Max(0.0f, Speed);
+	WeatherLayer->WindSpeed = FMath::Max(0.0f, Speed);
+	WakeLayer(EStatSystemProLayer::Weather);
 }
 
 void UStatSystemProComponent::SetWetnessLevel(float Wetness)
 {
-	if (!bEnableWeatherLayer)
+	if (!bEnableWeatherLayer || !WeatherLayer)
 	{
 		return;
 	}
 
-	WetnessLevel = FMath::Clamp(Wetness, 0.0f, 100.0f);
+	WeatherLayer->WetnessLevel = FMath::Clamp(Wetness, 0.0f, 100.0f);
+	WakeLayer(EStatSystemProLayer::Weather);
 }
 
 void UStatSystemProComponent::SetShelterLevel(float Shelter)
 {
-	if (!bEnableWeatherLayer)
+	if (!bEnableWeatherLayer || !WeatherLayer)
 	{
 		return;
 	}
 
-	ShelterLevel = FMath::Clamp(Shelter, 0.0f, 100.0f);
+	WeatherLayer->ShelterLevel = FMath::Clamp(Shelter, 0.0f, 100.0f);
+	WakeLayer(EStatSystemProLayer::Weather);
 }
 
 void UStatSystemProComponent::EquipClothing(EClothingSlot Slot, const FClothingItem& Item)
 {
-	if (!bEnableWeatherLayer)
+	if (!bEnableWeatherLayer || !WeatherLayer)
 	{
 		return;
 	}
 
-	EquippedClothing.Add(Slot, Item);
-	OnClothingEquipped.Broadcast(Slot, Item);
+	WeatherLayer->EquippedClothing.Add(Slot, Item);
+	WakeLayer(EStatSystemProLayer::Weather);
+	WeatherLayer->OnClothingEquipped.Broadcast(Slot, Item);
 }
 
 void UStatSystemProComponent::RemoveClothing(EClothingSlot Slot)
 {
-	if (!bEnableWeatherLayer)
+	if (!bEnableWeatherLayer || !WeatherLayer)
 	{
 		return;
 	}
 
-	if (EquippedClothing.Remove(Slot) > 0)
+	if (WeatherLayer->EquippedClothing.Remove(Slot) > 0)
 	{
-		OnClothingRemoved.Broadcast(Slot);
+		WakeLayer(EStatSystemProLayer::Weather);
+		WeatherLayer->OnClothingRemoved.Broadcast(Slot);
 	}
 }
 
 FClothingItem UStatSystemProComponent::GetEquippedClothing(EClothingSlot Slot) const
 {
-	if (EquippedClothing.Contains(Slot))
+	const UStatSystemProWeatherLayer& Weather = LayerOrDefault(WeatherLayer);
+	if (const FClothingItem* Item = Weather.EquippedClothing.Find(Slot))
 	{
-		return EquippedClothing[Slot];
+		return *Item;
 	}
 	return FClothingItem();
 }
 
 FTemperatureResult UStatSystemProComponent::CalculateEffectiveTemperature() const
 {
+	const UStatSystemProWeatherLayer& Weather = LayerOrDefault(WeatherLayer);
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_EffectiveTemperature);
+
 	FTemperatureResult Result;
-	Result.AmbientTemperature = AmbientTemperature;
+	Result.AmbientTemperature = Weather.AmbientTemperature;
 	Result.WindChillAdjustment = CalculateWindChill();
-	Result.WetnessPenalty = -(WetnessLevel / 100.0f) * 10.0f;
-	Result.ClothingProtection = GetTotalClothingInsulation(AmbientTemperature < 15.0f);
-	Result.ShelterBonus = (ShelterLevel / 100.0f) * 5.0f;
-	Result.EffectiveTemperature = AmbientTemperature + Result.WindChillAdjustment +
+	Result.WetnessPenalty = -(Weather.WetnessLevel / 100.0f) * 10.0f;
+	Result.ClothingProtection = GetTotalClothingInsulation(Weather.AmbientTemperature < 15.0f);
+	Result.ShelterBonus = (Weather.ShelterLevel / 100.0f) * 5.0f;
+	Result.EffectiveTemperature = Weather.AmbientTemperature + Result.WindChillAdjustment +
 								   Result.WetnessPenalty + Result.ClothingProtection +
 								   Result.ShelterBonus;
 
@@ -1017,7 +1879,7 @@ FTemperatureResult UStatSystemProComponent::CalculateEffectiveTemperature() cons
 
 void UStatSystemProComponent::ApplyWeatherPreset(const FWeatherPreset& Preset)
 {
-	if (!bEnableWeatherLayer)
+	if (!bEnableWeatherLayer || !WeatherLayer)
 	{
 		return;
 	}
@@ -1033,6 +1895,13 @@ void UStatSystemProComponent::ApplyWeatherPreset(const FWeatherPreset& Preset)
 
 void UStatSystemProComponent::UpdateWeatherLayer(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_WeatherLayer);
+
+	if (!WeatherLayer)
+	{
+		return;
+	}
+
 	// Calculate effective temperature
 	FTemperatureResult TempResult = CalculateEffectiveTemperature();
 	UpdateTemperatureStages(TempResult.EffectiveTemperature);
@@ -1043,15 +1912,15 @@ void UStatSystemProComponent::UpdateWeatherLayer(float DeltaTime)
 		float TargetBodyTemp = 37.0f; // Normal
 		float CurrentBodyTemp = GetStatValue(EStatType::BodyTemperature);
 
-		// Move body temp towards ambient
-		float TempDiff = TempResult.EffectiveTemperature - CurrentBodyTemp;
-		float TempChange = TempDiff * DeltaTime * 0.1f; // Gradual change
+		// Move body temp towards ambient (exact exponential approach, so long steps don't overshoot)
+		float TempChange = StatSurvivalFormulas::ApproachTemperature(CurrentBodyTemp, TempResult.EffectiveTemperature,
+			StatSurvivalFormulas::BodyTemperatureResponse, DeltaTime);
 
 		ApplyStatChange(EStatType::BodyTemperature, TempChange, TEXT("Weather"), FGameplayTag());
 	}
 
 	// Apply freezing/overheating damage
-	switch (CurrentFreezingStage)
+	switch (WeatherLayer->CurrentFreezingStage)
 	{
 	case EFreezingStage::Cold:
 		// Minor discomfort, no damage
@@ -1084,7 +1953,7 @@ void UStatSystemProComponent::UpdateWeatherLayer(float DeltaTime)
 		break;
 	}
 
-	switch (CurrentOverheatingStage)
+	switch (WeatherLayer->CurrentOverheatingStage)
 	{
 	case EOverheatingStage::Warm:
 		// Minor discomfort
@@ -1121,90 +1990,99 @@ void UStatSystemProComponent::UpdateWeatherLayer(float DeltaTime)
 
 void UStatSystemProComponent::UpdateTemperatureStages(float EffectiveTemp)
 {
-	EFreezingStage OldFreezingStage = CurrentFreezingStage;
-	EOverheatingStage OldOverheatingStage = CurrentOverheatingStage;
+	EFreezingStage OldFreezingStage = WeatherLayer->CurrentFreezingStage;
+	EOverheatingStage OldOverheatingStage = WeatherLayer->CurrentOverheatingStage;
 
 	// Determine freezing stage
 	if (EffectiveTemp < -20.0f)
 	{
-		CurrentFreezingStage = EFreezingStage::Hypothermia;
+		WeatherLayer->CurrentFreezingStage = EFreezingStage::Hypothermia;
 	}
 	else if (EffectiveTemp < -10.0f)
 	{
-		CurrentFreezingStage = EFreezingStage::Frostbite;
+		WeatherLayer->CurrentFreezingStage = EFreezingStage::Frostbite;
 	}
 	else if (EffectiveTemp < 0.0f)
 	{
-		CurrentFreezingStage = EFreezingStage::Freezing;
+		WeatherLayer->CurrentFreezingStage = EFreezingStage::Freezing;
 	}
 	else if (EffectiveTemp < 10.0f)
 	{
-		CurrentFreezingStage = EFreezingStage::VeryCold;
+		WeatherLayer->CurrentFreezingStage = EFreezingStage::VeryCold;
 	}
 	else if (EffectiveTemp < 15.0f)
 	{
-		CurrentFreezingStage = EFreezingStage::Cold;
+		WeatherLayer->CurrentFreezingStage = EFreezingStage::Cold;
 	}
 	else
 	{
-		CurrentFreezingStage = EFreezingStage::None;
+		WeatherLayer->CurrentFreezingStage = EFreezingStage::None;
 	}
 
 	// Determine overheating stage
 	if (EffectiveTemp > 45.0f)
 	{
-		CurrentOverheatingStage = EOverheatingStage::Heatstroke;
+		WeatherLayer->CurrentOverheatingStage = EOverheatingStage::Heatstroke;
 	}
 	else if (EffectiveTemp > 40.0f)
 	{
-		CurrentOverheatingStage = EOverheatingStage::Overheating;
+		WeatherLayer->CurrentOverheatingStage = EOverheatingStage::Overheating;
 	}
 	else if (EffectiveTemp > 35.0f)
 	{
-		CurrentOverheatingStage = EOverheatingStage::VeryHot;
+		WeatherLayer->CurrentOverheatingStage = EOverheatingStage::VeryHot;
 	}
 	else if (EffectiveTemp > 30.0f)
 	{
-		CurrentOverheatingStage = EOverheatingStage::Hot;
+		WeatherLayer->CurrentOverheatingStage = EOverheatingStage::Hot;
 	}
 	else if (EffectiveTemp > 25.0f)
 	{
-		CurrentOverheatingStage = EOverheatingStage::Warm;
+		WeatherLayer->CurrentOverheatingStage = EOverheatingStage::Warm;
 	}
 	else
 	{
-		CurrentOverheatingStage = EOverheatingStage::None;
+		WeatherLayer->CurrentOverheatingStage = EOverheatingStage::None;
+	}
+
+	// Broadcast events if changed (once at the end when fast-forwarding)
+	if (bFastForwarding)
+	{
+		return;
 	}
 
-	// Broadcast events if changed
-	if (OldFreezingStage != CurrentFreezingStage)
+	if (OldFreezingStage != WeatherLayer->CurrentFreezingStage)
 	{
-		OnFreezingStageChanged.Broadcast(CurrentFreezingStage);
+		TRACE_STATSYSTEMPRO_TEMPERATURE_STAGE(this, EStatSystemProTraceTemperature::Freezing, OldFreezingStage, WeatherLayer->CurrentFreezingStage, GetStatValue(EStatType::BodyTemperature));
+		WeatherLayer->OnFreezingStageChanged.Broadcast(WeatherLayer->CurrentFreezingStage);
 	}
 
-	if (OldOverheatingStage != CurrentOverheatingStage)
+	if (OldOverheatingStage != WeatherLayer->CurrentOverheatingStage)
 	{
-		OnOverheatingStageChanged.Broadcast(CurrentOverheatingStage);
+		TRACE_STATSYSTEMPRO_TEMPERATURE_STAGE(this, EStatSystemProTraceTemperature::Overheating, OldOverheatingStage, WeatherLayer->CurrentOverheatingStage, GetStatValue(EStatType::BodyTemperature));
+		WeatherLayer->OnOverheatingStageChanged.Broadcast(WeatherLayer->CurrentOverheatingStage);
 	}
 }
 
 float UStatSystemProComponent::CalculateWindChill() const
 {
-	if (WindSpeed < 5.0f || AmbientTemperature > 10.0f)
+	const UStatSystemProWeatherLayer& Weather = LayerOrDefault(WeatherLayer);
+	if (Weather.WindSpeed < 5.0f || Weather.AmbientTemperature > 10.0f)
 	{
 		return 0.0f; // No wind chill in warm temps or calm conditions
 	}
 
 	// Simplified wind chill calculation
-	float WindChillEffect = -0.5f * FMath::Sqrt(WindSpeed);
+	float WindChillEffect = -0.5f * FMath::Sqrt(Weather.WindSpeed);
 	return WindChillEffect;
 }
 
 float UStatSystemProComponent::GetTotalClothingInsulation(bool bForCold) const
 {
+	const UStatSystemProWeatherLayer& Weather = LayerOrDefault(WeatherLayer);
 	float TotalInsulation = 0.0f;
 
-	for (const auto& ClothingPair : EquippedClothing)
+	for (const auto& ClothingPair : Weather.EquippedClothing)
 	{
 		const FClothingItem& Item = ClothingPair.Value;
 		float Effectiveness = 1.0f - (Item.CurrentWetness * 0.7f); // Wet clothing loses 70% effectiveness
@@ -1228,45 +2106,50 @@ float UStatSystemProComponent::GetTotalClothingInsulation(bool bForCold) const
 
 void UStatSystemProComponent::ApplyStatusEffect(FName EffectID, int32 Stacks)
 {
-	if (!bEnableStatusEffectLayer)
+	if (!bEnableStatusEffectLayer || !StatusEffectLayer)
 	{
 		return;
 	}
 
 	// Check if effect already exists
-	for (FActiveStatusEffect& Effect : ActiveEffects)
+	for (FActiveStatusEffect& Effect : StatusEffectLayer->ActiveEffects)
 	{
-		if (Effect.EffectID == EffectID)
+		if (Effect.EffectData.EffectID == EffectID)
 		{
-			Effect.Stacks += Stacks;
-			OnStatusEffectApplied.Broadcast(EffectID, Effect.Stacks);
+			Effect.CurrentStacks += Stacks;
+			WakeLayer(EStatSystemProLayer::StatusEffect);
+			TRACE_STATSYSTEMPRO_EFFECT_APPLIED(this, EffectID, Effect.CurrentStacks);
+			StatusEffectLayer->OnStatusEffectApplied.Broadcast(EffectID, Effect.CurrentStacks);
 			return;
 		}
 	}
 
 	// Add new effect
 	FActiveStatusEffect NewEffect;
-	NewEffect.EffectID = EffectID;
-	NewEffect.Stacks = Stacks;
-	NewEffect.RemainingDuration = 0.0f; // Set by definition
+	NewEffect.EffectData.EffectID = EffectID;
+	NewEffect.CurrentStacks = Stacks;
+	NewEffect.TimeRemaining = 0.0f; // Set by definition
 
-	ActiveEffects.Add(NewEffect);
-	OnStatusEffectApplied.Broadcast(EffectID, Stacks);
+	StatusEffectLayer->ActiveEffects.Add(NewEffect);
+	WakeLayer(EStatSystemProLayer::StatusEffect);
+	TRACE_STATSYSTEMPRO_EFFECT_APPLIED(this, EffectID, Stacks);
+	StatusEffectLayer->OnStatusEffectApplied.Broadcast(EffectID, Stacks);
 }
 
 void UStatSystemProComponent::RemoveEffect(FName EffectID)
 {
-	if (!bEnableStatusEffectLayer)
+	if (!bEnableStatusEffectLayer || !StatusEffectLayer)
 	{
 		return;
 	}
 
-	for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
+	for (int32 i = StatusEffectLayer->ActiveEffects.Num() - 1; i >= 0; --i)
 	{
-		if (ActiveEffects[i].EffectID == EffectID)
+		if (StatusEffectLayer->ActiveEffects[i].EffectData.EffectID == EffectID)
 		{
-			ActiveEffects.RemoveAt(i);
-			OnStatusEffectRemoved.Broadcast(EffectID);
+			StatusEffectLayer->ActiveEffects.RemoveAt(i);
+			TRACE_STATSYSTEMPRO_EFFECT_REMOVED(this, EffectID, false);
+			StatusEffectLayer->OnStatusEffectRemoved.Broadcast(EffectID);
 			break;
 		}
 	}
@@ -1274,9 +2157,9 @@ void UStatSystemProComponent::RemoveEffect(FName EffectID)
 
 bool UStatSystemProComponent::HasStatusEffect(FName EffectID) const
 {
-	for (const FActiveStatusEffect& Effect : ActiveEffects)
+	for (const FActiveStatusEffect& Effect : LayerOrDefault(StatusEffectLayer).ActiveEffects)
 	{
-		if (Effect.EffectID == EffectID)
+		if (Effect.EffectData.EffectID == EffectID)
 		{
 			return true;
 		}
@@ -1286,11 +2169,11 @@ bool UStatSystemProComponent::HasStatusEffect(FName EffectID) const
 
 int32 UStatSystemProComponent::GetStatusEffectStacks(FName EffectID) const
 {
-	for (const FActiveStatusEffect& Effect : ActiveEffects)
+	for (const FActiveStatusEffect& Effect : LayerOrDefault(StatusEffectLayer).ActiveEffects)
 	{
-		if (Effect.EffectID == EffectID)
+		if (Effect.EffectData.EffectID == EffectID)
 		{
-			return Effect.Stacks;
+			return Effect.CurrentStacks;
 		}
 	}
 	return 0;
@@ -1298,36 +2181,44 @@ int32 UStatSystemProComponent::GetStatusEffectStacks(FName EffectID) const
 
 void UStatSystemProComponent::ClearAllStatusEffects()
 {
-	if (!bEnableStatusEffectLayer)
+	if (!bEnableStatusEffectLayer || !StatusEffectLayer)
 	{
 		return;
 	}
 
-	ActiveEffects.Empty();
+	StatusEffectLayer->ActiveEffects.Empty();
 	UE_LOG(LogTemp, Log, TEXT("StatSystemPro: All status effects cleared"));
 }
 
 void UStatSystemProComponent::UpdateStatusEffectLayer(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_StatusEffectLayer);
+
 	// Update effect durations
 	UpdateStatusEffectDurations(DeltaTime);
 }
 
 void UStatSystemProComponent::UpdateStatusEffectDurations(float DeltaTime)
 {
-	for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
+	if (!StatusEffectLayer)
+	{
+		return;
+	}
+
+	for (int32 i = StatusEffectLayer->ActiveEffects.Num() - 1; i >= 0; --i)
 	{
-		FActiveStatusEffect& Effect = ActiveEffects[i];
+		FActiveStatusEffect& Effect = StatusEffectLayer->ActiveEffects[i];
 
-		if (Effect.RemainingDuration > 0.0f)
+		if (Effect.TimeRemaining > 0.0f)
 		{
-			Effect.RemainingDuration -= DeltaTime;
+			Effect.TimeRemaining -= DeltaTime;
 
-			if (Effect.RemainingDuration <= 0.0f)
+			if (Effect.TimeRemaining <= 0.0f)
 			{
 				// Effect expired
-				OnStatusEffectExpired.Broadcast(Effect.EffectID, Effect.Stacks);
-				ActiveEffects.RemoveAt(i);
+				TRACE_STATSYSTEMPRO_EFFECT_REMOVED(this, Effect.EffectData.EffectID, true);
+				StatusEffectLayer->OnStatusEffectExpired.Broadcast(Effect.EffectData.EffectID, Effect.CurrentStacks);
+				StatusEffectLayer->ActiveEffects.RemoveAt(i);
 			}
 		}
 	}
@@ -1339,27 +2230,27 @@ void UStatSystemProComponent::UpdateStatusEffectDurations(float DeltaTime)
 
 void UStatSystemProComponent::AwardXP(int32 Amount, EXPSource Source)
 {
-	if (!bEnableProgressionLayer)
+	if (!bEnableProgressionLayer || !ProgressionLayer)
 	{
 		return;
 	}
 
-	int32 OldXP = CurrentXP;
-	CurrentXP += Amount;
+	int32 OldXP = ProgressionLayer->CurrentXP;
+	ProgressionLayer->CurrentXP += Amount;
 
-	OnXPGained.Broadcast(Amount, CurrentXP, Source);
+	ProgressionLayer->OnXPGained.Broadcast(Amount, ProgressionLayer->CurrentXP, Source);
 
 	// Check for level up
 	int32 RequiredXP = GetXPForNextLevel();
-	while (CurrentXP >= RequiredXP && CurrentLevel < 100)
+	while (ProgressionLayer->CurrentXP >= RequiredXP && ProgressionLayer->CurrentLevel < 100)
 	{
-		CurrentXP -= RequiredXP;
-		int32 OldLevel = CurrentLevel;
-		CurrentLevel++;
-		StatPoints += 5; // Award 5 stat points per level
+		ProgressionLayer->CurrentXP -= RequiredXP;
+		int32 OldLevel = ProgressionLayer->CurrentLevel;
+		ProgressionLayer->CurrentLevel++;
+		ProgressionLayer->StatPoints += 5; // Award 5 stat points per level
 
-		OnLevelUp.Broadcast(OldLevel, CurrentLevel);
-		OnStatPointsAwarded.Broadcast(5, StatPoints);
+		ProgressionLayer->OnLevelUp.Broadcast(OldLevel, ProgressionLayer->CurrentLevel);
+		ProgressionLayer->OnStatPointsAwarded.Broadcast(5, ProgressionLayer->StatPoints);
 
 		RequiredXP = GetXPForNextLevel();
 	}
@@ -1367,41 +2258,42 @@ void UStatSystemProComponent::AwardXP(int32 Amount, EXPSource Source)
 
 void UStatSystemProComponent::SetLevel(int32 NewLevel)
 {
-	if (!bEnableProgressionLayer)
+	if (!bEnableProgressionLayer || !ProgressionLayer)
 	{
 		return;
 	}
 
-	int32 OldLevel = CurrentLevel;
-	CurrentLevel = FMath::Clamp(NewLevel, 1, 100);
+	int32 OldLevel = ProgressionLayer->CurrentLevel;
+	ProgressionLayer->CurrentLevel = FMath::Clamp(NewLevel, 1, 100);
 
-	if (OldLevel != CurrentLevel)
+	if (OldLevel != ProgressionLayer->CurrentLevel)
 	{
-		OnLevelUp.Broadcast(OldLevel, CurrentLevel);
+		ProgressionLayer->OnLevelUp.Broadcast(OldLevel, ProgressionLayer->CurrentLevel);
 	}
 }
 
 void UStatSystemProComponent::UnlockSkill(FName SkillID)
 {
-	if (!bEnableProgressionLayer)
+	if (!bEnableProgressionLayer || !ProgressionLayer)
 	{
 		return;
 	}
 
-	if (!UnlockedSkills.Contains(SkillID))
+	if (!ProgressionLayer->UnlockedSkills.Contains(SkillID))
 	{
-		UnlockedSkills.Add(SkillID);
-		OnSkillUnlocked.Broadcast(SkillID);
+		ProgressionLayer->UnlockedSkills.Add(SkillID);
+		ProgressionLayer->OnSkillUnlocked.Broadcast(SkillID);
 	}
 }
 
 bool UStatSystemProComponent::IsSkillUnlocked(FName SkillID) const
 {
-	return UnlockedSkills.Contains(SkillID);
+	return LayerOrDefault(ProgressionLayer).UnlockedSkills.Contains(SkillID);
 }
 
 int32 UStatSystemProComponent::GetXPForNextLevel() const
 {
+	const int32 CurrentLevel = GetCurrentLevel();
 	if (XPCurve)
 	{
 		return FMath::RoundToInt(XPCurve->GetFloatValue(CurrentLevel));
@@ -1416,24 +2308,26 @@ float UStatSystemProComponent::GetLevelProgress() const
 	int32 RequiredXP = GetXPForNextLevel();
 	if (RequiredXP > 0)
 	{
-		return (float)CurrentXP / (float)RequiredXP;
+		return (float)GetCurrentXP() / (float)RequiredXP;
 	}
 	return 0.0f;
 }
 
 void UStatSystemProComponent::SpendStatPoint(EStatType StatType, float Amount)
 {
-	if (!bEnableProgressionLayer || !bEnableStatLayer || StatPoints <= 0)
+	if (!bEnableProgressionLayer || !ProgressionLayer || !bEnableStatLayer || ProgressionLayer->StatPoints <= 0)
 	{
 		return;
 	}
 
-	StatPoints--;
+	ProgressionLayer->StatPoints--;
 	SetStatMaxValue(StatType, GetStatMaxValue(StatType) + Amount);
 }
 
 void UStatSystemProComponent::UpdateProgressionLayer(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_ProgressionLayer);
+
 	// Passive XP or other progression logic can go here
 }
 
@@ -1449,43 +2343,44 @@ void UStatSystemProComponent::SetTimeMultiplier(float Multiplier)
 	}
 
 	TimeMultiplier = FMath::Clamp(Multiplier, 0.0f, 100.0f);
+	WakeLayer(EStatSystemProLayer::Time);
 }
 
 void UStatSystemProComponent::SetCurrentTime(int32 Hour, int32 Day)
 {
-	if (!bEnableTimeLayer)
+	if (!bEnableTimeLayer || !TimeLayer)
 	{
 		return;
 	}
 
-	int32 OldHour = CurrentHour;
-	int32 OldDay = CurrentDay;
+	int32 OldHour = TimeLayer->CurrentHour;
+	int32 OldDay = TimeLayer->CurrentDay;
 
-	CurrentHour = FMath::Clamp(Hour, 0, 23);
-	CurrentDay = FMath::Max(1, Day);
+	TimeLayer->CurrentHour = FMath::Clamp(Hour, 0, 23);
+	TimeLayer->CurrentDay = FMath::Max(1, Day);
 
-	if (OldHour != CurrentHour)
+	if (OldHour != TimeLayer->CurrentHour)
 	{
-		OnHourChanged.Broadcast(CurrentHour);
+		TimeLayer->OnHourChanged.Broadcast(TimeLayer->CurrentHour);
 		UpdateTimeOfDay();
 	}
 
-	if (OldDay != CurrentDay)
+	if (OldDay != TimeLayer->CurrentDay)
 	{
-		OnDayChanged.Broadcast(CurrentDay);
+		TimeLayer->OnDayChanged.Broadcast(TimeLayer->CurrentDay);
 	}
 }
 
 void UStatSystemProComponent::AdvanceTime(float Hours)
 {
-	if (!bEnableTimeLayer)
+	if (!bEnableTimeLayer || !TimeLayer)
 	{
 		return;
 	}
 
-	CurrentGameTime += Hours * 3600.0f; // Convert to seconds
+	TimeLayer->CurrentGameTime += Hours * 3600.0f; // Convert to seconds
 
-	int32 TotalHours = FMath::FloorToInt(CurrentGameTime / 3600.0f);
+	int32 TotalHours = FMath::FloorToInt(TimeLayer->CurrentGameTime / 3600.0f);
 	int32 NewHour = TotalHours % 24;
 	int32 NewDay = (TotalHours / 24) + 1;
 
@@ -1494,37 +2389,221 @@ void UStatSystemProComponent::AdvanceTime(float Hours)
 
 FString UStatSystemProComponent::GetFormattedTime() const
 {
-	return FString::Printf(TEXT("Day %d, %02d:00"), CurrentDay, CurrentHour);
+	return FString::Printf(TEXT("Day %d, %02d:00"), GetCurrentDay(), GetCurrentHour());
+}
+
+namespace StatFastForward
+{
+	/** Longest step - bounds the error where regen and drains meet a clamp in the same step */
+	static constexpr float MaxStep = 10.0f;
+
+	/** Longest step for curve regen (its rate depends on the value it changes) */
+	static constexpr float CurveStep = 2.0f;
+
+	/** Shortest step, so boundary-hugging values can't stall the loop */
+	static constexpr float MinStep = 0.1f;
+
+	/** Limb infection above this damages limb health */
+	static constexpr float InfectionDamageLevel = 50.0f;
+}
+
+void UStatSystemProComponent::FastForward(FTimespan Duration)
+{
+	// Only server simulates
+	if (GetOwnerRole() != ROLE_Authority || bFastForwarding)
+	{
+		return;
+	}
+
+	const double TotalSeconds = Duration.GetTotalSeconds();
+	if (TotalSeconds <= 0.0)
+	{
+		return;
+	}
+
+	// Snapshot for the consolidated events (the class defaults hold no stats, so without a stat layer there are none)
+	const FStatContainer& Stats = LayerOrDefault(StatLayer).Stats;
+	float StartValues[FStatContainer::Capacity];
+	for (const auto& StatPair : Stats)
+	{
+		StartValues[(int32)StatPair.Key] = StatPair.Value.CurrentValue;
+	}
+	const uint32 StartPresence = Stats.GetPresenceMask();
+	const EFreezingStage StartFreezingStage = GetFreezingStage();
+	const EOverheatingStage StartOverheatingStage = GetOverheatingStage();
+
+	bFastForwarding = true;
+
+	// Every rate is constant between steps except curve regen and the infection damage threshold,
+	// so steps only shrink around those
+	double RemainingSeconds = TotalSeconds;
+	int32 NumSteps = 0;
+	while (RemainingSeconds > KINDA_SMALL_NUMBER)
+	{
+		const float Step = FMath::Min((float)RemainingSeconds, GetFastForwardStep(StatFastForward::MaxStep));
+
+		if (bEnableStatLayer)
+		{
+			UpdateStatLayer(Step);
+		}
+
+		if (bEnableBodyLayer)
+		{
+			UpdateBodyLayer(Step);
+		}
+
+		if (bEnableWeatherLayer)
+		{
+			UpdateWeatherLayer(Step);
+		}
+
+		if (bEnableStatusEffectLayer)
+		{
+			UpdateStatusEffectLayer(Step);
+		}
+
+		if (bEnableProgressionLayer)
+		{
+			UpdateProgressionLayer(Step);
+		}
+
+		RemainingSeconds -= Step;
+		++NumSteps;
+	}
+
+	bFastForwarding = false;
+
+	// The clock advances once, so hour/day/time-of-day events fire for the final time only
+	if (bEnableTimeLayer)
+	{
+		UpdateTimeLayer((float)TotalSeconds);
+	}
+
+	// One change event per stat, plus the states it ended up in
+	for (const auto& StatPair : Stats)
+	{
+		const EStatType StatType = StatPair.Key;
+		const FStatValue& Stat = StatPair.Value;
+		const float OldValue = (StartPresence & (1u << (uint32)StatType)) ? StartValues[(int32)StatType] : 0.0f;
+		if (FMath::IsNearlyEqual(OldValue, Stat.CurrentValue))
+		{
+			continue;
+		}
+
+		NotifyStatChanged(StatType, OldValue, Stat.CurrentValue, TEXT("FastForward"), FGameplayTag());
+
+		if (Stat.IsAtZero() && !FMath::IsNearlyZero(OldValue))
+		{
+			StatLayer->OnStatReachedZero.Broadcast(StatType);
+			NativeStatEvents.Broadcast(StatType, EStatEventKind::ReachedZero, Stat.CurrentValue, Stat.CurrentValue);
+		}
+
+		if (Stat.IsAtMax() && !FMath::IsNearlyEqual(OldValue, Stat.MaxValue))
+		{
+			StatLayer->OnStatReachedMax.Broadcast(StatType);
+			NativeStatEvents.Broadcast(StatType, EStatEventKind::ReachedMax, Stat.CurrentValue, Stat.CurrentValue);
+		}
+
+		if (Stat.GetPercentage() < CriticalThreshold && OldValue >= Stat.MaxValue * CriticalThreshold)
+		{
+			StatLayer->OnStatCritical.Broadcast(StatType, Stat.CurrentValue);
+			NativeStatEvents.Broadcast(StatType, EStatEventKind::Critical, Stat.CurrentValue, Stat.CurrentValue);
+		}
+	}
+
+	// Stages only change on an existing weather layer
+	if (WeatherLayer && StartFreezingStage != WeatherLayer->CurrentFreezingStage)
+	{
+		TRACE_STATSYSTEMPRO_TEMPERATURE_STAGE(this, EStatSystemProTraceTemperature::Freezing, StartFreezingStage, WeatherLayer->CurrentFreezingStage, GetStatValue(EStatType::BodyTemperature));
+		WeatherLayer->OnFreezingStageChanged.Broadcast(WeatherLayer->CurrentFreezingStage);
+	}
+
+	if (WeatherLayer && StartOverheatingStage != WeatherLayer->CurrentOverheatingStage)
+	{
+		TRACE_STATSYSTEMPRO_TEMPERATURE_STAGE(this, EStatSystemProTraceTemperature::Overheating, StartOverheatingStage, WeatherLayer->CurrentOverheatingStage, GetStatValue(EStatType::BodyTemperature));
+		WeatherLayer->OnOverheatingStageChanged.Broadcast(WeatherLayer->CurrentOverheatingStage);
+	}
+
+	// Layers stepped above may have finished (or started) their work
+	RefreshDormancy();
+
+	UE_LOG(LogTemp, Log, TEXT("StatSystemPro: Fast-forwarded %.0f seconds in %d steps"), TotalSeconds, NumSteps);
+}
+
+float UStatSystemProComponent::GetFastForwardStep(float MaxStep) const
+{
+	float Step = MaxStep;
+
+	// Curve regen depends on the percentage it changes
+	if (bEnableStatLayer && bEnableAutoRegeneration)
+	{
+		for (const auto& StatPair : LayerOrDefault(StatLayer).Stats)
+		{
+			if (StatPair.Value.RegenerationCurve)
+			{
+				Step = FMath::Min(Step, StatFastForward::CurveStep);
+				break;
+			}
+		}
+	}
+
+	// Stop at the moment a limb's infection starts damaging it
+	if (bEnableBodyLayer)
+	{
+		for (const auto& PartPair : LayerOrDefault(BodyLayer).BodyParts)
+		{
+			const float InfectionLevel = PartPair.Value.InfectionRate;
+			if (InfectionLevel > 0.0f && InfectionLevel < StatFastForward::InfectionDamageLevel)
+			{
+				Step = FMath::Min(Step, (StatFastForward::InfectionDamageLevel - InfectionLevel) / StatSurvivalFormulas::InfectionGrowthRate);
+			}
+		}
+	}
+
+	return FMath::Max(Step, StatFastForward::MinStep);
 }
 
 void UStatSystemProComponent::UpdateTimeLayer(float DeltaTime)
 {
-	CurrentGameTime += DeltaTime * TimeMultiplier;
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_TimeLayer);
+
+	if (!TimeLayer)
+	{
+		return;
+	}
 
-	int32 TotalHours = FMath::FloorToInt(CurrentGameTime / 3600.0f);
+	TimeLayer->CurrentGameTime += DeltaTime * TimeMultiplier;
+
+	int32 TotalHours = FMath::FloorToInt(TimeLayer->CurrentGameTime / 3600.0f);
 	int32 NewHour = TotalHours % 24;
 	int32 NewDay = (TotalHours / 24) + 1;
 
 	// Check for hour change
-	if (NewHour != CurrentHour)
+	if (NewHour != TimeLayer->CurrentHour)
 	{
-		CurrentHour = NewHour;
-		OnHourChanged.Broadcast(CurrentHour);
+		TimeLayer->CurrentHour = NewHour;
+		TimeLayer->OnHourChanged.Broadcast(TimeLayer->CurrentHour);
 		UpdateTimeOfDay();
 	}
 
 	// Check for day change
-	if (NewDay != CurrentDay)
+	if (NewDay != TimeLayer->CurrentDay)
 	{
-		CurrentDay = NewDay;
-		OnDayChanged.Broadcast(CurrentDay);
+		TimeLayer->CurrentDay = NewDay;
+		TimeLayer->OnDayChanged.Broadcast(TimeLayer->CurrentDay);
 	}
 }
 
 void UStatSystemProComponent::UpdateTimeOfDay()
 {
-	ETimeOfDay OldTimeOfDay = CurrentTimeOfDay;
-	ETimeOfDay NewTimeOfDay = CurrentTimeOfDay;
+	if (!TimeLayer)
+	{
+		return;
+	}
+
+	const int32 CurrentHour = TimeLayer->CurrentHour;
+	ETimeOfDay OldTimeOfDay = TimeLayer->CurrentTimeOfDay;
+	ETimeOfDay NewTimeOfDay = TimeLayer->CurrentTimeOfDay;
 
 	if (CurrentHour >= 5 && CurrentHour < 12)
 	{
@@ -1545,8 +2624,8 @@ void UStatSystemProComponent::UpdateTimeOfDay()
 
 	if (OldTimeOfDay != NewTimeOfDay)
 	{
-		CurrentTimeOfDay = NewTimeOfDay;
-		OnTimeOfDayChanged.Broadcast(OldTimeOfDay, NewTimeOfDay);
+		TimeLayer->CurrentTimeOfDay = NewTimeOfDay;
+		TimeLayer->OnTimeOfDayChanged.Broadcast(OldTimeOfDay, NewTimeOfDay);
 	}
 }
 
@@ -1556,6 +2635,8 @@ void UStatSystemProComponent::UpdateTimeOfDay()
 
 bool UStatSystemProComponent::QuickSave(const FString& SlotName)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_Save);
+
 	UStatSystemProSaveGame* SaveGameInstance = Cast<UStatSystemProSaveGame>(
 		UGameplayStatics::CreateSaveGameObject(UStatSystemProSaveGame::StaticClass()));
 
@@ -1574,49 +2655,49 @@ bool UStatSystemProComponent::QuickSave(const FString& SlotName)
 	SaveGameInstance->bEnableTimeLayer = bEnableTimeLayer;
 
 	// Save Stat Layer
-	if (bEnableStatLayer)
+	if (bEnableStatLayer && StatLayer)
 	{
-		SaveGameInstance->Stats = Stats;
+		SaveGameInstance->Stats = StatLayer->Stats.ToMap();
 	}
 
 	// Save Body Layer
-	if (bEnableBodyLayer)
+	if (bEnableBodyLayer && BodyLayer)
 	{
-		SaveGameInstance->BodyParts = BodyParts;
+		SaveGameInstance->BodyParts = BodyLayer->BodyParts;
 	}
 
 	// Save Weather Layer
-	if (bEnableWeatherLayer)
+	if (bEnableWeatherLayer && WeatherLayer)
 	{
-		SaveGameInstance->CurrentWeather = CurrentWeather;
-		SaveGameInstance->AmbientTemperature = AmbientTemperature;
-		SaveGameInstance->WindSpeed = WindSpeed;
-		SaveGameInstance->WetnessLevel = WetnessLevel;
-		SaveGameInstance->ShelterLevel = ShelterLevel;
-		SaveGameInstance->EquippedClothing = EquippedClothing;
+		SaveGameInstance->CurrentWeather = WeatherLayer->CurrentWeather;
+		SaveGameInstance->AmbientTemperature = WeatherLayer->AmbientTemperature;
+		SaveGameInstance->WindSpeed = WeatherLayer->WindSpeed;
+		SaveGameInstance->WetnessLevel = WeatherLayer->WetnessLevel;
+		SaveGameInstance->ShelterLevel = WeatherLayer->ShelterLevel;
+		SaveGameInstance->EquippedClothing = WeatherLayer->EquippedClothing;
 	}
 
 	// Save Status Effect Layer
-	if (bEnableStatusEffectLayer)
+	if (bEnableStatusEffectLayer && StatusEffectLayer)
 	{
-		SaveGameInstance->ActiveEffects = ActiveEffects;
+		SaveGameInstance->ActiveEffects = StatusEffectLayer->ActiveEffects;
 	}
 
 	// Save Progression Layer
-	if (bEnableProgressionLayer)
+	if (bEnableProgressionLayer && ProgressionLayer)
 	{
-		SaveGameInstance->CurrentLevel = CurrentLevel;
-		SaveGameInstance->CurrentXP = CurrentXP;
-		SaveGameInstance->StatPoints = StatPoints;
-		SaveGameInstance->UnlockedSkills = UnlockedSkills;
+		SaveGameInstance->CurrentLevel = ProgressionLayer->CurrentLevel;
+		SaveGameInstance->CurrentXP = ProgressionLayer->CurrentXP;
+		SaveGameInstance->StatPoints = ProgressionLayer->StatPoints;
+		SaveGameInstance->UnlockedSkills = ProgressionLayer->UnlockedSkills;
 	}
 
 	// Save Time Layer
-	if (bEnableTimeLayer)
+	if (bEnableTimeLayer && TimeLayer)
 	{
-		SaveGameInstance->CurrentGameTime = CurrentGameTime;
-		SaveGameInstance->CurrentHour = CurrentHour;
-		SaveGameInstance->CurrentDay = CurrentDay;
+		SaveGameInstance->CurrentGameTime = TimeLayer->CurrentGameTime;
+		SaveGameInstance->CurrentHour = TimeLayer->CurrentHour;
+		SaveGameInstance->CurrentDay = TimeLayer->CurrentDay;
 	}
 
 	// Save to disk
@@ -1636,6 +2717,8 @@ bool UStatSystemProComponent::QuickSave(const FString& SlotName)
 
 bool UStatSystemProComponent::QuickLoad(const FString& SlotName)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_Load);
+
 	UStatSystemProSaveGame* LoadedGame = Cast<UStatSystemProSaveGame>(
 		UGameplayStatics::LoadGameFromSlot(SlotName, 0));
 
@@ -1653,52 +2736,59 @@ bool UStatSystemProComponent::QuickLoad(const FString& SlotName)
 	bEnableProgressionLayer = LoadedGame->bEnableProgressionLayer;
 	bEnableTimeLayer = LoadedGame->bEnableTimeLayer;
 
+	// Layers the save switched on need their objects before their data can load
+	CreateEnabledLayers();
+
 	// Load Stat Layer
-	if (bEnableStatLayer)
+	if (bEnableStatLayer && StatLayer)
 	{
-		Stats = LoadedGame->Stats;
+		StatLayer->Stats.FromMap(LoadedGame->Stats);
+		MarkStatSimulationDirty();
 	}
 
 	// Load Body Layer
-	if (bEnableBodyLayer)
+	if (bEnableBodyLayer && BodyLayer)
 	{
-		BodyParts = LoadedGame->BodyParts;
+		BodyLayer->BodyParts = LoadedGame->BodyParts;
 	}
 
 	// Load Weather Layer
-	if (bEnableWeatherLayer)
+	if (bEnableWeatherLayer && WeatherLayer)
 	{
-		CurrentWeather = LoadedGame->CurrentWeather;
-		AmbientTemperature = LoadedGame->AmbientTemperature;
-		WindSpeed = LoadedGame->WindSpeed;
-		WetnessLevel = LoadedGame->WetnessLevel;
-		ShelterLevel = LoadedGame->ShelterLevel;
-		EquippedClothing = LoadedGame->EquippedClothing;
+		WeatherLayer->CurrentWeather = LoadedGame->CurrentWeather;
+		WeatherLayer->AmbientTemperature = LoadedGame->AmbientTemperature;
+		WeatherLayer->WindSpeed = LoadedGame->WindSpeed;
+		WeatherLayer->WetnessLevel = LoadedGame->WetnessLevel;
+		WeatherLayer->ShelterLevel = LoadedGame->ShelterLevel;
+		WeatherLayer->EquippedClothing = LoadedGame->EquippedClothing;
 	}
 
 	// Load Status Effect Layer
-	if (bEnableStatusEffectLayer)
+	if (bEnableStatusEffectLayer && StatusEffectLayer)
 	{
-		ActiveEffects = LoadedGame->ActiveEffects;
+		StatusEffectLayer->ActiveEffects = LoadedGame->ActiveEffects;
 	}
 
 	// Load Progression Layer
-	if (bEnableProgressionLayer)
+	if (bEnableProgressionLayer && ProgressionLayer)
 	{
-		CurrentLevel = LoadedGame->CurrentLevel;
-		CurrentXP = LoadedGame->CurrentXP;
-		StatPoints = LoadedGame->StatPoints;
-		UnlockedSkills = LoadedGame->UnlockedSkills;
+		ProgressionLayer->CurrentLevel = LoadedGame->CurrentLevel;
+		ProgressionLayer->CurrentXP = LoadedGame->CurrentXP;
+		ProgressionLayer->StatPoints = LoadedGame->StatPoints;
+		ProgressionLayer->UnlockedSkills = LoadedGame->UnlockedSkills;
 	}
 
 	// Load Time Layer
-	if (bEnableTimeLayer)
+	if (bEnableTimeLayer && TimeLayer)
 	{
-		CurrentGameTime = LoadedGame->CurrentGameTime;
-		CurrentHour = LoadedGame->CurrentHour;
-		CurrentDay = LoadedGame->CurrentDay;
+		TimeLayer->CurrentGameTime = LoadedGame->CurrentGameTime;
+		TimeLayer->CurrentHour = LoadedGame->CurrentHour;
+		TimeLayer->CurrentDay = LoadedGame->CurrentDay;
 	}
 
+	// Loaded state decides which layers have work
+	RefreshDormancy();
+
 	UE_LOG(LogTemp, Log, TEXT("StatSystemPro: Successfully loaded from slot '%s'"), *SlotName);
 	return true;
 }
@@ -1707,34 +2797,89 @@ bool UStatSystemProComponent::QuickLoad(const FString& SlotName)
 // REPLICATION CALLBACKS
 // ============================================================================
 
-void UStatSystemProComponent::OnRep_Stats()
+void UStatSystemProComponent::OnRep_Layers()
 {
-	// Notify clients that stats have been updated
+	// Announce each layer object once, the first time it arrives
+	for (int32 LayerIndex = 0; LayerIndex < (int32)EStatSystemProLayer::MAX; ++LayerIndex)
+	{
+		const uint8 LayerBit = (uint8)(1 << LayerIndex);
+		UStatSystemProLayer* LayerObject = GetLayer((EStatSystemProLayer)LayerIndex);
+		if (!LayerObject)
+		{
+			// Gone on the server - announce it again if it comes back
+			ReadyLayerMask &= ~LayerBit;
+			continue;
+		}
+
+		if (!(ReadyLayerMask & LayerBit))
+		{
+			ReadyLayerMask |= LayerBit;
+			OnLayerReady.Broadcast(LayerObject);
+		}
+	}
 }
 
-void UStatSystemProComponent::OnRep_BodyParts()
+void UStatSystemProComponent::OnRep_Stats()
 {
-	// Notify clients that body parts have been updated
+	if (!StatLayer)
+	{
+		return;
+	}
+
+	// Notify clients of the stats that actually changed
+	FStatContainer& Stats = StatLayer->Stats;
+	for (const FStatReplicatedChange& Change : Stats.GetReplicatedChanges())
+	{
+		const FStatValue* Stat = Stats.Find(Change.StatType);
+		const float OldValue = Change.bWasPresent ? Change.OldStat.CurrentValue : 0.0f;
+		const float NewValue = Stat ? Stat->CurrentValue : 0.0f;
+
+		if (Stat && Change.bWasPresent && !FMath::IsNearlyEqual(Change.OldStat.MaxValue, Stat->MaxValue))
+		{
+			StatLayer->OnStatMaxChanged.Broadcast(Change.StatType, Stat->MaxValue);
+			NativeStatEvents.Broadcast(Change.StatType, EStatEventKind::MaxChanged, Change.OldStat.MaxValue, Stat->MaxValue);
+		}
+
+		if (!Change.bWasPresent || !FMath::IsNearlyEqual(OldValue, NewValue))
+		{
+			NotifyStatChanged(Change.StatType, OldValue, NewValue, NAME_None, FGameplayTag());
+		}
+	}
+
+	Stats.ConsumeReplicatedChanges();
 }
 
-void UStatSystemProComponent::OnRep_CurrentWeather()
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+void UStatSystemProComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
 {
-	// Notify clients that weather has changed
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(GetAllocatedLayerMemory());
 }
 
-void UStatSystemProComponent::OnRep_EquippedClothing()
+int32 UStatSystemProComponent::GetInstanceMemorySize() const
 {
-	// Notify clients that clothing has changed
+	return (int32)(GetClass()->GetStructureSize() + GetAllocatedLayerMemory());
 }
 
-void UStatSystemProComponent::OnRep_ActiveEffects()
+SIZE_T UStatSystemProComponent::GetAllocatedLayerMemory() const
 {
-	// Notify clients that status effects have changed
-}
+	SIZE_T Size = NativeStatEvents.GetAllocatedSize();
 
-// ============================================================================
-// HELPER FUNCTIONS
-// ============================================================================
+	// Disabled layers have no object, so they cost nothing
+	for (int32 LayerIndex = 0; LayerIndex < (int32)EStatSystemProLayer::MAX; ++LayerIndex)
+	{
+		if (const UStatSystemProLayer* LayerObject = GetLayer((EStatSystemProLayer)LayerIndex))
+		{
+			Size += LayerObject->GetInstanceMemorySize();
+		}
+	}
+
+	return Size;
+}
 
 FString UStatSystemProComponent::GetDebugInfo() const
 {
@@ -1777,26 +2922,27 @@ FString UStatSystemProComponent::GetDebugInfo() const
 	if (bEnableWeatherLayer)
 	{
 		Info += TEXT("WEATHER LAYER:\n");
-		Info += FString::Printf(TEXT("  Ambient Temp: %.1f°C\n"), AmbientTemperature);
-		Info += FString::Printf(TEXT("  Wind Speed: %.1f m/s\n"), WindSpeed);
-		Info += FString::Printf(TEXT("  Clothing Items: %d\n"), EquippedClothing.Num());
+		const UStatSystemProWeatherLayer& Weather = LayerOrDefault(WeatherLayer);
+		Info += FString::Printf(TEXT("  Ambient Temp: %.1f°C\n"), Weather.AmbientTemperature);
+		Info += FString::Printf(TEXT("  Wind Speed: %.1f m/s\n"), Weather.WindSpeed);
+		Info += FString::Printf(TEXT("  Clothing Items: %d\n"), Weather.EquippedClothing.Num());
 		Info += TEXT("\n");
 	}
 
 	// Status Effects
 	if (bEnableStatusEffectLayer)
 	{
-		Info += FString::Printf(TEXT("STATUS EFFECTS: %d active\n\n"), ActiveEffects.Num());
+		Info += FString::Printf(TEXT("STATUS EFFECTS: %d active\n\n"), LayerOrDefault(StatusEffectLayer).ActiveEffects.Num());
 	}
 
 	// Progression
 	if (bEnableProgressionLayer)
 	{
 		Info += TEXT("PROGRESSION:\n");
-		Info += FString::Printf(TEXT("  Level: %d\n"), CurrentLevel);
+		Info += FString::Printf(TEXT("  Level: %d\n"), GetCurrentLevel());
 		Info += FString::Printf(TEXT("  XP: %d/%d (%.0f%%)\n"),
-			CurrentXP, GetXPForNextLevel(), GetLevelProgress() * 100.0f);
-		Info += FString::Printf(TEXT("  Stat Points: %d\n"), StatPoints);
+			GetCurrentXP(), GetXPForNextLevel(), GetLevelProgress() * 100.0f);
+		Info += FString::Printf(TEXT("  Stat Points: %d\n"), GetStatPoints());
 		Info += TEXT("\n");
 	}
 
@@ -1812,6 +2958,7 @@ FString UStatSystemProComponent::GetDebugInfo() const
 	Info += TEXT("OVERALL:\n");
 	Info += FString::Printf(TEXT("  Critical: %s\n"), IsCritical() ? TEXT("YES") : TEXT("NO"));
 	Info += FString::Printf(TEXT("  Health Status: %.0f%%\n"), GetOverallHealthStatus() * 100.0f);
+	Info += FString::Printf(TEXT("  Memory: %d bytes\n"), GetInstanceMemorySize());
 
 	return Info;
 }
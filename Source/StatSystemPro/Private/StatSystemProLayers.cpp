@@ -0,0 +1,186 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatSystemProLayers.h"
+#include "StatSystemProComponent.h"
+#include "Net/UnrealNetwork.h"
+
+// ============================================================================
+// LAYER BASE
+// ============================================================================
+
+UStatSystemProComponent* UStatSystemProLayer::GetOwningComponent() const
+{
+	return Cast<UStatSystemProComponent>(GetOuter());
+}
+
+SIZE_T UStatSystemProLayer::GetInstanceMemorySize() const
+{
+	return GetClass()->GetStructureSize() + GetAllocatedSize();
+}
+
+// ============================================================================
+// STAT LAYER
+// ============================================================================
+
+UStatSystemProStatLayer::UStatSystemProStatLayer()
+{
+	for (int32& PendingIndex : PendingStatChangeIndices)
+	{
+		PendingIndex = INDEX_NONE;
+	}
+}
+
+void UStatSystemProStatLayer::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UStatSystemProStatLayer, Stats);
+}
+
+SIZE_T UStatSystemProStatLayer::GetAllocatedSize() const
+{
+	return Stats.GetAllocatedSize() + PendingStatChanges.GetAllocatedSize();
+}
+
+void UStatSystemProStatLayer::OnRep_Stats()
+{
+	// The component broadcasts the stats that actually changed
+	if (UStatSystemProComponent* Component = GetOwningComponent())
+	{
+		Component->OnRep_Stats();
+	}
+}
+
+// ============================================================================
+// BODY LAYER
+// ============================================================================
+
+void UStatSystemProBodyLayer::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UStatSystemProBodyLayer, BodyParts);
+}
+
+SIZE_T UStatSystemProBodyLayer::GetAllocatedSize() const
+{
+	return BodyParts.GetAllocatedSize();
+}
+
+void UStatSystemProBodyLayer::OnRep_BodyParts()
+{
+	// Notify clients that body parts have been updated
+}
+
+// ============================================================================
+// WEATHER LAYER
+// ============================================================================
+
+UStatSystemProWeatherLayer::UStatSystemProWeatherLayer()
+{
+	CurrentWeather = EWeatherType::Clear;
+	AmbientTemperature = 20.0f;
+	WindSpeed = 5.0f;
+	WetnessLevel = 0.0f;
+	ShelterLevel = 0.0f;
+	CurrentFreezingStage = EFreezingStage::None;
+	CurrentOverheatingStage = EOverheatingStage::None;
+}
+
+void UStatSystemProWeatherLayer::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UStatSystemProWeatherLayer, CurrentWeather);
+	DOREPLIFETIME(UStatSystemProWeatherLayer, AmbientTemperature);
+	DOREPLIFETIME(UStatSystemProWeatherLayer, WindSpeed);
+	DOREPLIFETIME(UStatSystemProWeatherLayer, WetnessLevel);
+	DOREPLIFETIME(UStatSystemProWeatherLayer, ShelterLevel);
+	DOREPLIFETIME(UStatSystemProWeatherLayer, EquippedClothing);
+	DOREPLIFETIME(UStatSystemProWeatherLayer, CurrentFreezingStage);
+	DOREPLIFETIME(UStatSystemProWeatherLayer, CurrentOverheatingStage);
+}
+
+SIZE_T UStatSystemProWeatherLayer::GetAllocatedSize() const
+{
+	return EquippedClothing.GetAllocatedSize();
+}
+
+void UStatSystemProWeatherLayer::OnRep_CurrentWeather()
+{
+	// Notify clients that weather has changed
+}
+
+void UStatSystemProWeatherLayer::OnRep_EquippedClothing()
+{
+	// Notify clients that clothing has changed
+}
+
+// ============================================================================
+// STATUS EFFECT LAYER
+// ============================================================================
+
+void UStatSystemProStatusEffectLayer::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UStatSystemProStatusEffectLayer, ActiveEffects);
+}
+
+SIZE_T UStatSystemProStatusEffectLayer::GetAllocatedSize() const
+{
+	return ActiveEffects.GetAllocatedSize();
+}
+
+void UStatSystemProStatusEffectLayer::OnRep_ActiveEffects()
+{
+	// Notify clients that status effects have changed
+}
+
+// ============================================================================
+// PROGRESSION LAYER
+// ============================================================================
+
+UStatSystemProProgressionLayer::UStatSystemProProgressionLayer()
+{
+	CurrentLevel = 1;
+	CurrentXP = 0;
+	StatPoints = 0;
+}
+
+void UStatSystemProProgressionLayer::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UStatSystemProProgressionLayer, CurrentLevel);
+	DOREPLIFETIME(UStatSystemProProgressionLayer, CurrentXP);
+	DOREPLIFETIME(UStatSystemProProgressionLayer, StatPoints);
+	DOREPLIFETIME(UStatSystemProProgressionLayer, UnlockedSkills);
+}
+
+SIZE_T UStatSystemProProgressionLayer::GetAllocatedSize() const
+{
+	return UnlockedSkills.GetAllocatedSize();
+}
+
+// ============================================================================
+// TIME LAYER
+// ============================================================================
+
+UStatSystemProTimeLayer::UStatSystemProTimeLayer()
+{
+	CurrentGameTime = 0.0f;
+	CurrentHour = 8; // Start at 8 AM
+	CurrentDay = 1;
+	CurrentTimeOfDay = ETimeOfDay::Morning;
+}
+
+void UStatSystemProTimeLayer::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UStatSystemProTimeLayer, CurrentGameTime);
+	DOREPLIFETIME(UStatSystemProTimeLayer, CurrentHour);
+	DOREPLIFETIME(UStatSystemProTimeLayer, CurrentDay);
+	DOREPLIFETIME(UStatSystemProTimeLayer, CurrentTimeOfDay);
+}
@@ -38,7 +38,21 @@ UStatSystemProSettings::UStatSystemProSettings()
 	// Performance Defaults
 	bEnableTickOptimization = true;
 	StatUpdateInterval = 0.033f;  // ~30 FPS update rate
+	SignificanceNearDistance = 3000.0f;  // 30m
+	SignificanceFarDistance = 10000.0f;  // 100m
+	SignificanceUpdateInterval = 0.25f;
+	bUseFixedTimestep = false;
+	FixedTimestep = 0.05f;  // 20 Hz
+	MaxFixedStepsPerFrame = 64;
+	bUseBatchedStatSimulation = true;
+	bUseParallelLayerSimulation = true;
+	ParallelLayerMinBatchSize = 16;
+	bUseComponentDormancy = true;
+	bUseCurveLUTs = true;
+	CurveLUTResolution = 64;
+	CurveLUTMaxError = 0.01f;
 
 	// Debug Defaults
 	bEnableDebugLogging = false;
+	bValidateStatAggregates = false;
 }
@@ -0,0 +1,22 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatSystemProStats.h"
+
+DEFINE_STAT(STAT_StatSystemPro_StatLayer);
+DEFINE_STAT(STAT_StatSystemPro_BodyLayer);
+DEFINE_STAT(STAT_StatSystemPro_EnvironmentLayer);
+DEFINE_STAT(STAT_StatSystemPro_WeatherLayer);
+DEFINE_STAT(STAT_StatSystemPro_StatusEffectLayer);
+DEFINE_STAT(STAT_StatSystemPro_ProgressionLayer);
+DEFINE_STAT(STAT_StatSystemPro_TimeLayer);
+
+DEFINE_STAT(STAT_StatSystemPro_ApplyStatChange);
+DEFINE_STAT(STAT_StatSystemPro_BroadcastStatEvents);
+DEFINE_STAT(STAT_StatSystemPro_EffectiveTemperature);
+
+DEFINE_STAT(STAT_StatSystemPro_Save);
+DEFINE_STAT(STAT_StatSystemPro_Load);
+
+DEFINE_STAT(STAT_StatSystemPro_ComponentsTicked);
+DEFINE_STAT(STAT_StatSystemPro_StatChangesApplied);
+DEFINE_STAT(STAT_StatSystemPro_EventsBroadcast);
@@ -0,0 +1,149 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatSystemProTrace.h"
+
+#if STATSYSTEMPRO_TRACE_ENABLED
+
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "ObjectTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(StatSystemProChannel)
+
+UE_TRACE_EVENT_BEGIN(StatSystemPro, StatChanged)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, ActorId)
+	UE_TRACE_EVENT_FIELD(uint8, StatType)
+	UE_TRACE_EVENT_FIELD(float, OldValue)
+	UE_TRACE_EVENT_FIELD(float, NewValue)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Source)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ReasonTag)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(StatSystemPro, EffectApplied)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, ActorId)
+	UE_TRACE_EVENT_FIELD(int32, Stacks)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, EffectID)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(StatSystemPro, EffectRemoved)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, ActorId)
+	UE_TRACE_EVENT_FIELD(bool, bExpired)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, EffectID)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(StatSystemPro, BodyPartDamaged)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, ActorId)
+	UE_TRACE_EVENT_FIELD(uint8, BodyPart)
+	UE_TRACE_EVENT_FIELD(float, Damage)
+	UE_TRACE_EVENT_FIELD(float, HealthAfter)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(StatSystemPro, TemperatureStage)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, ActorId)
+	UE_TRACE_EVENT_FIELD(uint8, Kind)
+	UE_TRACE_EVENT_FIELD(uint8, OldStage)
+	UE_TRACE_EVENT_FIELD(uint8, NewStage)
+	UE_TRACE_EVENT_FIELD(float, BodyTemperature)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(StatSystemPro, LayerTick)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint64, ActorId)
+	UE_TRACE_EVENT_FIELD(uint8, Layer)
+UE_TRACE_EVENT_END()
+
+namespace StatSystemProTrace
+{
+	/** Object trace ID of the component's owner (falls back to the component itself) */
+	static uint64 GetActorId(const UActorComponent* Component)
+	{
+		const UObject* Object = Component && Component->GetOwner() ? (const UObject*)Component->GetOwner() : (const UObject*)Component;
+		if (!Object)
+		{
+			return 0;
+		}
+
+#if OBJECT_TRACE_ENABLED
+		// Lets Insights name the actor (needs the object channel)
+		TRACE_OBJECT(Object);
+		return FObjectTrace::GetObjectId(Object);
+#else
+		return (uint64)(UPTRINT)Object;
+#endif
+	}
+}
+
+void FStatSystemProTrace::OutputStatChanged(const UActorComponent* Component, EStatType StatType, float OldValue, float NewValue, FName Source, const FGameplayTag& ReasonTag)
+{
+	const FString SourceString = Source.IsNone() ? FString() : Source.ToString();
+	const FString TagString = ReasonTag.IsValid() ? ReasonTag.ToString() : FString();
+
+	UE_TRACE_LOG(StatSystemPro, StatChanged, StatSystemProChannel)
+		<< StatChanged.Cycle(FPlatformTime::Cycles64())
+		<< StatChanged.ActorId(StatSystemProTrace::GetActorId(Component))
+		<< StatChanged.StatType((uint8)StatType)
+		<< StatChanged.OldValue(OldValue)
+		<< StatChanged.NewValue(NewValue)
+		<< StatChanged.Source(*SourceString, SourceString.Len())
+		<< StatChanged.ReasonTag(*TagString, TagString.Len());
+}
+
+void FStatSystemProTrace::OutputEffectApplied(const UActorComponent* Component, FName EffectID, int32 Stacks)
+{
+	const FString EffectString = EffectID.ToString();
+
+	UE_TRACE_LOG(StatSystemPro, EffectApplied, StatSystemProChannel)
+		<< EffectApplied.Cycle(FPlatformTime::Cycles64())
+		<< EffectApplied.ActorId(StatSystemProTrace::GetActorId(Component))
+		<< EffectApplied.Stacks(Stacks)
+		<< EffectApplied.EffectID(*EffectString, EffectString.Len());
+}
+
+void FStatSystemProTrace::OutputEffectRemoved(const UActorComponent* Component, FName EffectID, bool bExpired)
+{
+	const FString EffectString = EffectID.ToString();
+
+	UE_TRACE_LOG(StatSystemPro, EffectRemoved, StatSystemProChannel)
+		<< EffectRemoved.Cycle(FPlatformTime::Cycles64())
+		<< EffectRemoved.ActorId(StatSystemProTrace::GetActorId(Component))
+		<< EffectRemoved.bExpired(bExpired)
+		<< EffectRemoved.EffectID(*EffectString, EffectString.Len());
+}
+
+void FStatSystemProTrace::OutputBodyPartDamaged(const UActorComponent* Component, EBodyPart BodyPart, float Damage, float HealthAfter)
+{
+	UE_TRACE_LOG(StatSystemPro, BodyPartDamaged, StatSystemProChannel)
+		<< BodyPartDamaged.Cycle(FPlatformTime::Cycles64())
+		<< BodyPartDamaged.ActorId(StatSystemProTrace::GetActorId(Component))
+		<< BodyPartDamaged.BodyPart((uint8)BodyPart)
+		<< BodyPartDamaged.Damage(Damage)
+		<< BodyPartDamaged.HealthAfter(HealthAfter);
+}
+
+void FStatSystemProTrace::OutputTemperatureStage(const UActorComponent* Component, EStatSystemProTraceTemperature Kind, uint8 OldStage, uint8 NewStage, float BodyTemperature)
+{
+	UE_TRACE_LOG(StatSystemPro, TemperatureStage, StatSystemProChannel)
+		<< TemperatureStage.Cycle(FPlatformTime::Cycles64())
+		<< TemperatureStage.ActorId(StatSystemProTrace::GetActorId(Component))
+		<< TemperatureStage.Kind((uint8)Kind)
+		<< TemperatureStage.OldStage(OldStage)
+		<< TemperatureStage.NewStage(NewStage)
+		<< TemperatureStage.BodyTemperature(BodyTemperature);
+}
+
+void FStatSystemProTrace::OutputLayerTick(const UActorComponent* Component, EStatSystemProTraceLayer Layer, uint64 StartCycle, uint64 EndCycle)
+{
+	UE_TRACE_LOG(StatSystemPro, LayerTick, StatSystemProChannel)
+		<< LayerTick.StartCycle(StartCycle)
+		<< LayerTick.EndCycle(EndCycle)
+		<< LayerTick.ActorId(StatSystemProTrace::GetActorId(Component))
+		<< LayerTick.Layer((uint8)Layer);
+}
+
+#endif // STATSYSTEMPRO_TRACE_ENABLED
@@ -2,6 +2,11 @@
 
 #include "StatusEffectLayer/StatusEffectComponent.h"
 #include "StatLayer/StatComponent.h"
+#include "StatLayer/StatRegistry.h"
+#include "Simulation/StatSignificanceSubsystem.h"
+#include "StatSystemProStats.h"
+#include "StatSystemProTrace.h"
+#include "Engine/World.h"
 #include "Engine/DataTable.h"
 
 UStatusEffectComponent::UStatusEffectComponent()
@@ -21,6 +26,15 @@ void UStatusEffectComponent::BeginPlay()
 	{
 		StatComponent = GetOwner()->FindComponentByClass<UStatComponent>();
 	}
+
+	// Effects applied before BeginPlay had no stat component to register with
+	ApplyEffectModifiers();
+
+	// Far-away and unseen owners tick less often
+	if (UStatSignificanceSubsystem* Significance = GetWorld() ? GetWorld()->GetSubsystem<UStatSignificanceSubsystem>() : nullptr)
+	{
+		Significance->RegisterComponent(this, EStatTickLayer::StatusEffects);
+	}
 }
 
 void UStatusEffectComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -32,8 +46,10 @@ void UStatusEffectComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 		return;
 	}
 
+	INC_DWORD_STAT(STAT_StatSystemPro_ComponentsTicked);
+	TRACE_STATSYSTEMPRO_LAYER_SCOPE(this, EStatSystemProTraceLayer::StatusEffect);
+
 	UpdateEffectTimers(DeltaTime);
-	ApplyEffectModifiers();
 }
 
 bool UStatusEffectComponent::ApplyStatusEffect(FName EffectID, int32 Stacks)
@@ -75,6 +91,8 @@ bool UStatusEffectComponent::ApplyStatusEffectFromData(const FStatusEffectData&
 				EffectData.MaxStacks
 			);
 			ExistingEffect.TimeRemaining = EffectData.Duration; // Reset timer
+			RefreshEffectModifiers(ExistingEffect);
+			TRACE_STATSYSTEMPRO_EFFECT_APPLIED(this, EffectData.EffectID, ExistingEffect.CurrentStacks);
 			OnStatusEffectApplied.Broadcast(EffectData.EffectID, ExistingEffect.CurrentStacks);
 			return true;
 		}
@@ -96,7 +114,9 @@ bool UStatusEffectComponent::ApplyStatusEffectFromData(const FStatusEffectData&
 	NewEffect.CurrentStacks = Stacks;
 	NewEffect.TimeApplied = GetWorld()->GetTimeSeconds();
 	ActiveEffects.Add(NewEffect);
+	RefreshEffectModifiers(NewEffect);
 
+	TRACE_STATSYSTEMPRO_EFFECT_APPLIED(this, EffectData.EffectID, Stacks);
 	OnStatusEffectApplied.Broadcast(EffectData.EffectID, Stacks);
 
 	UE_LOG(LogTemp, Log, TEXT("Status Effect Applied: %s | Stacks: %d"), *EffectData.EffectID.ToString(), Stacks);
@@ -110,6 +130,8 @@ bool UStatusEffectComponent::RemoveEffect(FName EffectID)
 	if (Index != INDEX_NONE)
 	{
 		ActiveEffects.RemoveAt(Index);
+		RemoveEffectModifiers(EffectID);
+		TRACE_STATSYSTEMPRO_EFFECT_REMOVED(this, EffectID, false);
 		OnStatusEffectRemoved.Broadcast(EffectID);
 		UE_LOG(LogTemp, Log, TEXT("Status Effect Removed: %s"), *EffectID.ToString());
 		return true;
@@ -127,6 +149,8 @@ int32 UStatusEffectComponent::RemoveEffectsByTag(FGameplayTag Tag)
 		{
 			FName EffectID = ActiveEffects[i].EffectData.EffectID;
 			ActiveEffects.RemoveAt(i);
+			RemoveEffectModifiers(EffectID);
+			TRACE_STATSYSTEMPRO_EFFECT_REMOVED(this, EffectID, false);
 			OnStatusEffectRemoved.Broadcast(EffectID);
 			RemovedCount++;
 		}
@@ -139,6 +163,8 @@ void UStatusEffectComponent::ClearAllEffects()
 {
 	for (const FActiveStatusEffect& Effect : ActiveEffects)
 	{
+		RemoveEffectModifiers(Effect.EffectData.EffectID);
+		TRACE_STATSYSTEMPRO_EFFECT_REMOVED(this, Effect.EffectData.EffectID, false);
 		OnStatusEffectRemoved.Broadcast(Effect.EffectData.EffectID);
 	}
 	ActiveEffects.Empty();
@@ -196,6 +222,8 @@ float UStatusEffectComponent::GetEffectTimeRemaining(FName EffectID) const
 
 void UStatusEffectComponent::UpdateEffectTimers(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_StatusEffectLayer);
+
 	// Update timers and remove expired effects
 	for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
 	{
@@ -217,6 +245,8 @@ void UStatusEffectComponent::UpdateEffectTimers(float DeltaTime)
 				FName EffectID = Effect.EffectData.EffectID;
 				float Duration = Effect.EffectData.Duration;
 				ActiveEffects.RemoveAt(i);
+				RemoveEffectModifiers(EffectID);
+				TRACE_STATSYSTEMPRO_EFFECT_REMOVED(this, EffectID, true);
 				OnStatusEffectExpired.Broadcast(EffectID, Duration);
 				UE_LOG(LogTemp, Log, TEXT("Status Effect Expired: %s"), *EffectID.ToString());
 			}
@@ -231,22 +261,64 @@ void UStatusEffectComponent::ApplyEffectModifiers()
 		return;
 	}
 
-	// Sort effects by priority (higher priority first)
-	ActiveEffects.Sort([](const FActiveStatusEffect& A, const FActiveStatusEffect& B)
+	for (const FActiveStatusEffect& Effect : ActiveEffects)
+	{
+		RefreshEffectModifiers(Effect);
+	}
+}
+
+void UStatusEffectComponent::RefreshEffectModifiers(const FActiveStatusEffect& Effect)
+{
+	if (!StatComponent)
 	{
-		return A.EffectData.Priority > B.EffectData.Priority;
-	});
+		return;
+	}
 
-	// Apply stat modifiers from all active effects
-	for (const FActiveStatusEffect& Effect : ActiveEffects)
+	const FName EffectID = Effect.EffectData.EffectID;
+	const float Stacks = (float)FMath::Max(1, Effect.CurrentStacks);
+
+	// Swap old for new in one batch so max values are never clamped in between
+	StatComponent->BeginStatModifierBatch();
+	StatComponent->RemoveStatModifiersFromSource(EffectID);
+
+	for (const FStatusEffectStatModifier& Modifier : Effect.EffectData.StatModifiers)
 	{
-		for (const FStatusEffectStatModifier& Modifier : Effect.EffectData.StatModifiers)
+		EStatType StatType;
+		if (!ResolveStatType(Modifier.StatName, StatType))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Status Effect %s: Unknown stat '%s'"), *EffectID.ToString(), *Modifier.StatName.ToString());
+			continue;
+		}
+
+		// Non-max modifiers change how fast the stat moves
+		const EStatModifierTarget Target = Modifier.bModifyMaxValue ? EStatModifierTarget::MaxValue : EStatModifierTarget::RegenerationRate;
+
+		// Each stack adds the full flat amount and the full bonus percentage
+		if (Modifier.FlatModifier != 0.0f)
+		{
+			StatComponent->AddStatModifier(StatType, Target, EStatModifierOp::Additive, Modifier.FlatModifier * Stacks, EffectID);
+		}
+		if (Modifier.MultiplierModifier != 1.0f)
 		{
-			// Convert stat name to enum (simplified, would need proper mapping)
-			// This is a basic implementation - in production you'd want a more robust system
-			// For now, this demonstrates the concept
+			StatComponent->AddStatModifier(StatType, Target, EStatModifierOp::Multiplicative, 1.0f + (Modifier.MultiplierModifier - 1.0f) * Stacks, EffectID);
 		}
 	}
+
+	StatComponent->EndStatModifierBatch();
+}
+
+void UStatusEffectComponent::RemoveEffectModifiers(FName EffectID)
+{
+	if (StatComponent)
+	{
+		StatComponent->RemoveStatModifiersFromSource(EffectID);
+	}
+}
+
+bool UStatusEffectComponent::ResolveStatType(FName StatName, EStatType& OutStatType)
+{
+	OutStatType = FStatRegistry::Get().FindStat(StatName);
+	return OutStatType != EStatType::MAX;
 }
 
 FStatusEffectData* UStatusEffectComponent::FindEffectData(FName EffectID)
@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Simulation/StatFixedStep.h"
+#include "Simulation/StatSurvivalFormulas.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace StatFixedStepTests
+{
+	static constexpr float StepSize = 0.05f;
+	static constexpr int32 MaxStepsPerFrame = 8;
+
+	/** Simulated span (seconds) - a whole number of steps */
+	static constexpr float Span = 10.0f;
+
+	/** Survival state stepped the way the layers step it (regen with clamp, bleeding, temperature approach, infection) */
+	struct FState
+	{
+		float Stamina = 20.0f;
+		float Blood = 100.0f;
+		float BodyTemperature = 37.0f;
+		float Infection = 10.0f;
+
+		/** Value of Stamina at the end of the previous/last step (UStatComponent::CaptureStepValues) */
+		float PreviousStamina = 20.0f;
+		float LastStamina = 20.0f;
+
+		int32 NumSteps = 0;
+
+		void Step(float StepTime)
+		{
+			// Regenerates into the clamp partway through the span
+			Stamina = StatSurvivalFormulas::Regenerate(Stamina, 100.0f, 9.0f, StepTime);
+			Blood = FMath::Max(0.0f, Blood - StatSurvivalFormulas::BloodLoss(1.5f, StepTime));
+			BodyTemperature += StatSurvivalFormulas::ApproachTemperature(BodyTemperature, 5.0f, StatSurvivalFormulas::BodyTemperatureResponse, StepTime);
+			Infection = StatSurvivalFormulas::GrowInfection(Infection, StepTime);
+
+			PreviousStamina = LastStamina;
+			LastStamina = Stamina;
+			++NumSteps;
+		}
+	};
+
+	/**
+	 * Run Span seconds of frames of FrameTime through a fixed-step accumulator
+	 * @param HitchFrame - First frame of a hitch (INDEX_NONE = no hitch)
+	 * @param HitchFrames - Frames the hitch swallows (delivered as one long frame)
+	 */
+	static FState Simulate(float FrameTime, int32 HitchFrame = INDEX_NONE, int32 HitchFrames = 0)
+	{
+		FState State;
+		FStatFixedStepAccumulator Accumulator;
+
+		const int32 NumFrames = FMath::RoundToInt32(Span / FrameTime);
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			float DeltaTime = FrameTime;
+			if (Frame == HitchFrame)
+			{
+				DeltaTime = FrameTime * HitchFrames;
+				Frame += HitchFrames - 1;
+			}
+
+			const int32 NumSteps = Accumulator.Advance(DeltaTime, StepSize, MaxStepsPerFrame);
+			for (int32 Step = 0; Step < NumSteps; ++Step)
+			{
+				State.Step(StepSize);
+			}
+		}
+
+		// Steps held back by the per-frame cap are caught up on later (empty) frames
+		while (const int32 NumSteps = Accumulator.Advance(0.0f, StepSize, MaxStepsPerFrame))
+		{
+			for (int32 Step = 0; Step < NumSteps; ++Step)
+			{
+				State.Step(StepSize);
+			}
+		}
+
+		return State;
+	}
+
+	static void TestSameState(FAutomationTestBase& Test, const TCHAR* What, const FState& Expected, const FState& Actual)
+	{
+		Test.TestEqual(FString::Printf(TEXT("%s: step count"), What), Actual.NumSteps, Expected.NumSteps);
+		Test.TestEqual(FString::Printf(TEXT("%s: stamina"), What), Actual.Stamina, Expected.Stamina);
+		Test.TestEqual(FString::Printf(TEXT("%s: blood"), What), Actual.Blood, Expected.Blood);
+		Test.TestEqual(FString::Printf(TEXT("%s: body temperature"), What), Actual.BodyTemperature, Expected.BodyTemperature);
+		Test.TestEqual(FString::Printf(TEXT("%s: infection"), What), Actual.Infection, Expected.Infection);
+		Test.TestEqual(FString::Printf(TEXT("%s: previous step stamina"), What), Actual.PreviousStamina, Expected.PreviousStamina);
+	}
+}
+
+/**
+ * Fixed stepping gives bit-identical results at 30, 60 and 144 Hz (and after a capped hitch)
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStatFixedStepFrameRateTest, "StatSystemPro.Simulation.FixedStepFrameRateIndependence",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FStatFixedStepFrameRateTest::RunTest(const FString& Parameters)
+{
+	using namespace StatFixedStepTests;
+
+	const FState At30 = Simulate(1.0f / 30.0f);
+	const FState At60 = Simulate(1.0f / 60.0f);
+	const FState At144 = Simulate(1.0f / 144.0f);
+
+	TestEqual(TEXT("30 Hz runs every step of the span"), At30.NumSteps, FMath::RoundToInt32(Span / StepSize));
+	TestSameState(*this, TEXT("60 Hz vs 30 Hz"), At30, At60);
+	TestSameState(*this, TEXT("144 Hz vs 30 Hz"), At30, At144);
+
+	// A 2 s hitch is over the per-frame cap (8 steps = 0.4 s) - the rest is caught up, not dropped
+	const FState Hitched = Simulate(1.0f / 30.0f, 60, 60);
+	TestSameState(*this, TEXT("30 Hz with hitch vs 30 Hz"), At30, Hitched);
+
+	return true;
+}
+
+/**
+ * Interpolation alpha tracks the time left in the accumulator
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStatFixedStepAlphaTest, "StatSystemPro.Simulation.FixedStepAlpha",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FStatFixedStepAlphaTest::RunTest(const FString& Parameters)
+{
+	using namespace StatFixedStepTests;
+
+	FStatFixedStepAccumulator Accumulator;
+	TestEqual(TEXT("No step yet"), Accumulator.GetAlpha(), 1.0f);
+
+	TestEqual(TEXT("Quarter step - no step due"), Accumulator.Advance(StepSize * 0.25f, StepSize, MaxStepsPerFrame), 0);
+	TestEqual(TEXT("Quarter step - alpha"), Accumulator.GetAlpha(), 0.25f, KINDA_SMALL_NUMBER);
+
+	TestEqual(TEXT("One more step - one step due"), Accumulator.Advance(StepSize, StepSize, MaxStepsPerFrame), 1);
+	TestEqual(TEXT("One more step - alpha unchanged"), Accumulator.GetAlpha(), 0.25f, KINDA_SMALL_NUMBER);
+
+	Accumulator.Reset();
+	TestEqual(TEXT("Reset - alpha"), Accumulator.GetAlpha(), 1.0f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "TimeSystem/TimeComponent.h"
+#include "StatSystemProStats.h"
+#include "StatSystemProTrace.h"
 #include "Net/UnrealNetwork.h"
 
 UTimeComponent::UTimeComponent()
@@ -44,6 +46,9 @@ void UTimeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorC
 		return;
 	}
 
+	INC_DWORD_STAT(STAT_StatSystemPro_ComponentsTicked);
+	TRACE_STATSYSTEMPRO_LAYER_SCOPE(this, EStatSystemProTraceLayer::Time);
+
 	// Only server updates time
 	if (GetOwnerRole() == ROLE_Authority)
 	{
@@ -56,6 +61,8 @@ void UTimeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorC
 
 void UTimeComponent::UpdateTime(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_TimeLayer);
+
 	if (!TimeSettings.bEnableDayNightCycle)
 	{
 		return;
@@ -2,6 +2,11 @@
 
 #include "WeatherSystem/WeatherComponent.h"
 #include "StatLayer/StatComponent.h"
+#include "Simulation/StatSignificanceSubsystem.h"
+#include "Simulation/StatSurvivalFormulas.h"
+#include "StatSystemProStats.h"
+#include "StatSystemProTrace.h"
+#include "Engine/World.h"
 #include "Net/UnrealNetwork.h"
 
 UWeatherComponent::UWeatherComponent()
@@ -18,6 +23,8 @@ UWeatherComponent::UWeatherComponent()
 	PreviousWeather = EWeatherType::Clear;
 	PreviousFreezingStage = EFreezingStage::None;
 	PreviousOverheatingStage = EOverheatingStage::None;
+	LayerSimulation = nullptr;
+	LayerSimulationHandle = INDEX_NONE;
 
 	SetIsReplicatedByDefault(true);
 }
@@ -43,27 +50,126 @@ void UWeatherComponent::BeginPlay()
 	PreviousWeather = CurrentWeather;
 	PreviousFreezingStage = CurrentFreezingStage;
 	PreviousOverheatingStage = CurrentOverheatingStage;
+
+	// Far-away and unseen owners tick less often
+	if (UStatSignificanceSubsystem* Significance = GetWorld() ? GetWorld()->GetSubsystem<UStatSignificanceSubsystem>() : nullptr)
+	{
+		Significance->RegisterComponent(this, EStatTickLayer::Weather);
+	}
+
+	RegisterWithLayerSimulation();
+}
+
+void UWeatherComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (LayerSimulation)
+	{
+		LayerSimulation->UnregisterClient(LayerSimulationHandle);
+		LayerSimulation = nullptr;
+		LayerSimulationHandle = INDEX_NONE;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UWeatherComponent::RegisterWithLayerSimulation()
+{
+	if (GetOwnerRole() != ROLE_Authority || !UStatLayerSimulationSubsystem::IsParallelLayerSimulationEnabled())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UStatLayerSimulationSubsystem* Subsystem = World ? World->GetSubsystem<UStatLayerSimulationSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	LayerSimulationHandle = Subsystem->RegisterClient(this, this);
+	if (LayerSimulationHandle != INDEX_NONE)
+	{
+		LayerSimulation = Subsystem;
+
+		// Subsystem computes and applies our stat changes
+		SetComponentTickEnabled(false);
+	}
 }
 
 void UWeatherComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (!bEnabled)
+	if (!ShouldSimulateLayer())
 	{
 		return;
 	}
 
+	INC_DWORD_STAT(STAT_StatSystemPro_ComponentsTicked);
+	TRACE_STATSYSTEMPRO_LAYER_SCOPE(this, EStatSystemProTraceLayer::Weather);
+
+	// Same compute/apply split the layer simulation subsystem runs, for this component alone
+	UStatComponent* StatComp = GetLayerStatTarget();
+	TickStatDeltas.Reset();
+	ComputeLayerStatDeltas(StatComp, DeltaTime, TickStatDeltas);
+	if (StatComp)
+	{
+		StatComp->ApplyStatChanges(TickStatDeltas);
+	}
+	PostLayerStatDeltasApplied(DeltaTime);
+}
+
+UStatComponent* UWeatherComponent::GetLayerStatTarget() const
+{
+	const AActor* Owner = GetOwner();
+	return Owner ? Owner->FindComponentByClass<UStatComponent>() : nullptr;
+}
+
+bool UWeatherComponent::ShouldSimulateLayer() const
+{
 	// Server updates everything
-	if (GetOwnerRole() == ROLE_Authority)
+	return bEnabled && GetOwnerRole() == ROLE_Authority;
+}
+
+void UWeatherComponent::ComputeLayerStatDeltas(const UStatComponent* Target, float DeltaTime, TArray<FStatDelta>& OutDeltas)
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_WeatherLayer);
+
+	// Step a local body temperature, so each fixed step sees the previous one's result before anything is applied
+	float BodyTemp = Target ? Target->GetStatValue(EStatType::BodyTemperature) : 0.0f;
+	float TempChange = 0.0f;
+
+	FixedStep.Run(DeltaTime, [&](float StepTime)
 	{
-		UpdateClothingWetness(DeltaTime);
-		UpdateTemperatureEffects(DeltaTime);
-		UpdateTemperatureStages();
-		ApplyTemperatureEffects(DeltaTime);
+		UpdateClothingWetness(StepTime);
+
+		if (!Target)
+		{
+			return;
+		}
+
+		const float StepTempChange = CalculateBodyTemperatureChange(BodyTemp, StepTime);
+		BodyTemp += StepTempChange;
+		TempChange += StepTempChange;
+
+		StatSurvivalFormulas::AddTemperatureEffectDeltas(
+			StatSurvivalFormulas::GetFreezingStage(BodyTemp), StatSurvivalFormulas::GetOverheatingStage(BodyTemp), StepTime, OutDeltas);
+	});
+
+	if (Target)
+	{
+		OutDeltas.Emplace(EStatType::BodyTemperature, TempChange, TEXT("Weather"));
 	}
 }
 
+void UWeatherComponent::PostLayerStatDeltasApplied(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_WeatherLayer);
+
+	// Stage events fire from the applied temperature
+	UpdateTemperatureStages();
+}
+
 // ========== WEATHER CONTROL ==========
 
 void UWeatherComponent::SetWeatherType(EWeatherType NewWeather)
@@ -264,6 +370,8 @@ float UWeatherComponent::GetTotalClothingWeight() const
 
 FTemperatureResult UWeatherComponent::CalculateEffectiveTemperature() const
 {
+	SCOPE_CYCLE_COUNTER(STAT_StatSystemPro_EffectiveTemperature);
+
 	FTemperatureResult Result;
 	Result.AmbientTemperature = AmbientTemperature;
 
@@ -375,28 +483,13 @@ void UWeatherComponent::UpdateClothingWetness(float DeltaTime)
 	}
 }
 
-void UWeatherComponent::UpdateTemperatureEffects(float DeltaTime)
+float UWeatherComponent::CalculateBodyTemperatureChange(float BodyTemp, float DeltaTime) const
 {
 	// Get effective temperature
 	FTemperatureResult TempResult = CalculateEffectiveTemperature();
 
-	// Find stat component to update body temperature
-	UStatComponent* StatComp = GetOwner()->FindComponentByClass<UStatComponent>();
-	if (!StatComp)
-	{
-		return;
-	}
-
-	// Get current body temperature
-	float CurrentBodyTemp = StatComp->GetStatValue(EStatType::BodyTemperature);
-	float TargetBodyTemp = 37.0f; // Normal body temperature
-
-	// Calculate how fast body temperature changes
-	float TempDifference = TempResult.EffectiveTemperature - CurrentBodyTemp;
-	float ChangeRate = TempDifference * 0.05f * DeltaTime; // Gradual change
-
-	// Apply temperature change
-	StatComp->ApplyStatChange(EStatType::BodyTemperature, ChangeRate, TEXT("Weather"), FGameplayTag());
+	// Gradual change, exact for long ticks
+	return StatSurvivalFormulas::ApproachTemperature(BodyTemp, TempResult.EffectiveTemperature, 0.05f, DeltaTime);
 }
 
 void UWeatherComponent::UpdateTemperatureStages()
@@ -411,25 +504,12 @@ void UWeatherComponent::UpdateTemperatureStages()
 	float BodyTemp = StatComp->GetStatValue(EStatType::BodyTemperature);
 
 	// Update freezing stage
-	EFreezingStage NewFreezingStage = EFreezingStage::None;
-	if (BodyTemp < 36.0f)
-	{
-		if (BodyTemp >= 35.0f)
-			NewFreezingStage = EFreezingStage::Chilled;
-		else if (BodyTemp >= 34.0f)
-			NewFreezingStage = EFreezingStage::Cold;
-		else if (BodyTemp >= 32.0f)
-			NewFreezingStage = EFreezingStage::Freezing;
-		else if (BodyTemp >= 30.0f)
-			NewFreezingStage = EFreezingStage::Hypothermia;
-		else
-			NewFreezingStage = EFreezingStage::CriticalHypothermia;
-	}
-
+	EFreezingStage NewFreezingStage = StatSurvivalFormulas::GetFreezingStage(BodyTemp);
 	if (NewFreezingStage != CurrentFreezingStage)
 	{
 		EFreezingStage OldStage = CurrentFreezingStage;
 		CurrentFreezingStage = NewFreezingStage;
+		TRACE_STATSYSTEMPRO_TEMPERATURE_STAGE(this, EStatSystemProTraceTemperature::Freezing, OldStage, NewFreezingStage, BodyTemp);
 		OnFreezingStageChanged.Broadcast(OldStage, NewFreezingStage);
 
 		if (NewFreezingStage != EFreezingStage::None && OldStage == EFreezingStage::None)
@@ -439,25 +519,12 @@ void UWeatherComponent::UpdateTemperatureStages()
 	}
 
 	// Update overheating stage
-	EOverheatingStage NewOverheatingStage = EOverheatingStage::None;
-	if (BodyTemp > 37.5f)
-	{
-		if (BodyTemp <= 38.5f)
-			NewOverheatingStage = EOverheatingStage::Warm;
-		else if (BodyTemp <= 39.5f)
-			NewOverheatingStage = EOverheatingStage::Hot;
-		else if (BodyTemp <= 40.5f)
-			NewOverheatingStage = EOverheatingStage::Overheating;
-		else if (BodyTemp <= 42.0f)
-			NewOverheatingStage = EOverheatingStage::Heatstroke;
-		else
-			NewOverheatingStage = EOverheatingStage::CriticalHeatstroke;
-	}
-
+	EOverheatingStage NewOverheatingStage = StatSurvivalFormulas::GetOverheatingStage(BodyTemp);
 	if (NewOverheatingStage != CurrentOverheatingStage)
 	{
 		EOverheatingStage OldStage = CurrentOverheatingStage;
 		CurrentOverheatingStage = NewOverheatingStage;
+		TRACE_STATSYSTEMPRO_TEMPERATURE_STAGE(this, EStatSystemProTraceTemperature::Overheating, OldStage, NewOverheatingStage, BodyTemp);
 		OnOverheatingStageChanged.Broadcast(OldStage, NewOverheatingStage);
 
 		if (NewOverheatingStage != EOverheatingStage::None && OldStage == EOverheatingStage::None)
@@ -467,74 +534,6 @@ void UWeatherComponent::UpdateTemperatureStages()
 	}
 }
 
-void UWeatherComponent::ApplyTemperatureEffects(float DeltaTime)
-{
-	UStatComponent* StatComp = GetOwner()->FindComponentByClass<UStatComponent>();
-	if (!StatComp)
-	{
-		return;
-	}
-
-	// Apply freezing damage
-	switch (CurrentFreezingStage)
-	{
-	case EFreezingStage::Chilled:
-		// Minor stamina drain
-		StatComp->ApplyStatChange(EStatType::Stamina, -2.0f * DeltaTime, TEXT("Freezing"), FGameplayTag());
-		break;
-	case EFreezingStage::Cold:
-		// Moderate stamina drain + minor health drain
-		StatComp->ApplyStatChange(EStatType::Stamina, -5.0f * DeltaTime, TEXT("Freezing"), FGameplayTag());
-		StatComp->ApplyStatChange(EStatType::Health_Core, -0.5f * DeltaTime, TEXT("Freezing"), FGameplayTag());
-		break;
-	case EFreezingStage::Freezing:
-		// Heavy stamina drain + moderate health drain
-		StatComp->ApplyStatChange(EStatType::Stamina, -10.0f * DeltaTime, TEXT("Freezing"), FGameplayTag());
-		StatComp->ApplyStatChange(EStatType::Health_Core, -2.0f * DeltaTime, TEXT("Freezing"), FGameplayTag());
-		break;
-	case EFreezingStage::Hypothermia:
-		// Severe health drain
-		StatComp->ApplyStatChange(EStatType::Health_Core, -5.0f * DeltaTime, TEXT("Hypothermia"), FGameplayTag());
-		break;
-	case EFreezingStage::CriticalHypothermia:
-		// Critical health drain - near death
-		StatComp->ApplyStatChange(EStatType::Health_Core, -10.0f * DeltaTime, TEXT("CriticalHypothermia"), FGameplayTag());
-		break;
-	default:
-		break;
-	}
-
-	// Apply overheating damage
-	switch (CurrentOverheatingStage)
-	{
-	case EOverheatingStage::Warm:
-		// Minor stamina drain
-		StatComp->ApplyStatChange(EStatType::Stamina, -2.0f * DeltaTime, TEXT("Overheating"), FGameplayTag());
-		break;
-	case EOverheatingStage::Hot:
-		// Moderate stamina drain + thirst increase
-		StatComp->ApplyStatChange(EStatType::Stamina, -5.0f * DeltaTime, TEXT("Overheating"), FGameplayTag());
-		StatComp->ApplyStatChange(EStatType::Thirst, -3.0f * DeltaTime, TEXT("Overheating"), FGameplayTag());
-		break;
-	case EOverheatingStage::Overheating:
-		// Heavy stamina drain + thirst + minor health drain
-		StatComp->ApplyStatChange(EStatType::Stamina, -10.0f * DeltaTime, TEXT("Overheating"), FGameplayTag());
-		StatComp->ApplyStatChange(EStatType::Thirst, -5.0f * DeltaTime, TEXT("Overheating"), FGameplayTag());
-		StatComp->ApplyStatChange(EStatType::Health_Core, -1.0f * DeltaTime, TEXT("Overheating"), FGameplayTag());
-		break;
-	case EOverheatingStage::Heatstroke:
-		// Severe health drain
-		StatComp->ApplyStatChange(EStatType::Health_Core, -5.0f * DeltaTime, TEXT("Heatstroke"), FGameplayTag());
-		break;
-	case EOverheatingStage::CriticalHeatstroke:
-		// Critical health drain - near death
-		StatComp->ApplyStatChange(EStatType::Health_Core, -10.0f * DeltaTime, TEXT("CriticalHeatstroke"), FGameplayTag());
-		break;
-	default:
-		break;
-	}
-}
-
 // ========== WEATHER PRESETS ==========
 
 FWeatherPreset UWeatherComponent::GetBlizzardPreset()
@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "BodyLayer/BodyTypes.h"
+#include "StatLayer/StatModifierAggregator.h"
+#include "Simulation/StatFixedStep.h"
+#include "Simulation/StatLayerSimulationSubsystem.h"
 #include "BodyComponent.generated.h"
 
 // Forward declarations
@@ -22,7 +25,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBodyPartInfected, EBodyPart, Bod
  * Part of the Body Layer
  */
 UCLASS(ClassGroup=(StatSystemPro), meta=(BlueprintSpawnableComponent))
-class STATSYSTEMPRO_API UBodyComponent : public UActorComponent
+class STATSYSTEMPRO_API UBodyComponent : public UActorComponent, public IStatLayerSimulationClient
 {
 	GENERATED_BODY()
 
@@ -33,8 +36,15 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
+	// IStatLayerSimulationClient
+	virtual UStatComponent* GetLayerStatTarget() const override { return StatComponent; }
+	virtual bool ShouldSimulateLayer() const override { return bEnabled; }
+	virtual void ComputeLayerStatDeltas(const UStatComponent* Target, float DeltaTime, TArray<FStatDelta>& OutDeltas) override;
+	virtual void PostLayerStatDeltasApplied(float DeltaTime) override;
+
 	/** Enable/Disable this layer */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Body System|Layer Control")
 	bool bEnabled;
@@ -143,17 +153,39 @@ public:
 
 private:
 	/**
-	 * Update bleeding effects
+	 * Blood lost to bleeding over DeltaTime
 	 */
-	void UpdateBleeding(float DeltaTime);
+	float UpdateBleeding(float DeltaTime) const;
 
 	/**
 	 * Update infection progression
+	 * @return Infection level gained over DeltaTime
 	 */
-	void UpdateInfection(float DeltaTime);
+	float UpdateInfection(float DeltaTime);
 
 	/**
-	 * Apply body state effects to stats
+	 * Apply body state effects to stat modifiers
 	 */
 	void ApplyBodyEffectsToStats();
+
+	/**
+	 * Hand the stat updates over to the world's layer simulation subsystem (server only)
+	 */
+	void RegisterWithLayerSimulation();
+
+	/** Subsystem computing our stat deltas (null = we tick ourselves) */
+	UPROPERTY(Transient)
+	UStatLayerSimulationSubsystem* LayerSimulation;
+
+	/** Registration handle with LayerSimulation */
+	int32 LayerSimulationHandle;
+
+	/** Deltas collected by our own tick (reused) */
+	TArray<FStatDelta> TickStatDeltas;
+
+	/** Torso condition -> max health multiplier, registered on the stat component */
+	FStatModifierHandle TorsoMaxHealthModifier;
+
+	/** Frame time -> fixed bleeding/infection steps */
+	FStatFixedStepAccumulator FixedStep;
 };
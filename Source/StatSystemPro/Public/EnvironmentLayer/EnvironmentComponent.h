@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "EnvironmentLayer/EnvironmentTypes.h"
+#include "Simulation/StatFixedStep.h"
+#include "Simulation/StatLayerSimulationSubsystem.h"
 #include "EnvironmentComponent.generated.h"
 
 // Forward declarations
@@ -22,7 +24,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRadiationExposure, float, Radiati
  * Part of the Environment Layer
  */
 UCLASS(ClassGroup=(StatSystemPro), meta=(BlueprintSpawnableComponent))
-class STATSYSTEMPRO_API UEnvironmentComponent : public UActorComponent
+class STATSYSTEMPRO_API UEnvironmentComponent : public UActorComponent, public IStatLayerSimulationClient
 {
 	GENERATED_BODY()
 
@@ -33,8 +35,15 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
+	// IStatLayerSimulationClient
+	virtual UStatComponent* GetLayerStatTarget() const override { return StatComponent; }
+	virtual bool ShouldSimulateLayer() const override { return bEnabled; }
+	virtual void ComputeLayerStatDeltas(const UStatComponent* Target, float DeltaTime, TArray<FStatDelta>& OutDeltas) override;
+	virtual void PostLayerStatDeltasApplied(float DeltaTime) override;
+
 	/** Enable/Disable this layer */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment System|Layer Control")
 	bool bEnabled;
@@ -142,19 +151,19 @@ public:
 
 private:
 	/**
-	 * Update body temperature based on environment
+	 * Body temperature change over DeltaTime, based on environment
 	 */
-	void UpdateBodyTemperature(float DeltaTime);
+	float CalculateBodyTemperatureChange(float BodyTemp, float Wetness, float DeltaTime) const;
 
 	/**
-	 * Update wetness based on weather
+	 * Wetness change over DeltaTime, based on weather
 	 */
-	void UpdateWetness(float DeltaTime);
+	float CalculateWetnessChange(float BodyTemp, float Wetness, float DeltaTime) const;
 
 	/**
-	 * Apply radiation damage
+	 * Radiation damage over DeltaTime
 	 */
-	void UpdateRadiation(float DeltaTime);
+	float CalculateRadiationDamage(float DeltaTime) const;
 
 	/**
 	 * Check for and apply temperature-related status effects
@@ -166,4 +175,22 @@ private:
 
 	/** Track if heatstroke warning was already triggered */
 	bool bHeatstrokeTriggered;
+
+	/** Frame time -> fixed temperature/wetness/radiation steps */
+	FStatFixedStepAccumulator FixedStep;
+
+	/**
+	 * Hand the stat updates over to the world's layer simulation subsystem (server only)
+	 */
+	void RegisterWithLayerSimulation();
+
+	/** Subsystem computing our stat deltas (null = we tick ourselves) */
+	UPROPERTY(Transient)
+	UStatLayerSimulationSubsystem* LayerSimulation;
+
+	/** Registration handle with LayerSimulation */
+	int32 LayerSimulationHandle;
+
+	/** Deltas collected by our own tick (reused) */
+	TArray<FStatDelta> TickStatDeltas;
 };
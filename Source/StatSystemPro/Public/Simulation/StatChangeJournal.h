@@ -0,0 +1,165 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StatLayer/StatTypes.h"
+#include <atomic>
+#include "StatChangeJournal.generated.h"
+
+namespace StatJournalSource
+{
+	/** Source recorded for SetStatValue (no reason is passed) */
+	extern STATSYSTEMPRO_API const FName SetValue;
+
+	/** Source recorded for regeneration/decay ticks */
+	extern STATSYSTEMPRO_API const FName Regeneration;
+
+	/** Source recorded when a new max clamps the current value */
+	extern STATSYSTEMPRO_API const FName SetMaxValue;
+
+	/** Source recorded for restore-all-to-max */
+	extern STATSYSTEMPRO_API const FName RestoreToMax;
+
+	/** Source recorded for deplete-all-to-zero */
+	extern STATSYSTEMPRO_API const FName DepleteAll;
+}
+
+/**
+ * One journaled stat change - plain binary data, no strings
+ */
+struct FStatJournalRecord
+{
+	/** World time of the change */
+	double Time = 0.0;
+
+	/** Owning actor's UObject unique id (resolve with GUObjectArray.IndexToObject) */
+	uint32 EntityId = 0;
+
+	/** Stat that changed */
+	EStatType StatType = EStatType::Health_Core;
+
+	/** Requested change (before clamping) */
+	float Delta = 0.0f;
+
+	/** Stat value after the change (after clamping) */
+	float NewValue = 0.0f;
+
+	/** Source name - stored as its name table index, never converted to a string here */
+	FName Source;
+
+	/** Optional reason tag */
+	FGameplayTag ReasonTag;
+};
+
+/**
+ * Read position of one journal consumer
+ * Each consumer (telemetry, debug UI, auditing) keeps its own cursor
+ */
+struct FStatJournalCursor
+{
+	/** Sequence number of the next record to read */
+	uint64 Next = 0;
+
+	/** Records overwritten before this consumer read them */
+	uint64 NumDropped = 0;
+};
+
+/**
+ * Fixed-size ring buffer of stat change records
+ *
+ * Written by the game thread only; readers on any thread copy records out without
+ * locks. Each slot carries the sequence number of the record it holds, published
+ * after the record is written - a reader that sees the sequence change while
+ * copying knows the slot was overwritten and counts the record as dropped.
+ */
+class STATSYSTEMPRO_API FStatChangeJournal
+{
+public:
+	/** Number of records kept (power of two) */
+	static constexpr uint32 Capacity = 4096;
+
+	FStatChangeJournal();
+
+	/** Append a record (game thread only). Overwrites the oldest once full. */
+	void Write(const FStatJournalRecord& Record);
+
+	/**
+	 * Copy every record after the cursor into OutRecords and advance the cursor
+	 * Safe from any thread
+	 * @return Number of records read
+	 */
+	int32 Read(FStatJournalCursor& Cursor, TArray<FStatJournalRecord>& OutRecords) const;
+
+	/** Cursor that only sees records written from now on */
+	FStatJournalCursor MakeCursorAtHead() const;
+
+	/** Cursor at the oldest record still held */
+	FStatJournalCursor MakeCursorAtTail() const;
+
+	/** Total records ever written */
+	uint64 GetNumWritten() const
+	{
+		return Head.load(std::memory_order_acquire);
+	}
+
+private:
+	struct FSlot
+	{
+		/** Sequence + 1 of the record in this slot (0 = empty or being written) */
+		std::atomic<uint64> Sequence{ 0 };
+
+		FStatJournalRecord Record;
+	};
+
+	static constexpr uint32 IndexMask = Capacity - 1;
+	static_assert((Capacity & IndexMask) == 0, "Journal capacity must be a power of two");
+
+	TUniquePtr<FSlot[]> Slots;
+
+	/** Sequence number of the next record to write */
+	std::atomic<uint64> Head{ 0 };
+};
+
+/**
+ * ============================================================================
+ * STAT CHANGE JOURNAL SUBSYSTEM - Per-World Change History
+ * ============================================================================
+ *
+ * UStatComponent and UStatSystemProComponent append every change they broadcast
+ * (ApplyStatChange / ApplyStatChanges with their reason; SetStatValue, regeneration,
+ * max-value clamps and restore/deplete-all under their own source names) here as a compact binary record instead of formatting a log line. Consumers poll
+ * with their own cursor to answer "why did this player's health drop" after the fact.
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatChangeJournalSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Append a change (game thread) */
+	FORCEINLINE void Record(const FStatJournalRecord& Record)
+	{
+		Journal.Write(Record);
+	}
+
+	/**
+	 * Append a change made by a stat component (game thread)
+	 * Stamps the world time and the component owner's id (the component's own id without an owner)
+	 */
+	void RecordChange(const UActorComponent* Component, EStatType StatType, float Delta, float NewValue, FName Source, FGameplayTag ReasonTag);
+
+	/** The journal, for consumers */
+	const FStatChangeJournal& GetJournal() const
+	{
+		return Journal;
+	}
+
+private:
+	FStatChangeJournal Journal;
+};
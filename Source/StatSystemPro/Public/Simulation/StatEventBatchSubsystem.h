@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StatEventBatchSubsystem.generated.h"
+
+/**
+ * Native hook for objects that accumulate events during a frame and emit them once
+ * Implemented by UStatComponent and UStatSystemProComponent
+ */
+class STATSYSTEMPRO_API IStatEventBatchClient
+{
+public:
+	virtual ~IStatEventBatchClient() = default;
+
+	/** End of frame: emit everything accumulated since the last flush */
+	virtual void FlushBatchedStatEvents() = 0;
+};
+
+/**
+ * ============================================================================
+ * STAT EVENT BATCH SUBSYSTEM - End-of-Frame Event Flush
+ * ============================================================================
+ *
+ * Components with batched events queue themselves here on their first change of
+ * the frame. After all actors, timers and tickables have run, every queued component
+ * is flushed once - so listeners see one event per component per frame.
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatEventBatchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Flush a client at the end of this frame
+	 * Callers should queue at most once per frame (the queue does not dedupe)
+	 */
+	void QueueFlush(UObject* Owner, IStatEventBatchClient* Client);
+
+private:
+	struct FPendingFlush
+	{
+		TWeakObjectPtr<UObject> Owner;
+		IStatEventBatchClient* Client = nullptr;
+	};
+
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/** Clients with events pending this frame */
+	TArray<FPendingFlush> Pending;
+
+	/** Clients being flushed (flushing can queue for the next frame) */
+	TArray<FPendingFlush> Flushing;
+
+	FDelegateHandle PostActorTickHandle;
+};
@@ -0,0 +1,86 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * ============================================================================
+ * STAT FIXED STEP - Frame-Rate Independent Integration
+ * ============================================================================
+ *
+ * Turns variable frame times into a whole number of constant-size steps, so a
+ * layer advanced at 30 Hz, 120 Hz or by tick LOD ends up in the same state.
+ *
+ * Frame time is accumulated and consumed in steps of FixedTimestep. At most
+ * MaxFixedStepsPerFrame run per call; any remainder beyond that is kept and
+ * caught up on later calls, so no simulated time is ever dropped.
+ *
+ * When fixed stepping is off (UStatSystemProSettings::bUseFixedTimestep),
+ * Run() calls the step once with the raw DeltaTime, as before.
+ *
+ * EXAMPLE:
+ * FixedStep.Run(DeltaTime, [this](float StepTime) { UpdateBleeding(StepTime); });
+ */
+class STATSYSTEMPRO_API FStatFixedStepAccumulator
+{
+public:
+	/** Is fixed stepping enabled in project settings? */
+	static bool IsEnabled();
+
+	/** Step size (seconds) from project settings */
+	static float GetStepSize();
+
+	/** Max steps per Run() from project settings */
+	static int32 GetMaxStepsPerFrame();
+
+	/**
+	 * Add frame time and return how many fixed steps are due (capped)
+	 * @param DeltaTime - Seconds since the last call
+	 */
+	int32 Advance(float DeltaTime, float StepSize, int32 MaxSteps);
+
+	/**
+	 * Advance and call StepFunc(StepTime) for each due step
+	 * (once with DeltaTime when fixed stepping is off)
+	 * @return Number of steps run
+	 */
+	template<typename FuncType>
+	int32 Run(float DeltaTime, FuncType&& StepFunc)
+	{
+		if (!IsEnabled())
+		{
+			Reset();
+			StepFunc(DeltaTime);
+			return 1;
+		}
+
+		const float StepSize = GetStepSize();
+		const int32 NumSteps = Advance(DeltaTime, StepSize, GetMaxStepsPerFrame());
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			StepFunc(StepSize);
+		}
+		return NumSteps;
+	}
+
+	/**
+	 * How far between the last step and the next one we are (0-1)
+	 * Use to interpolate displayed values between the last two step results
+	 */
+	float GetAlpha() const;
+
+	/** Forget accumulated time */
+	void Reset()
+	{
+		Accumulated = 0.0;
+		LastStepSize = 0.0f;
+	}
+
+private:
+	/** Time not yet consumed by steps (double, so the step count doesn't depend on how frames split it) */
+	double Accumulated = 0.0;
+
+	/** Step size of the last Advance (for GetAlpha) */
+	float LastStepSize = 0.0f;
+};
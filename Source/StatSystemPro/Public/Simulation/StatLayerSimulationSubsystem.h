@@ -0,0 +1,152 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StatLayer/StatTypes.h"
+#include "StatLayerSimulationSubsystem.generated.h"
+
+class UActorComponent;
+class UStatComponent;
+
+/**
+ * Native hook for layer components whose stat effects are computed by UStatLayerSimulationSubsystem
+ * Implemented by UBodyComponent, UEnvironmentComponent and UWeatherComponent
+ */
+class STATSYSTEMPRO_API IStatLayerSimulationClient
+{
+public:
+	virtual ~IStatLayerSimulationClient() = default;
+
+	/** Stat component this layer's deltas are applied to (game thread, nullptr = state only) */
+	virtual UStatComponent* GetLayerStatTarget() const = 0;
+
+	/** Should the layer run this frame? (game thread) */
+	virtual bool ShouldSimulateLayer() const = 0;
+
+	/**
+	 * Advance the layer and append the stat changes it wants to make
+	 * May run on a worker thread: read Target, update this component's own state only -
+	 * no broadcasts, no writes to other objects
+	 */
+	virtual void ComputeLayerStatDeltas(const UStatComponent* Target, float DeltaTime, TArray<FStatDelta>& OutDeltas) = 0;
+
+	/** Called on the game thread once this frame's deltas are applied (events, modifiers, status effects) */
+	virtual void PostLayerStatDeltasApplied(float DeltaTime) {}
+};
+
+/**
+ * ============================================================================
+ * STAT LAYER SIMULATION SUBSYSTEM - Parallel Compute, Deferred Apply
+ * ============================================================================
+ *
+ * Runs the stat-affecting part of every registered layer component (bleeding,
+ * infection, body temperature, wetness, radiation, freezing/overheating drains)
+ * in ONE tick, split into two phases:
+ *
+ * COMPUTE (worker threads, ParallelFor over all clients):
+ * - Each client advances its own state and appends FStatDeltas
+ * - Stats are only read, so clients can't see each other's changes mid-frame
+ * - Deltas go into per-task buffers - no locks, no shared writes
+ *
+ * APPLY (game thread):
+ * - Buffers are merged in client order (deterministic, whatever the scheduling)
+ * - Each stat component gets one ApplyStatChanges call: summed, clamped,
+ *   broadcast once per stat
+ * - Then each client's PostLayerStatDeltasApplied fires events/status effects
+ *
+ * Clients keep their tick LOD: a client is only computed once its component's
+ * tick interval has elapsed, with the accumulated time.
+ *
+ * Toggle with UStatSystemProSettings::bUseParallelLayerSimulation.
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatLayerSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem / FTickableGameObject
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Register a layer client. Returns a handle for UnregisterClient.
+	 * @param Owner - Component implementing the client (its tick interval is honored)
+	 */
+	int32 RegisterClient(UActorComponent* Owner, IStatLayerSimulationClient* Client);
+
+	/** Unregister a client by handle */
+	void UnregisterClient(int32 Handle);
+
+	/** Number of registered clients */
+	int32 GetNumClients() const { return Clients.Num(); }
+
+	/** Check if parallel layer simulation is enabled in project settings */
+	static bool IsParallelLayerSimulationEnabled();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FClientEntry
+	{
+		TWeakObjectPtr<UActorComponent> Owner;
+		IStatLayerSimulationClient* Client = nullptr;
+
+		/** Time since this client was last computed */
+		float ElapsedTime = 0.0f;
+	};
+
+	/** One client due this frame, resolved on the game thread before the compute phase */
+	struct FDueClient
+	{
+		IStatLayerSimulationClient* Client = nullptr;
+		UStatComponent* Target = nullptr;
+		int32 Handle = INDEX_NONE;
+		int32 TargetSlot = INDEX_NONE;
+		float DeltaTime = 0.0f;
+	};
+
+	/** A computed delta and the due client it came from */
+	struct FTaggedStatDelta
+	{
+		int32 DueIndex = INDEX_NONE;
+		FStatDelta Delta;
+	};
+
+	/** Per-task output of the compute phase */
+	struct FComputeContext
+	{
+		TArray<FTaggedStatDelta> Deltas;
+		TArray<FStatDelta> Scratch;
+	};
+
+	/** Drop clients whose owner was destroyed without unregistering */
+	void RemoveStaleClients();
+
+	/** Merge task buffers and apply them per stat component */
+	void ApplyDeltas(TArrayView<FComputeContext> Contexts);
+
+	/** Registered clients (sparse so handles stay stable) */
+	TSparseArray<FClientEntry> Clients;
+
+	/** Handles unregistered mid-apply, removed at the start of the next tick */
+	TArray<int32> PendingRemovals;
+
+	/** Clients due this frame */
+	TArray<FDueClient> DueClients;
+
+	/** Merged deltas (reused) */
+	TArray<FTaggedStatDelta> MergedDeltas;
+
+	/** Stat components receiving deltas this frame, and their merged deltas (reused) */
+	TArray<UStatComponent*> Targets;
+	TArray<TArray<FStatDelta>> TargetDeltas;
+	TMap<UStatComponent*, int32> TargetSlots;
+
+	/** True while applying deltas and firing client events */
+	bool bIsApplying = false;
+};
@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StatSignificanceSubsystem.generated.h"
+
+class UActorComponent;
+
+/**
+ * How much an actor's stats matter right now, from most to least
+ */
+UENUM(BlueprintType)
+enum class EStatSignificance : uint8
+{
+	/** Controlled by a player (or not placed in the world) - full rate */
+	Possessed UMETA(DisplayName = "Possessed"),
+
+	/** Close to a player, or on screen */
+	Near UMETA(DisplayName = "Near"),
+
+	/** Within the far distance */
+	Far UMETA(DisplayName = "Far"),
+
+	/** Beyond the far distance, or no players at all */
+	Distant UMETA(DisplayName = "Distant"),
+
+	MAX UMETA(Hidden)
+};
+
+/**
+ * Ticking layers, each with its own interval scale per significance
+ */
+enum class EStatTickLayer : uint8
+{
+	Stats,
+	Body,
+	StatusEffects,
+	Environment,
+	Weather,
+	Progression,
+	MAX
+};
+
+/**
+ * ============================================================================
+ * STAT SIGNIFICANCE SUBSYSTEM - Tick LOD
+ * ============================================================================
+ *
+ * Scales each layer component's tick interval by how significant its owner is:
+ * possessed by a player, distance to the nearest player's view point, and
+ * whether it was rendered recently.
+ *
+ * HOW IT WORKS:
+ * - Layer components register at BeginPlay (weakly - destroyed ones drop out)
+ * - Every SignificanceUpdateInterval the owners are re-evaluated
+ * - Interval = StatUpdateInterval x the layer's scale for that significance
+ *   (slow-changing layers like weather and progression back off further)
+ * - Components only get a new interval when their significance changes
+ *
+ * Layers integrate over whatever DeltaTime they receive, so a far-away NPC
+ * ticking once a second ends up where it would have at 60 Hz.
+ *
+ * Toggle with UStatSystemProSettings::bEnableTickOptimization.
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem / FTickableGameObject
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Put a layer component under tick LOD (no-op if tick optimization is off) */
+	void RegisterComponent(UActorComponent* Component, EStatTickLayer Layer);
+
+	/**
+	 * How significant an actor is right now
+	 * BLUEPRINT: Use to scale your own per-NPC work the same way the stat layers do
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stat System|Performance", meta=(
+		DisplayName = "Get Actor Significance",
+		Tooltip = "Possessed, Near, Far or Distant - the significance the stat layers use for their tick rate.",
+		Keywords = "significance lod distance tick"
+	))
+	EStatSignificance GetActorSignificance(const AActor* Actor) const;
+
+	/** Tick interval a layer uses at a significance */
+	static float GetTickInterval(EStatTickLayer Layer, EStatSignificance Significance);
+
+	/** Check if tick optimization is enabled in project settings */
+	static bool IsTickOptimizationEnabled();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FRegisteredComponent
+	{
+		TWeakObjectPtr<UActorComponent> Component;
+		EStatTickLayer Layer = EStatTickLayer::Stats;
+		EStatSignificance Significance = EStatSignificance::MAX;
+	};
+
+	/** Gather every player's view point */
+	void UpdateViewPoints();
+
+	/** Re-evaluate every registered owner and retune changed intervals */
+	void UpdateSignificance();
+
+	/** Set a component's interval for a significance (if it changed) */
+	static void ApplySignificance(FRegisteredComponent& Entry, EStatSignificance Significance);
+
+	/** Registered layer components */
+	TArray<FRegisteredComponent> Components;
+
+	/** Player view locations, refreshed with each update */
+	TArray<FVector> ViewPoints;
+
+	/** Seconds until the next re-evaluation */
+	float TimeUntilUpdate = 0.0f;
+};
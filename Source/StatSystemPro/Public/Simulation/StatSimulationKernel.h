@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * ============================================================================
+ * STAT SIMULATION KERNEL - Vectorized Regeneration + Clamp
+ * ============================================================================
+ *
+ * Steps structure-of-arrays stat lanes (see UStatSimulationSubsystem):
+ *
+ *   Current = Clamp(Current + Rate * DeltaTime, 0, Max)
+ *
+ * and flags every lane that crossed a threshold this step, in either direction:
+ * - zero      (reached zero, or left it)
+ * - max       (reached max, or left it)
+ * - critical  (dropped below Critical, or climbed back above it)
+ *
+ * The crossing mask is a conservative pre-filter: callers re-check the exact
+ * condition before firing events, but only for flagged lanes.
+ *
+ * Vectorized 4 lanes at a time with the engine's VectorRegister API
+ * (SSE on x64, NEON on ARM, scalar FPU fallback elsewhere).
+ */
+namespace StatSimulationKernel
+{
+	/** Lanes per crossing mask word */
+	static constexpr int32 LanesPerMaskWord = 32;
+
+	/** Number of uint32 words needed to hold one crossing bit per lane */
+	FORCEINLINE int32 GetNumMaskWords(int32 NumLanes)
+	{
+		return (NumLanes + LanesPerMaskWord - 1) / LanesPerMaskWord;
+	}
+
+	/** Check a lane's bit in a crossing mask */
+	FORCEINLINE bool HasCrossed(const uint32* CrossedMask, int32 Lane)
+	{
+		return (CrossedMask[Lane / LanesPerMaskWord] & (1u << (Lane % LanesPerMaskWord))) != 0;
+	}
+
+	/**
+	 * Advance lanes by DeltaTime (vectorized)
+	 * @param Current - In/out current values
+	 * @param Max - Max value per lane (clamp ceiling)
+	 * @param Rate - Regeneration per second per lane (negative = decay)
+	 * @param Critical - Critical value per lane (Max * CriticalThreshold)
+	 * @param OutCrossedMask - Must hold GetNumMaskWords(NumLanes) words, fully overwritten
+	 */
+	STATSYSTEMPRO_API void StepLanes(float* RESTRICT Current, const float* RESTRICT Max, const float* RESTRICT Rate,
+		const float* RESTRICT Critical, int32 NumLanes, float DeltaTime, uint32* RESTRICT OutCrossedMask);
+
+	/** Reference scalar implementation of StepLanes (tail handling / validation) */
+	STATSYSTEMPRO_API void StepLanesScalar(float* RESTRICT Current, const float* RESTRICT Max, const float* RESTRICT Rate,
+		const float* RESTRICT Critical, int32 NumLanes, float DeltaTime, uint32* RESTRICT OutCrossedMask);
+}
@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StatLayer/StatContainer.h"
+#include "Simulation/StatFixedStep.h"
+#include "StatSimulationSubsystem.generated.h"
+
+struct FStatCurveLUT;
+
+/**
+ * Native hook for components whose stat regeneration is driven by UStatSimulationSubsystem
+ * Implemented by UStatComponent and UStatSystemProComponent
+ */
+class STATSYSTEMPRO_API IStatSimulationClient
+{
+public:
+	virtual ~IStatSimulationClient() = default;
+
+	/** Stat storage the subsystem reads from and writes back to */
+	virtual FStatContainer& GetSimulatedStats() = 0;
+
+	/** Should regeneration run this frame? (layer enabled, auto regen on) */
+	virtual bool ShouldSimulateStats() const = 0;
+
+	/** Critical percentage (0-1) used for the kernel's critical crossing check */
+	virtual float GetSimulationCriticalThreshold() const = 0;
+
+	/** Called for each stat whose value changed enough to broadcast */
+	virtual void OnSimulatedStatChanged(EStatType StatType, float OldValue, float NewValue) = 0;
+
+	/** Called for each stat the kernel flagged as crossing zero, max or critical (re-check exact conditions) */
+	virtual void OnSimulatedStatCrossedThreshold(EStatType StatType, float OldValue, float NewValue) {}
+
+	/** Called once per client after every simulation step */
+	virtual void PostStatSimulation() {}
+};
+
+/**
+ * ============================================================================
+ * STAT SIMULATION SUBSYSTEM - Batched Stat Regeneration
+ * ============================================================================
+ *
+ * Advances regeneration/decay for every registered stat component in ONE tick,
+ * instead of one TickComponent per component.
+ *
+ * HOW IT WORKS:
+ * - Components register at BeginPlay (server only) and unregister at EndPlay
+ * - Every stat with a non-zero rate or a regen curve gets a "lane"
+ * - Lanes are stored as contiguous structure-of-arrays (current, max, rate)
+ * - Lanes are stepped by the vectorized StatSimulationKernel, which also
+ *   flags threshold crossings so zero/max/critical events only run for those
+ * - Idle stats (no regen) have no lane and cost nothing per frame
+ * - Curve-driven lanes read a baked FStatCurveLUT instead of evaluating the curve
+ * - Lane layout is rebuilt only when a client marks itself dirty
+ *   (rates changed, stats re-initialized, loaded from save)
+ * - With bUseFixedTimestep, lanes advance in fixed steps (see FStatFixedStepAccumulator)
+ *
+ * Toggle with UStatSystemProSettings::bUseBatchedStatSimulation.
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem / FTickableGameObject
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Register a client. Returns a handle for MarkClientDirty/UnregisterClient.
+	 * @param Owner - UObject implementing the client, used to detect stale registrations
+	 */
+	int32 RegisterClient(UObject* Owner, IStatSimulationClient* Client);
+
+	/** Unregister a client by handle */
+	void UnregisterClient(int32 Handle);
+
+	/** Rebuild lanes before the next step (call after changing rates or re-initializing stats) */
+	void MarkClientDirty(int32 Handle);
+
+	/** Number of registered clients */
+	int32 GetNumClients() const { return Clients.Num(); }
+
+	/** Number of stats currently being simulated */
+	int32 GetNumLanes() const { return LaneCurrent.Num(); }
+
+	/** Progress (0-1) from the last fixed step towards the next (1 when fixed stepping is off) */
+	float GetFixedStepAlpha() const { return FixedStep.GetAlpha(); }
+
+	/** Check if batched simulation is enabled in project settings */
+	static bool IsBatchedSimulationEnabled();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FClientEntry
+	{
+		TWeakObjectPtr<UObject> Owner;
+		IStatSimulationClient* Client = nullptr;
+	};
+
+	/** Advance every lane by one step and fire client events */
+	void StepSimulation(float DeltaTime);
+
+	/** Rebuild the SoA lane arrays from every client */
+	void RebuildLanes();
+
+	/** Drop clients whose owner was destroyed without unregistering */
+	void RemoveStaleClients();
+
+	/** Registered clients (sparse so handles stay stable) */
+	TSparseArray<FClientEntry> Clients;
+
+	// ========== LANES (structure-of-arrays, one entry per simulated stat) ==========
+
+	TArray<float> LaneCurrent;
+	TArray<float> LaneMax;
+	TArray<float> LaneRate;
+	TArray<float> LaneCritical;
+	TArray<int32> LaneClient;
+	TArray<EStatType> LaneStat;
+
+	/** Baked table per lane (nullptr = flat rate or LUTs disabled) and the curve it was looked up for */
+	TArray<const FStatCurveLUT*> LaneCurveLUT;
+	TArray<const UCurveFloat*> LaneCurveSource;
+
+	/** FStatCurveLUTCache generation the lane LUT pointers were fetched at */
+	uint32 CurveLUTGeneration = 0;
+
+	/** One bit per lane, set by the kernel when the lane crossed a threshold */
+	TArray<uint32> CrossedMask;
+
+	/** Per-lane value before the step (kept for the event pass after every lane is written) */
+	TArray<float> LaneOldScratch;
+
+	/** Per-client scratch, indexed by client handle */
+	TArray<FStatContainer*> ClientStatsScratch;
+	TArray<float> ClientCriticalScratch;
+
+	/** Handles unregistered mid-step, removed at the start of the next tick */
+	TArray<int32> PendingRemovals;
+
+	/** Frame time -> fixed steps */
+	FStatFixedStepAccumulator FixedStep;
+
+	/** Lane layout needs rebuilding */
+	bool bLanesDirty = false;
+
+	/** True while scattering results and firing client events */
+	bool bIsSimulating = false;
+};
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StatLayer/StatTypes.h"
+#include "WeatherSystem/WeatherTypes.h"
+
+/**
+ * ============================================================================
+ * STAT SURVIVAL FORMULAS - Shared Layer Math
+ * ============================================================================
+ *
+ * The per-second math behind regeneration, bleeding, infection and body
+ * temperature, shared by the layer components, UStatSystemProComponent and
+ * the MassEntity processors (StatSystemProMass companion plugin), so an NPC simulated as a
+ * Mass entity and a promoted actor follow exactly the same rules.
+ *
+ * Everything here is pure - safe to call from worker threads.
+ */
+namespace StatSurvivalFormulas
+{
+	/** Infection growth per second on an infected body part (0-100) */
+	inline constexpr float InfectionGrowthRate = 0.5f;
+
+	/** Infection_Level stat gained per second per infected body part */
+	inline constexpr float InfectionStatRate = 0.2f;
+
+	/** Highest infection a body part can reach */
+	inline constexpr float MaxInfection = 100.0f;
+
+	/** Body temperature response (1/s) used by the unified component and Mass entities */
+	inline constexpr float BodyTemperatureResponse = 0.1f;
+
+	/** Value after regenerating at RatePerSecond for DeltaTime, clamped to 0-Max */
+	inline float Regenerate(float Current, float Max, float RatePerSecond, float DeltaTime)
+	{
+		return FMath::Clamp(Current + RatePerSecond * DeltaTime, 0.0f, Max);
+	}
+
+	/** Blood lost over DeltaTime at a total bleeding rate (per second) */
+	inline float BloodLoss(float BleedingRate, float DeltaTime)
+	{
+		return FMath::Max(0.0f, BleedingRate) * DeltaTime;
+	}
+
+	/** Infection level after growing for DeltaTime */
+	inline float GrowInfection(float Infection, float DeltaTime)
+	{
+		return FMath::Min(MaxInfection, Infection + InfectionGrowthRate * DeltaTime);
+	}
+
+	/** Body temperature change over DeltaTime towards Target (exact exponential approach, so long steps don't overshoot) */
+	inline float ApproachTemperature(float BodyTemp, float Target, float Response, float DeltaTime)
+	{
+		return (Target - BodyTemp) * (1.0f - FMath::Exp(-Response * DeltaTime));
+	}
+
+	/** Freezing stage for a body temperature */
+	STATSYSTEMPRO_API EFreezingStage GetFreezingStage(float BodyTemp);
+
+	/** Overheating stage for a body temperature */
+	STATSYSTEMPRO_API EOverheatingStage GetOverheatingStage(float BodyTemp);
+
+	/** Stamina/health/thirst drains over DeltaTime for a pair of stages */
+	STATSYSTEMPRO_API void AddTemperatureEffectDeltas(EFreezingStage FreezingStage, EOverheatingStage OverheatingStage, float DeltaTime, TArray<FStatDelta>& OutDeltas);
+}
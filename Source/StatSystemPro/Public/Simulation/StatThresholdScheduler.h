@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StatLayer/StatTypes.h"
+#include "StatThresholdScheduler.generated.h"
+
+/**
+ * Native hook for objects that schedule predicted stat threshold crossings
+ * Implemented by UStatComponent
+ */
+class STATSYSTEMPRO_API IStatThresholdClient
+{
+public:
+	virtual ~IStatThresholdClient() = default;
+
+	/** A scheduled crossing time was reached. Ignore if Serial is no longer the stat's current schedule. */
+	virtual void OnStatThresholdDue(EStatType StatType, uint32 Serial) = 0;
+
+	/** Is Serial still the stat's current schedule? (lets the scheduler drop superseded entries) */
+	virtual bool IsStatThresholdScheduleCurrent(EStatType StatType, uint32 Serial) const = 0;
+};
+
+/**
+ * ============================================================================
+ * STAT THRESHOLD SCHEDULER - Predicted Zero/Max/Critical Crossings
+ * ============================================================================
+ *
+ * Per-world priority queue of the times at which stats will cross a threshold,
+ * computed from their current regen rate. Replaces scanning every stat every tick.
+ *
+ * HOW IT WORKS:
+ * - Clients push (time, stat, serial) when a stat's value or rate changes
+ * - Rescheduling bumps the stat's serial, so older entries are skipped when popped
+ * - Each tick pops only the entries that are due - idle worlds cost nothing
+ * - Superseded entries are compacted away when the queue grows
+ *
+ * Server only. Times are stat clock time in seconds (GetClockTime - the clock
+ * lazy stats are evaluated on, so predictions and the queue never drift apart).
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatThresholdScheduler : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem / FTickableGameObject
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Schedule a crossing check
+	 * @param Owner - UObject implementing the client, used to drop entries for destroyed objects
+	 * @param Serial - Client's current serial for this stat (returned to OnStatThresholdDue)
+	 * @param FireTime - Stat clock time the crossing is predicted at
+	 */
+	void Schedule(UObject* Owner, IStatThresholdClient* Client, EStatType StatType, uint32 Serial, double FireTime);
+
+	/** Stat clock: server world time (clients: the replicated server clock) */
+	static double GetClockTime(const UWorld* World);
+
+	/** Number of queued entries (including superseded ones not yet compacted) */
+	int32 GetNumScheduled() const { return Queue.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FScheduledCrossing
+	{
+		double FireTime = 0.0;
+		TWeakObjectPtr<UObject> Owner;
+		IStatThresholdClient* Client = nullptr;
+		EStatType StatType = EStatType::Health_Core;
+		uint32 Serial = 0;
+	};
+
+	/** Min-heap order on FireTime */
+	struct FEarliestFirst
+	{
+		bool operator()(const FScheduledCrossing& A, const FScheduledCrossing& B) const
+		{
+			return A.FireTime < B.FireTime;
+		}
+	};
+
+	/** Drop entries for destroyed owners or superseded serials */
+	void Compact();
+
+	/** Binary min-heap on FireTime */
+	TArray<FScheduledCrossing> Queue;
+
+	/** Entries due this tick (dispatched after popping, so callbacks can reschedule safely) */
+	TArray<FScheduledCrossing> DueScratch;
+
+	/** Queue size that triggers the next compaction */
+	int32 CompactThreshold = 256;
+};
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StatLayer/StatTypes.h"
+
+/**
+ * Whole-component stat aggregates, maintained as stats change
+ *
+ * Holds each present stat's percentage plus the running sum, the critical
+ * bitmask and the lowest / highest slot. Set() and Remove() are O(1); the
+ * lowest / highest slot is only rescanned (over the cached percentages) when
+ * the current extreme moves away from the edge.
+ *
+ * Tie-breaking and defaults match a full scan in slot order: lowest counts only
+ * stats below 100%, highest only stats above 0%, otherwise Health_Core.
+ */
+class STATSYSTEMPRO_API FStatAggregates
+{
+public:
+	FStatAggregates();
+
+	/** Forget every stat */
+	void Reset();
+
+	/** Record a stat's current percentage (adds it if new) */
+	void Set(EStatType StatType, float Percentage);
+
+	/** Forget one stat */
+	void Remove(EStatType StatType);
+
+	/** Threshold for the critical mask (recomputes it only if the threshold changed) */
+	void SetCriticalThreshold(float Threshold);
+
+	/** Number of stats recorded */
+	int32 Num() const { return FMath::CountBits(PresentMask); }
+
+	/** Mean percentage (1.0 if empty) */
+	float GetAverage() const;
+
+	/** Lowest percentage below 100% (Health_Core / 1.0 if none) */
+	EStatType GetLowest(float& OutPercentage) const;
+
+	/** Highest percentage above 0% (Health_Core / 0.0 if none) */
+	EStatType GetHighest(float& OutPercentage) const;
+
+	/** Is any stat below the critical threshold? */
+	bool IsAnyCritical() const { return CriticalMask != 0; }
+
+	/** Bit N set = stat N is below the critical threshold */
+	uint32 GetCriticalMask() const { return CriticalMask; }
+
+	/** Number of stats below a percentage (popcount for the critical threshold, otherwise a scan of the cached percentages) */
+	int32 CountBelow(float Threshold) const;
+
+	/**
+	 * Debug: compare against a full recomputation
+	 * @return true if every aggregate matches
+	 */
+	bool Matches(const FStatAggregates& Expected) const;
+
+private:
+	void RescanLowest() const;
+	void RescanHighest() const;
+
+	/** Cached percentage per slot (valid where PresentMask is set) */
+	float Percentages[StatSlots::Capacity];
+
+	uint32 PresentMask;
+	uint32 CriticalMask;
+	float CriticalThreshold;
+
+	/** Running sum of the present percentages */
+	double Sum;
+
+	/** Current extremes (INDEX_NONE = rescan on next read) */
+	mutable int32 LowestIndex;
+	mutable int32 HighestIndex;
+};
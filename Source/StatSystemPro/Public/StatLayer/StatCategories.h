@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StatLayer/StatTypes.h"
+
+/**
+ * Range over the stats set in a slot bitmask, in slot order - no allocation
+ *
+ * EXAMPLE:
+ * for (EStatType StatType : FStatMaskView(StatCategories::GetMask(EStatCategory::Survival)))
+ */
+class FStatMaskView
+{
+public:
+	class FIterator
+	{
+	public:
+		explicit FIterator(uint32 InMask)
+			: Mask(InMask)
+		{
+		}
+
+		FORCEINLINE EStatType operator*() const
+		{
+			return (EStatType)FMath::CountTrailingZeros(Mask);
+		}
+
+		FORCEINLINE FIterator& operator++()
+		{
+			Mask &= Mask - 1;
+			return *this;
+		}
+
+		FORCEINLINE bool operator!=(const FIterator& Other) const
+		{
+			return Mask != Other.Mask;
+		}
+
+	private:
+		uint32 Mask;
+	};
+
+	explicit FStatMaskView(uint32 InMask)
+		: Mask(InMask)
+	{
+	}
+
+	FIterator begin() const { return FIterator(Mask); }
+	FIterator end() const { return FIterator(0); }
+
+	/** Number of stats in the view */
+	int32 Num() const { return FMath::CountBits(Mask); }
+
+	bool IsEmpty() const { return Mask == 0; }
+
+	uint32 GetMask() const { return Mask; }
+
+private:
+	uint32 Mask;
+};
+
+/**
+ * Compile-time stat -> category tables (bit N = slot N)
+ */
+namespace StatCategories
+{
+	constexpr uint32 Bit(EStatType StatType)
+	{
+		return 1u << (uint32)StatType;
+	}
+
+	/** Built-in stats of each category, indexed by EStatCategory */
+	constexpr uint32 BuiltInMasks[(int32)EStatCategory::MAX] =
+	{
+		// Core
+		Bit(EStatType::Health_Core) | Bit(EStatType::Stamina) | Bit(EStatType::Energy),
+
+		// Survival
+		Bit(EStatType::Hunger) | Bit(EStatType::Thirst) | Bit(EStatType::Fatigue),
+
+		// Environmental
+		Bit(EStatType::BodyTemperature) | Bit(EStatType::Wetness),
+
+		// HealthConditions
+		Bit(EStatType::HeartRate) | Bit(EStatType::BloodLevel) | Bit(EStatType::BloodPressure)
+			| Bit(EStatType::Sanity) | Bit(EStatType::Infection_Level) | Bit(EStatType::Toxicity),
+
+		// RPGAttributes
+		Bit(EStatType::Strength) | Bit(EStatType::Dexterity) | Bit(EStatType::Intelligence) | Bit(EStatType::Endurance),
+
+		// All
+		(1u << StatSlots::NumBuiltIn) - 1
+	};
+
+	static_assert((int32)EStatCategory::All == 5 && (int32)EStatCategory::MAX == 6, "Update BuiltInMasks when EStatCategory changes");
+	static_assert((BuiltInMasks[0] | BuiltInMasks[1] | BuiltInMasks[2] | BuiltInMasks[3] | BuiltInMasks[4]) == BuiltInMasks[5],
+		"Every built-in stat must belong to a category");
+
+	/** Built-in stats of a category */
+	constexpr uint32 GetBuiltInMask(EStatCategory Category)
+	{
+		return (int32)Category < (int32)EStatCategory::MAX ? BuiltInMasks[(int32)Category] : 0;
+	}
+
+	/** Built-in and registered custom stats of a category */
+	STATSYSTEMPRO_API uint32 GetMask(EStatCategory Category);
+
+	/** Which category a stat belongs to (EStatCategory::MAX if none) */
+	STATSYSTEMPRO_API EStatCategory GetCategory(EStatType StatType);
+
+	/** Bitmask of a list of stats */
+	inline uint32 MakeMask(TConstArrayView<EStatType> StatTypes)
+	{
+		uint32 Mask = 0;
+		for (EStatType StatType : StatTypes)
+		{
+			if ((int32)StatType < StatSlots::Capacity)
+			{
+				Mask |= Bit(StatType);
+			}
+		}
+		return Mask;
+	}
+}
@@ -6,6 +6,16 @@
 #include "Components/ActorComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "StatLayer/StatTypes.h"
+#include "StatLayer/StatContainer.h"
+#include "StatLayer/StatEventDispatcher.h"
+#include "StatLayer/StatModifierAggregator.h"
+#include "StatLayer/StatCategories.h"
+#include "StatLayer/StatAggregates.h"
+#include "Simulation/StatSimulationSubsystem.h"
+#include "Simulation/StatThresholdScheduler.h"
+#include "Simulation/StatEventBatchSubsystem.h"
+#include "Simulation/StatChangeJournal.h"
+#include "Simulation/StatFixedStep.h"
 #include "StatComponent.generated.h"
 
 // Delegates for stat events
@@ -47,7 +57,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatCritical, EStatType, StatTyp
  * - Memory efficient
  */
 UCLASS(ClassGroup=(StatSystemPro), meta=(BlueprintSpawnableComponent, DisplayName="Stat Component (Simple & Powerful)"))
-class STATSYSTEMPRO_API UStatComponent : public UActorComponent
+class STATSYSTEMPRO_API UStatComponent : public UActorComponent, public IStatSimulationClient, public IStatThresholdClient, public IStatEventBatchClient
 {
 	GENERATED_BODY()
 
@@ -56,11 +66,46 @@ public:
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
+	// IStatSimulationClient
+	virtual FStatContainer& GetSimulatedStats() override { return Stats; }
+	virtual bool ShouldSimulateStats() const override { return bEnabled && bEnableAutoRegeneration; }
+	virtual float GetSimulationCriticalThreshold() const override { return CriticalThreshold; }
+	virtual void OnSimulatedStatChanged(EStatType StatType, float OldValue, float NewValue) override;
+	virtual void OnSimulatedStatCrossedThreshold(EStatType StatType, float OldValue, float NewValue) override;
+	virtual void PostStatSimulation() override;
+
+	// IStatThresholdClient
+	virtual void OnStatThresholdDue(EStatType StatType, uint32 Serial) override;
+	virtual bool IsStatThresholdScheduleCurrent(EStatType StatType, uint32 Serial) const override;
+
+	// IStatEventBatchClient
+	virtual void FlushBatchedStatEvents() override;
+
+	/**
+	 * Tell the stat simulation subsystem that regeneration rates/curves changed
+	 * C++: Call after writing Stats directly (e.g. restoring from a save)
+	 */
+	void MarkStatSimulationDirty();
+
+	/**
+	 * Restart lazy evaluation clocks at the current time (or turn lazy stats back into ticked ones)
+	 * C++: Call after writing Stats directly (e.g. restoring from a save) - values are taken as current
+	 */
+	void ResetLazyEvaluation();
+
+	/**
+	 * Fold elapsed lazy regeneration into every lazy stat and pick up the current regen settings
+	 * C++: Call after toggling bEnabled or bEnableAutoRegeneration
+	 */
+	void RebaseLazyStats();
+
 	// ========== CONFIGURATION ==========
 
 	/**
@@ -94,6 +139,38 @@ public:
 	))
 	bool bEnableAutoRegeneration;
 
+	/**
+	 * Evaluate flat-rate stats lazily instead of every tick
+	 * BLUEPRINT: Turn ON for idle NPCs - stats store (value, rate, time) and are computed when read
+	 * MULTIPLAYER: Clients evaluate with the server clock, so only mutations replicate
+	 *
+	 * NOTES:
+	 * - Stats with a regeneration curve are still updated every tick
+	 * - OnStatReachedZero/Max/Critical fire once when the drift crosses them (scheduled, not polled)
+	 * - OnStatChanged fires on mutations and threshold crossings, not every tick
+	 * - Call RebaseLazyStats() after toggling Enabled or Auto Regeneration from code
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stat System|Configuration", meta=(
+		DisplayName = "Lazy Evaluation",
+		Tooltip = "Compute flat-rate stats on read instead of every tick. The component stops ticking when no stat needs it."
+	))
+	bool bUseLazyEvaluation;
+
+	/**
+	 * Coalesce stat changes into one "On Stats Changed (Batched)" event per frame
+	 * BLUEPRINT: Turn ON and bind UI to the batched event instead of On Any Stat Changed
+	 *
+	 * NOTES:
+	 * - Each stat appears once per batch: value before its first change, value after its last
+	 * - The batch is emitted at the end of the frame, after all actors have ticked
+	 * - On Any Stat Changed and the other per-change events still fire as before
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stat System|Events", meta=(
+		DisplayName = "Batch Stat Change Events",
+		Tooltip = "Accumulate stat changes during the frame and emit them once at the end of the frame."
+	))
+	bool bBatchStatChangeEvents;
+
 	/**
 	 * Critical threshold percentage (0.0 - 1.0)
 	 * BLUEPRINT: When any stat falls below this, OnStatCritical event fires
@@ -121,13 +198,16 @@ public:
 	/**
 	 * All stat values - READ ONLY
 	 * BLUEPRINT: Use Get/Set functions instead of accessing this directly
-	 * MULTIPLAYER: Replicated to all clients automatically
+	 * MULTIPLAYER: Replicated to all clients automatically - only changed stats are sent,
+	 *              compressed per stat (see ReplicationQuantization in FStatConfigRow)
+	 * PERFORMANCE: Dense enum-indexed storage - lookups are an array index, not a hash
+	 * LAZY EVALUATION: Lazy stats store their value at LazyTimestamp here - getters return the live value
 	 */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Stats, Category = "Stat System|Stats", meta=(
 		DisplayName = "Current Stats (Read Only)",
 		Tooltip = "All current stat values. Use getter functions for safe access."
 	))
-	TMap<EStatType, FStatValue> Stats;
+	FStatContainer Stats;
 
 	// ========== EVENTS (Blueprint Assignable) ==========
 
@@ -142,6 +222,17 @@ public:
 	))
 	FOnStatChanged OnStatChanged;
 
+	/**
+	 * Fires once per frame with every stat that changed (Batch Stat Change Events only)
+	 * BLUEPRINT: Refresh UI once per frame instead of once per change
+	 * MULTIPLAYER: Fires on all clients when replicated
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Stat System|Events", meta=(
+		DisplayName = "On Stats Changed (Batched)",
+		Tooltip = "Fires at end of frame with all stats that changed: StatType, first OldValue, last NewValue and reasons"
+	))
+	FOnStatsChangedBatch OnStatsChangedBatch;
+
 	/**
 	 * Fires when a stat's maximum value changes
 	 * BLUEPRINT: Use this to update UI when max health changes, etc.
@@ -156,6 +247,7 @@ public:
 	 * Fires when any stat reaches zero (death, exhaustion, etc.)
 	 * BLUEPRINT: Perfect for death logic, stamina depletion, etc.
 	 * MULTIPLAYER: Fires on all clients
+	 * Fires once per edge - not again until the stat has left zero
 	 */
 	UPROPERTY(BlueprintAssignable, Category = "Stat System|Events", meta=(
 		DisplayName = "On Stat Reached Zero",
@@ -166,6 +258,7 @@ public:
 	/**
 	 * Fires when any stat reaches its maximum
 	 * BLUEPRINT: Use for fully rested, fully fed events, etc.
+	 * Fires once per edge - not again until the stat has dropped below max
 	 */
 	UPROPERTY(BlueprintAssignable, Category = "Stat System|Events", meta=(
 		DisplayName = "On Stat Reached Max",
@@ -176,6 +269,7 @@ public:
 	/**
 	 * Fires when any stat falls below critical threshold
 	 * BLUEPRINT: Use for warning UI, critical state changes
+	 * Fires once per edge - not every frame while the stat stays critical
 	 */
 	UPROPERTY(BlueprintAssignable, Category = "Stat System|Events", meta=(
 		DisplayName = "On Stat Critical",
@@ -183,6 +277,30 @@ public:
 	))
 	FOnStatCritical OnStatCritical;
 
+	// ========== NATIVE EVENTS (C++ only) ==========
+
+	/**
+	 * Subscribe a native delegate to one event of one stat
+	 * C++: Only that stat's listeners are invoked - prefer this over binding On Any Stat Changed and filtering
+	 * Fires alongside the Blueprint events. Keep the returned handle to unsubscribe.
+	 */
+	FStatEventSubscription SubscribeToStatEvent(EStatType StatType, EStatEventKind Kind, FStatNativeEventDelegate Delegate)
+	{
+		return NativeStatEvents.Subscribe(StatType, Kind, MoveTemp(Delegate));
+	}
+
+	/** Remove a native subscription (resets the handle) */
+	bool UnsubscribeFromStatEvent(FStatEventSubscription& Subscription)
+	{
+		return NativeStatEvents.Unsubscribe(Subscription);
+	}
+
+	/** Remove every native subscription bound to UserObject */
+	void UnsubscribeAllStatEvents(const void* UserObject)
+	{
+		NativeStatEvents.UnsubscribeAll(UserObject);
+	}
+
 	// ========== INITIALIZATION ==========
 
 	/**
@@ -226,6 +344,33 @@ public:
 	))
 	void ApplyStatChange(EStatType StatType, float Amount, FName Source, FGameplayTag ReasonTag);
 
+	/**
+	 * C++: Apply several changes at once (explosions, food items, hazards)
+	 * Changes to the same stat are summed and clamped once, and each touched stat
+	 * broadcasts one set of events carrying every reason given for it
+	 *
+	 * EXAMPLE:
+	 * const FStatDelta Deltas[] = { { EStatType::Hunger, 30.0f, TEXT("Food") }, { EStatType::Thirst, 10.0f, TEXT("Food") } };
+	 * StatComponent->ApplyStatChanges(Deltas);
+	 */
+	void ApplyStatChanges(TConstArrayView<FStatDelta> Deltas);
+
+	/**
+	 * Apply several stat changes at once
+	 * BLUEPRINT: Use instead of several "Change Stat" calls in a row
+	 * MULTIPLAYER: Server authority, auto-replicated
+	 *
+	 * HOW IT WORKS:
+	 * - Changes to the same stat are added together, then clamped once
+	 * - Each changed stat fires its events once
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stat System|Modification", meta=(
+		DisplayName = "Change Multiple Stats",
+		Tooltip = "Apply several stat changes at once. Changes to the same stat are added together and fire one set of events.",
+		Keywords = "add subtract damage heal bulk batch multiple"
+	))
+	void ApplyStatChangesArray(const TArray<FStatDelta>& Deltas);
+
 	/**
 	 * Set a stat to an exact value (overrides current)
 	 * BLUEPRINT: Use when you need precise control
@@ -279,6 +424,63 @@ public:
 	))
 	void SetStatRegenerationRate(EStatType StatType, float Rate);
 
+	// ========== STAT MODIFIERS ==========
+
+	/**
+	 * Add a persistent modifier to a stat's max value or regeneration rate
+	 * BLUEPRINT: Keep the returned handle - update it when the effect changes, remove it when it ends
+	 * MULTIPLAYER: Call on server, the resulting values replicate
+	 *
+	 * HOW IT WORKS:
+	 * - Final = (Base + all Additive) * all Multiplicative
+	 * - Max Value base = the stat's Base Max Value
+	 * - Regeneration Rate base = the rate set with Set Regeneration Rate
+	 * - Values are recomputed only when a modifier is added, changed or removed
+	 *
+	 * @param Source - Optional owner name, for Remove Stat Modifiers From Source
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stat System|Modifiers", meta=(
+		DisplayName = "Add Stat Modifier",
+		Tooltip = "Add a flat or multiplier modifier to a stat's max value or regen rate. Returns a handle to update or remove it.",
+		Keywords = "buff debuff modifier multiplier bonus"
+	))
+	FStatModifierHandle AddStatModifier(EStatType StatType, EStatModifierTarget Target, EStatModifierOp Op, float Magnitude, FName Source);
+
+	/**
+	 * Change a modifier's magnitude
+	 * BLUEPRINT: Call whenever the effect's strength changes - nothing is recomputed if it didn't
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stat System|Modifiers", meta=(
+		DisplayName = "Update Stat Modifier",
+		Tooltip = "Change the magnitude of an existing modifier. Returns false if the handle is no longer valid."
+	))
+	bool UpdateStatModifier(FStatModifierHandle Handle, float NewMagnitude);
+
+	/**
+	 * Remove a modifier (the handle is invalidated)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stat System|Modifiers", meta=(
+		DisplayName = "Remove Stat Modifier",
+		Tooltip = "Remove a modifier and restore the stat's value. Returns false if the handle was not valid."
+	))
+	bool RemoveStatModifier(UPARAM(ref) FStatModifierHandle& Handle);
+
+	/**
+	 * Remove every modifier added with a source name
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stat System|Modifiers", meta=(
+		DisplayName = "Remove Stat Modifiers From Source",
+		Tooltip = "Remove all modifiers added with this source name. Returns how many were removed."
+	))
+	int32 RemoveStatModifiersFromSource(FName Source);
+
+	/**
+	 * C++: Defer recomputing modified stats until the matching EndStatModifierBatch (nestable)
+	 * Use when replacing a set of modifiers, so stats never see the intermediate values
+	 */
+	void BeginStatModifierBatch();
+	void EndStatModifierBatch();
+
 	// ========== GETTERS - SIMPLE (Most Used) ==========
 
 	/**
@@ -298,6 +500,21 @@ public:
 	))
 	float GetStatValue(EStatType StatType) const;
 
+	/**
+	 * Get a stat's value smoothed between simulation steps
+	 * BLUEPRINT: Use for bars and numbers on screen when Fixed Timestep is on
+	 * MULTIPLAYER: Server only smooths; clients get the replicated value
+	 *
+	 * RETURNS: Regenerating stats blend from the previous step's value to the latest one
+	 * (one step behind). Other stats, and everything with Fixed Timestep off, read as Get Stat Value.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Stat System|Getters|Basic", meta=(
+		DisplayName = "Get Interpolated Stat Value",
+		Tooltip = "Stat value blended between fixed simulation steps, for smooth UI",
+		Keywords = "get value smooth interpolated display ui"
+	))
+	float GetInterpolatedStatValue(EStatType StatType) const;
+
 	/**
 	 * Get maximum value of a stat
 	 * BLUEPRINT: Use for UI bars, percentage calculations
@@ -447,6 +664,17 @@ public:
 
 	// ========== BULK OPERATIONS ==========
 
+	/**
+	 * Get all stats as a map (compatibility view)
+	 * BLUEPRINT: For code that used to read the Stats map directly
+	 */
+	UFUNCTION(BlueprintPure, Category = "Stat System|Getters|Bulk", meta=(
+		DisplayName = "Get All Stats (Map)",
+		Tooltip = "Get a copy of every tracked stat as a map. Prefer the per-stat getters in hot paths.",
+		Keywords = "get all stats map dictionary"
+	))
+	TMap<EStatType, FStatValue> GetStatsMap() const;
+
 	/**
 	 * Get all stat names that exist
 	 * BLUEPRINT: For UI lists, debug displays
@@ -495,6 +723,14 @@ public:
 	))
 	TArray<EStatType> GetStatsInCategory(EStatCategory Category) const;
 
+	/**
+	 * C++: Present stats in a category, without allocating (use every frame, e.g. in HUD code)
+	 *
+	 * EXAMPLE:
+	 * for (EStatType StatType : StatComponent->GetPresentStatsInCategory(EStatCategory::Survival))
+	 */
+	FStatMaskView GetPresentStatsInCategory(EStatCategory Category) const;
+
 	/**
 	 * Check if ANY stat in a category is critical
 	 * BLUEPRINT: Select category from dropdown - no typing!
@@ -753,19 +989,165 @@ private:
 	 */
 	void UpdateStatRegeneration(float DeltaTime);
 
+	/** Lowest / highest percentage among the present stats of a slot mask */
+	EStatType GetLowestStatInMask(uint32 StatMask, float& OutPercentage) const;
+	EStatType GetHighestStatInMask(uint32 StatMask, float& OutPercentage) const;
+
 	/**
 	 * Broadcast appropriate events for stat changes
 	 */
-	void BroadcastStatEvents(EStatType StatType, float OldValue, float NewValue);
+	void BroadcastStatEvents(EStatType StatType, float OldValue, float NewValue, TConstArrayView<FStatChangeReason> Reasons = TConstArrayView<FStatChangeReason>());
 
 	/**
-	 * Replication callback for stats map
+	 * Broadcast OnStatChanged and add the change to this frame's batch
+	 */
+	void NotifyStatChanged(EStatType StatType, float OldValue, float NewValue, TConstArrayView<FStatChangeReason> Reasons = TConstArrayView<FStatChangeReason>());
+
+	/**
+	 * Re-evaluate a stat's zero/max/critical state, broadcast entered states once,
+	 * and reschedule its next predicted crossing
+	 */
+	void UpdateThresholdEdges(EStatType StatType, bool bBroadcast = true);
+
+	/**
+	 * Replication callback for stats - broadcasts each received stat with its real old value
 	 */
 	UFUNCTION()
 	void OnRep_Stats();
 
 	/**
-	 * Check for critical stats and fire events
+	 * Hand regeneration over to the world's stat simulation subsystem (server only)
+	 */
+	void RegisterWithStatSimulation();
+
+	/** Subsystem driving our regeneration (null = we tick ourselves) */
+	UPROPERTY(Transient)
+	UStatSimulationSubsystem* StatSimulation;
+
+	/** Registration handle with StatSimulation */
+	int32 StatSimulationHandle;
+
+	// ========== LAZY EVALUATION ==========
+
+	/** Server world time used for lazy stats (clients use the replicated server clock) */
+	double GetStatClockTime() const;
+
+	/** Rate a lazy stat drifts at under the current settings */
+	float GetLazyRate(const FStatValue& Stat) const;
+
+	/** Stat as of now - evaluates lazy stats, returns others unchanged */
+	FStatValue GetLiveStat(const FStatValue& Stat) const;
+
+	/** Current value as of now - evaluates lazy stats */
+	float GetLiveValue(const FStatValue& Stat) const;
+
+	/** Bring a lazy stat up to date before mutating it */
+	void RebaseLazyStat(FStatValue& Stat);
+
+	/** Enable ticking only if something still needs it */
+	void UpdateTickEnabled();
+
+	// ========== THRESHOLD EDGES ==========
+
+	/** Push a lazy stat's next predicted zero/max/critical crossing to the world scheduler */
+	void ScheduleThresholdCrossing(EStatType StatType);
+
+	/** World scheduler for predicted crossings (server only) */
+	UPROPERTY(Transient)
+	UStatThresholdScheduler* ThresholdScheduler;
+
+	// ========== CHANGE JOURNAL ==========
+
+	/** Append a reasoned change to the world's change journal */
+	void JournalStatChange(EStatType StatType, float Amount, float NewValue, FName Source, FGameplayTag ReasonTag);
+
+	/** World change journal (null outside game worlds) */
+	UPROPERTY(Transient)
+	UStatChangeJournalSubsystem* ChangeJournal;
+
+	/** Bit N set = stat N is at zero / at max / critical and has been reported */
+	uint32 ZeroEdgeMask;
+	uint32 MaxEdgeMask;
+	uint32 CriticalEdgeMask;
+
+	/** Per-stat schedule serial - bumping it supersedes the queued entry */
+	uint32 ThresholdSerials[FStatContainer::Capacity];
+
+	/** Per-stat queued crossing time (< 0 = nothing queued) */
+	double ThresholdFireTimes[FStatContainer::Capacity];
+
+	// ========== BATCHED EVENTS ==========
+
+	/** Changes accumulated this frame, one record per stat */
+	TArray<FStatChangeRecord> PendingStatChanges;
+
+	/** Index into PendingStatChanges per stat (INDEX_NONE = unchanged this frame) */
+	int32 PendingStatChangeIndices[FStatContainer::Capacity];
+
+	/** Already queued with the batch subsystem this frame */
+	bool bStatChangeFlushQueued;
+
+	/** Native per-stat listeners (SubscribeToStatEvent) */
+	FStatEventDispatcher NativeStatEvents;
+
+	// ========== STAT MODIFIERS ==========
+
+	/** Write a stat's regen rate (shared by SetStatRegenerationRate and modifiers) */
+	void ApplyRegenerationRate(EStatType StatType, float Rate);
+
+	/** Recompute one modified value and write it to the stat if it changed (deferred inside a batch) */
+	void ApplyStatModifiers(EStatType StatType, EStatModifierTarget Target);
+
+	/** Recompute every modified value, e.g. after stats were re-initialized */
+	void ReapplyAllStatModifiers();
+
+	/** Max / regen modifiers per stat */
+	FStatModifierAggregator StatModifiers;
+
+	/** Per target: bit N set = stat N has modifier changes waiting for EndStatModifierBatch */
+	uint32 PendingModifierMasks[(int32)EStatModifierTarget::MAX];
+
+	/** BeginStatModifierBatch nesting depth */
+	int32 StatModifierBatchDepth;
+
+	// ========== AGGREGATES ==========
+
+	/** Re-read one stat's percentage into the aggregates (called wherever its state changes) */
+	void RefreshStatAggregate(EStatType StatType);
+
+	/**
+	 * Bring the aggregates up to date before a read: re-reads stats whose value moves
+	 * without notifications (lazy regen, sub-threshold simulation steps) once per frame
 	 */
-	void CheckCriticalStats();
+	void SyncStatAggregates() const;
+
+	/** Debug: compare the aggregates against a full scan and log mismatches */
+	void ValidateStatAggregates() const;
+
+	/** Lowest / highest / average / critical over every stat, maintained per change */
+	mutable FStatAggregates StatAggregates;
+
+	/** Bit N set = stat N changes between notifications (lazy or regenerating) */
+	uint32 DriftingStatsMask;
+
+	/** Frame the drifting stats were last re-read (MAX_uint64 = stale) */
+	mutable uint64 AggregatesSyncFrame;
+
+	// ========== FIXED TIMESTEP ==========
+
+	/** Record every stat's value at the end of a simulation step (for GetInterpolatedStatValue) */
+	void CaptureStepValues();
+
+	/** Progress (0-1) from the last regen step towards the next */
+	float GetFixedStepAlpha() const;
+
+	/** Frame time -> fixed regen steps (TickComponent path) */
+	FStatFixedStepAccumulator RegenFixedStep;
+
+	/** Values at the end of the last two steps */
+	float PreviousStepValues[FStatContainer::Capacity];
+	float LastStepValues[FStatContainer::Capacity];
+
+	/** Bit N set = stat N has step values */
+	uint32 StepValuesMask;
 };
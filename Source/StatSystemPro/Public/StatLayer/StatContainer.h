@@ -0,0 +1,294 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StatLayer/StatTypes.h"
+#include "StatLayer/StatReplication.h"
+#include "StatContainer.generated.h"
+
+/**
+ * Key/value pair yielded when iterating an FStatContainer
+ * Mirrors TMap's TPair so existing "StatPair.Key / StatPair.Value" loops keep working
+ */
+template<typename ValueType>
+struct TStatContainerEntry
+{
+	EStatType Key;
+	ValueType& Value;
+};
+
+/**
+ * Iterator over the present stats of an FStatContainer (skips absent slots)
+ */
+template<typename ContainerType, typename ValueType>
+class TStatContainerIterator
+{
+public:
+	TStatContainerIterator(ContainerType& InContainer, int32 InIndex)
+		: Container(InContainer)
+		, Index(InIndex)
+	{
+		SkipAbsent();
+	}
+
+	TStatContainerEntry<ValueType> operator*() const
+	{
+		return { (EStatType)Index, Container.Values[Index] };
+	}
+
+	TStatContainerIterator& operator++()
+	{
+		++Index;
+		SkipAbsent();
+		return *this;
+	}
+
+	bool operator!=(const TStatContainerIterator& Other) const
+	{
+		return Index != Other.Index;
+	}
+
+private:
+	void SkipAbsent()
+	{
+		while (Index < ContainerType::Capacity && !Container.ContainsIndex(Index))
+		{
+			++Index;
+		}
+	}
+
+	ContainerType& Container;
+	int32 Index;
+};
+
+/**
+ * Dense, enum-indexed stat storage
+ *
+ * Replaces TMap<EStatType, FStatValue>. EStatType is a contiguous uint8 enum, so every
+ * stat lives at a fixed slot and a presence bitmask tracks which slots are in use.
+ * Custom stats (FStatRegistry) use the slots after the built-in ones.
+ * Lookups are an array index plus a bit test - no hashing.
+ *
+ * C++: Use Find() for a single lookup instead of Contains() followed by operator[].
+ * BLUEPRINT: Use the owning component's "Get All Stats (Map)" for a TMap view.
+ *
+ * MULTIPLAYER: Replicates as a fast array - one quantized item per present stat, and
+ * only items whose quantized values changed are sent. The owning component must call
+ * SyncReplicatedItems() in PreReplication, and ConsumeReplicatedChanges() in its OnRep.
+ */
+USTRUCT(BlueprintType)
+struct STATSYSTEMPRO_API FStatContainer : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	/** Number of slots (built-in stats, then custom stats - see StatSlots) */
+	static constexpr int32 Capacity = StatSlots::Capacity;
+
+	FStatContainer()
+		: PresenceMask(0)
+	{
+		static_assert(Capacity <= 32, "FStatContainer presence mask only holds 32 stats");
+		Values.SetNum(Capacity);
+	}
+
+	/** Check if a stat is present */
+	FORCEINLINE bool Contains(EStatType StatType) const
+	{
+		return ContainsIndex((int32)StatType);
+	}
+
+	/** Check if a slot index is present */
+	FORCEINLINE bool ContainsIndex(int32 Index) const
+	{
+		return Index >= 0 && Index < Capacity && (PresenceMask & (1u << Index)) != 0;
+	}
+
+	/** Get a stat, or nullptr if not present */
+	FORCEINLINE FStatValue* Find(EStatType StatType)
+	{
+		return Contains(StatType) ? &Values[(int32)StatType] : nullptr;
+	}
+
+	/** Get a stat, or nullptr if not present */
+	FORCEINLINE const FStatValue* Find(EStatType StatType) const
+	{
+		return Contains(StatType) ? &Values[(int32)StatType] : nullptr;
+	}
+
+	/** Get a stat that is known to be present */
+	FORCEINLINE FStatValue& operator[](EStatType StatType)
+	{
+		check(Contains(StatType));
+		return Values[(int32)StatType];
+	}
+
+	/** Get a stat that is known to be present */
+	FORCEINLINE const FStatValue& operator[](EStatType StatType) const
+	{
+		check(Contains(StatType));
+		return Values[(int32)StatType];
+	}
+
+	/** Add or replace a stat */
+	FStatValue& Add(EStatType StatType, const FStatValue& Value)
+	{
+		const int32 Index = (int32)StatType;
+		check(Index >= 0 && Index < Capacity);
+		Values[Index] = Value;
+		PresenceMask |= (1u << Index);
+		return Values[Index];
+	}
+
+	/** Remove a stat. Returns true if it was present. */
+	bool Remove(EStatType StatType)
+	{
+		if (!Contains(StatType))
+		{
+			return false;
+		}
+
+		const int32 Index = (int32)StatType;
+		PresenceMask &= ~(1u << Index);
+		Values[Index] = FStatValue();
+		return true;
+	}
+
+	/** Remove all stats */
+	void Empty()
+	{
+		PresenceMask = 0;
+		for (FStatValue& Value : Values)
+		{
+			Value = FStatValue();
+		}
+	}
+
+	/** Number of present stats */
+	FORCEINLINE int32 Num() const
+	{
+		return FMath::CountBits(PresenceMask);
+	}
+
+	/** Raw presence bitmask (bit N = EStatType N) */
+	FORCEINLINE uint32 GetPresenceMask() const
+	{
+		return PresenceMask;
+	}
+
+	/** Heap memory held by the container (slots and replication buffers) */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Values.GetAllocatedSize() + ReplicatedItems.GetAllocatedSize() + ReplicatedChanges.GetAllocatedSize();
+	}
+
+	/** Get all present stat types */
+	void GetKeys(TArray<EStatType>& OutKeys) const
+	{
+		OutKeys.Reset(Num());
+		for (int32 Index = 0; Index < Capacity; ++Index)
+		{
+			if (ContainsIndex(Index))
+			{
+				OutKeys.Add((EStatType)Index);
+			}
+		}
+	}
+
+	/** Build a map copy (Blueprint / save game compatibility) */
+	TMap<EStatType, FStatValue> ToMap() const
+	{
+		TMap<EStatType, FStatValue> Map;
+		Map.Reserve(Num());
+		for (const auto& StatPair : *this)
+		{
+			Map.Add(StatPair.Key, StatPair.Value);
+		}
+		return Map;
+	}
+
+	/** Replace contents from a map (Blueprint / save game compatibility) */
+	void FromMap(const TMap<EStatType, FStatValue>& Map)
+	{
+		Empty();
+		for (const auto& StatPair : Map)
+		{
+			if ((int32)StatPair.Key < Capacity)
+			{
+				Add(StatPair.Key, StatPair.Value);
+			}
+		}
+	}
+
+	// Range-for support: yields { Key, Value } for present stats only
+	using FIterator = TStatContainerIterator<FStatContainer, FStatValue>;
+	using FConstIterator = TStatContainerIterator<const FStatContainer, const FStatValue>;
+
+	FIterator begin() { return FIterator(*this, 0); }
+	FIterator end() { return FIterator(*this, Capacity); }
+	FConstIterator begin() const { return FConstIterator(*this, 0); }
+	FConstIterator end() const { return FConstIterator(*this, Capacity); }
+
+	// ========== REPLICATION ==========
+
+	/** Set how a stat is compressed when replicated (server) */
+	void SetReplicationQuantization(EStatType StatType, const FStatQuantizationSettings& Settings);
+
+	/** Reset every stat to full-precision replication (server) */
+	void ResetReplicationQuantization();
+
+	/**
+	 * Mirror changed stats into the replicated items and mark only those dirty (server)
+	 * Cheap when nothing changed - one quantized compare per present stat
+	 */
+	void SyncReplicatedItems();
+
+	/** Stats updated by the last replication, with their previous values (client) */
+	const TArray<FStatReplicatedChange>& GetReplicatedChanges() const { return ReplicatedChanges; }
+
+	/** Clear the received changes once they've been broadcast (client) */
+	void ConsumeReplicatedChanges() { ReplicatedChanges.Reset(); }
+
+	// FFastArraySerializer contract
+	void PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize);
+	void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
+	void PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FStatReplicatedItem, FStatContainer>(ReplicatedItems, DeltaParms, *this);
+	}
+
+private:
+	template<typename, typename> friend class TStatContainerIterator;
+
+	/** Copy received items into their slots, recording the old values */
+	void ApplyReplicatedItems(const TArrayView<int32>& Indices);
+
+	/** Replicated view of the present stats (the only part sent over the network) */
+	UPROPERTY()
+	TArray<FStatReplicatedItem> ReplicatedItems;
+
+	/** Per-slot replication compression (server) */
+	FStatQuantizationSettings Quantization[Capacity];
+
+	/** Received updates not yet consumed by the owner (client) */
+	TArray<FStatReplicatedChange> ReplicatedChanges;
+
+	/** One slot per EStatType, always Capacity long */
+	UPROPERTY()
+	TArray<FStatValue> Values;
+
+	/** Bit N set = EStatType N is present */
+	UPROPERTY()
+	uint32 PresenceMask;
+};
+
+template<>
+struct TStructOpsTypeTraits<FStatContainer> : public TStructOpsTypeTraitsBase2<FStatContainer>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
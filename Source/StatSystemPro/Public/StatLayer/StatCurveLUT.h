@@ -0,0 +1,103 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UCurveFloat;
+
+/**
+ * Baked lookup table for a regeneration curve
+ *
+ * Samples the curve at fixed steps over X = 0-1 (stat percentage) and linearly
+ * interpolates between them. Replaces a full rich-curve evaluation per stat per tick.
+ */
+struct STATSYSTEMPRO_API FStatCurveLUT
+{
+	/** Curve this table was baked from */
+	TWeakObjectPtr<const UCurveFloat> SourceCurve;
+
+	/** Samples at X = i / (Num - 1), always at least 2 */
+	TArray<float> Samples;
+
+	/** Largest difference from the source curve measured while baking */
+	float MeasuredMaxError = 0.0f;
+
+	/** Evaluate at a stat percentage (0-1, clamped) */
+	FORCEINLINE float Evaluate(float Percentage) const
+	{
+		const int32 LastIndex = Samples.Num() - 1;
+		const float X = FMath::Clamp(Percentage, 0.0f, 1.0f) * LastIndex;
+		const int32 Index = FMath::Min((int32)X, LastIndex - 1);
+		return FMath::Lerp(Samples[Index], Samples[Index + 1], X - Index);
+	}
+};
+
+/**
+ * ============================================================================
+ * STAT CURVE LUT CACHE
+ * ============================================================================
+ *
+ * One baked FStatCurveLUT per UCurveFloat asset, shared by every component using it.
+ *
+ * - Tables are baked on first use (components prewarm them in InitializeStats)
+ * - Resolution and max error come from UStatSystemProSettings; if the error check
+ *   fails, resolution is doubled until it passes or the cap is hit (then warns)
+ * - In editor, tables are rebaked when their curve asset is modified
+ * - Entries for garbage-collected curves are dropped after GC
+ *
+ * Game thread only.
+ */
+class STATSYSTEMPRO_API FStatCurveLUTCache
+{
+public:
+	static FStatCurveLUTCache& Get();
+
+	/** Destroy the cache and unbind engine delegates (module shutdown) */
+	static void Shutdown();
+
+	/** Check if curve LUTs are enabled in project settings */
+	static bool IsEnabled();
+
+	/**
+	 * Get the baked table for a curve, baking it if needed
+	 * Returned pointer stays valid until the curve is garbage collected (rebakes update it in place)
+	 */
+	const FStatCurveLUT* FindOrBake(const UCurveFloat* Curve);
+
+	/**
+	 * Evaluate a regeneration curve at a stat percentage
+	 * Uses the baked table if LUTs are enabled, otherwise the curve itself
+	 */
+	float Evaluate(const UCurveFloat* Curve, float Percentage);
+
+	/** Rebake tables whose curves were modified (no-op when nothing changed) */
+	void RebakeModified();
+
+	/** Incremented whenever tables are freed - cached FStatCurveLUT pointers are invalid after a change */
+	uint32 GetGeneration() const { return Generation; }
+
+	~FStatCurveLUTCache();
+
+private:
+	FStatCurveLUTCache();
+
+	/** Sample Curve into OutLUT and run the max-error check */
+	static void Bake(const UCurveFloat* Curve, FStatCurveLUT& OutLUT);
+
+	void HandlePostGarbageCollect();
+
+#if WITH_EDITOR
+	void HandleObjectModified(UObject* Object);
+	void HandleObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& PropertyChangedEvent);
+#endif
+
+	/** Heap-allocated so returned pointers survive map growth */
+	TMap<FObjectKey, TUniquePtr<FStatCurveLUT>> Tables;
+
+	/** Curves modified in editor since the last RebakeModified */
+	TSet<FObjectKey> ModifiedCurves;
+
+	uint32 Generation = 0;
+};
@@ -0,0 +1,119 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StatLayer/StatTypes.h"
+
+/**
+ * Stat event kinds for native subscriptions (mirror the Blueprint stat events)
+ */
+enum class EStatEventKind : uint8
+{
+	/** Value changed: OldValue -> NewValue */
+	Changed,
+
+	/** Max changed: OldValue = previous max, NewValue = new max */
+	MaxChanged,
+
+	/** Reached zero: OldValue = NewValue = current value */
+	ReachedZero,
+
+	/** Reached max: OldValue = NewValue = current value */
+	ReachedMax,
+
+	/** Fell below the critical threshold: OldValue = NewValue = current value */
+	Critical,
+
+	MAX
+};
+
+/** Native stat event listener: (StatType, OldValue, NewValue) - see EStatEventKind for the values passed */
+DECLARE_DELEGATE_ThreeParams(FStatNativeEventDelegate, EStatType /*StatType*/, float /*OldValue*/, float /*NewValue*/);
+
+/**
+ * Handle returned by a native stat event subscription
+ * Pass it back to unsubscribe
+ */
+struct FStatEventSubscription
+{
+	EStatType StatType = EStatType::Health_Core;
+	EStatEventKind Kind = EStatEventKind::Changed;
+	FDelegateHandle Handle;
+
+	bool IsValid() const
+	{
+		return Handle.IsValid();
+	}
+
+	void Reset()
+	{
+		Handle.Reset();
+	}
+};
+
+/**
+ * ============================================================================
+ * STAT EVENT DISPATCHER - Native Per-Stat Subscriptions
+ * ============================================================================
+ *
+ * C++ counterpart to the components' dynamic multicast stat events. Listeners
+ * register for one (stat, event kind) pair, so a broadcast only invokes the
+ * listeners of that stat - no reflection, and no filtering on EStatType.
+ *
+ * Listener lists are allocated on the first subscription; a component nobody
+ * subscribes to pays one bit test per event.
+ */
+class STATSYSTEMPRO_API FStatEventDispatcher
+{
+public:
+	/** Register a listener for one event of one stat */
+	FStatEventSubscription Subscribe(EStatType StatType, EStatEventKind Kind, FStatNativeEventDelegate&& Delegate);
+
+	/** Remove a listener. Resets the subscription. Returns true if it was registered. */
+	bool Unsubscribe(FStatEventSubscription& Subscription);
+
+	/** Remove every listener bound to UserObject (e.g. in the listener's destructor / EndPlay) */
+	void UnsubscribeAll(const void* UserObject);
+
+	/** Invoke the listeners of one (stat, event kind) */
+	FORCEINLINE void Broadcast(EStatType StatType, EStatEventKind Kind, float OldValue, float NewValue)
+	{
+		if (SubscribedMask[(int32)Kind] & (1u << (uint32)StatType))
+		{
+			GetListeners(StatType, Kind).Broadcast(StatType, OldValue, NewValue);
+		}
+	}
+
+	/** Is anyone listening for this (stat, event kind)? */
+	FORCEINLINE bool HasListeners(EStatType StatType, EStatEventKind Kind) const
+	{
+		return (SubscribedMask[(int32)Kind] & (1u << (uint32)StatType)) != 0;
+	}
+
+	/** Heap memory held by the listener lists (zero until the first Subscribe) */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Listeners.GetAllocatedSize();
+	}
+
+private:
+	using FListeners = TMulticastDelegate<void(EStatType, float, float)>;
+
+	static constexpr int32 NumStats = StatSlots::Capacity;
+	static constexpr int32 NumKinds = (int32)EStatEventKind::MAX;
+
+	FORCEINLINE FListeners& GetListeners(EStatType StatType, EStatEventKind Kind)
+	{
+		return Listeners[(int32)Kind * NumStats + (int32)StatType];
+	}
+
+	/** Recompute the subscribed bit for one (stat, event kind) */
+	void UpdateSubscribedBit(EStatType StatType, EStatEventKind Kind);
+
+	/** One listener list per (event kind, stat), allocated on first Subscribe */
+	TArray<FListeners> Listeners;
+
+	/** Per event kind: bit N set = stat N has listeners */
+	uint32 SubscribedMask[NumKinds] = {};
+};
@@ -0,0 +1,154 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StatLayer/StatTypes.h"
+#include "StatModifierAggregator.generated.h"
+
+/**
+ * Which stat value a modifier changes
+ */
+UENUM(BlueprintType)
+enum class EStatModifierTarget : uint8
+{
+	/** Max value (applied on top of the stat's Base Max Value) */
+	MaxValue UMETA(DisplayName = "Max Value"),
+
+	/** Regeneration rate per second (applied on top of the unmodified rate) */
+	RegenerationRate UMETA(DisplayName = "Regeneration Rate"),
+
+	MAX UMETA(Hidden)
+};
+
+/**
+ * How a modifier combines with the base value
+ * Final = (Base + sum of Additive) * product of Multiplicative
+ */
+UENUM(BlueprintType)
+enum class EStatModifierOp : uint8
+{
+	/** Added to the base value (e.g. +20 max health) */
+	Additive UMETA(DisplayName = "Additive (Flat)"),
+
+	/** Multiplies the total (e.g. 0.5 = half max health) */
+	Multiplicative UMETA(DisplayName = "Multiplicative")
+};
+
+/**
+ * Handle to a stat modifier - keep it to update or remove the modifier
+ * BLUEPRINT: Store in a variable, pass to Update/Remove Stat Modifier
+ */
+USTRUCT(BlueprintType)
+struct STATSYSTEMPRO_API FStatModifierHandle
+{
+	GENERATED_BODY()
+
+	/** Unique per component (0 = invalid) */
+	UPROPERTY()
+	int32 Id;
+
+	UPROPERTY()
+	EStatType StatType;
+
+	UPROPERTY()
+	EStatModifierTarget Target;
+
+	FStatModifierHandle()
+		: Id(0)
+		, StatType(EStatType::Health_Core)
+		, Target(EStatModifierTarget::MaxValue)
+	{
+	}
+
+	bool IsValid() const
+	{
+		return Id != 0;
+	}
+
+	void Invalidate()
+	{
+		Id = 0;
+	}
+};
+
+/**
+ * Per-stat modifier aggregation with cached results
+ *
+ * Each (stat, target) pair keeps its modifiers plus a cached flat sum and
+ * multiplier product. Adding, updating or removing a modifier marks only that
+ * pair dirty; the cache is rebuilt from its own modifiers the next time it is
+ * evaluated. Layers register a modifier once and update it when their input
+ * changes, instead of recomputing and re-setting stat values every tick.
+ *
+ * Storage is allocated on the first modifier.
+ */
+class STATSYSTEMPRO_API FStatModifierAggregator
+{
+public:
+	/** Add a modifier. Returns its handle. */
+	FStatModifierHandle Add(EStatType StatType, EStatModifierTarget Target, EStatModifierOp Op, float Magnitude, FName Source);
+
+	/** Change a modifier's magnitude. Returns false if the handle is stale. Only dirties if the value changed. */
+	bool Update(const FStatModifierHandle& Handle, float NewMagnitude);
+
+	/** Remove a modifier. Returns false if the handle is stale. */
+	bool Remove(const FStatModifierHandle& Handle);
+
+	/**
+	 * Remove every modifier from a source
+	 * @param OutDirtyMasks - Per target, bit N set = stat N lost a modifier
+	 */
+	int32 RemoveBySource(FName Source, uint32 (&OutDirtyMasks)[(int32)EStatModifierTarget::MAX]);
+
+	/** Does this (stat, target) have any modifiers? */
+	bool HasModifiers(EStatType StatType, EStatModifierTarget Target) const;
+
+	/** Apply the (cached) modifiers to a base value. Rebuilds the cache first if dirty. */
+	float Evaluate(EStatType StatType, EStatModifierTarget Target, float BaseValue);
+
+	/** Unmodified regeneration rate, kept while regen modifiers exist */
+	float GetBaseRegenerationRate(EStatType StatType) const;
+	void SetBaseRegenerationRate(EStatType StatType, float Rate);
+
+	/** Remove everything */
+	void Reset();
+
+private:
+	struct FModifier
+	{
+		int32 Id = 0;
+		EStatModifierOp Op = EStatModifierOp::Additive;
+		float Magnitude = 0.0f;
+		FName Source;
+	};
+
+	struct FAggregate
+	{
+		TArray<FModifier, TInlineAllocator<2>> Modifiers;
+
+		/** Cached sum of additive magnitudes */
+		float FlatSum = 0.0f;
+
+		/** Cached product of multiplicative magnitudes */
+		float Multiplier = 1.0f;
+
+		/** Modifiers changed since the cache was built */
+		bool bDirty = false;
+
+		/** Unmodified value (regeneration rate only - max uses FStatValue::BaseMaxValue) */
+		float BaseValue = 0.0f;
+	};
+
+	static constexpr int32 NumStats = StatSlots::Capacity;
+	static constexpr int32 NumTargets = (int32)EStatModifierTarget::MAX;
+
+	FAggregate* FindAggregate(EStatType StatType, EStatModifierTarget Target);
+	const FAggregate* FindAggregate(EStatType StatType, EStatModifierTarget Target) const;
+
+	/** One aggregate per (target, stat), allocated on first Add */
+	TArray<FAggregate> Aggregates;
+
+	/** Last handle id issued */
+	int32 LastId = 0;
+};
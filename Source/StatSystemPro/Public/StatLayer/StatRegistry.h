@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StatLayer/StatTypes.h"
+#include "StatLayer/StatCategories.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UDataTable;
+
+/**
+ * A custom stat registered from an FCustomStatDefinitionRow
+ */
+struct FCustomStatInfo
+{
+	/** Slot assigned to the stat (past EStatType::MAX) */
+	EStatType StatType = EStatType::MAX;
+
+	/** StatID from the definition row */
+	FName StatID;
+
+	FText DisplayName;
+
+	EStatCategory Category = EStatCategory::Core;
+
+	/** Value a component starts with (current, max, regen, curve) */
+	FStatValue DefaultValue;
+};
+
+/**
+ * ============================================================================
+ * STAT REGISTRY - Stat Names and Custom Stats
+ * ============================================================================
+ *
+ * Interns every stat name to its dense slot index. Built-in stats keep their
+ * EStatType value; custom stats from the project's Custom Stat Tables get the
+ * slots after them in table/row order, so server and clients agree on indices.
+ *
+ * Resolve a name once (FindStat) and keep the EStatType - every stat API takes
+ * it, and custom stats live in the same arrays as built-in ones.
+ *
+ * Loaded from UStatSystemProSettings on first use (game thread).
+ */
+class STATSYSTEMPRO_API FStatRegistry
+{
+public:
+	/** Get the registry, loading the custom stat tables on first call */
+	static FStatRegistry& Get();
+
+	/** Free the registry (module shutdown) */
+	static void Shutdown();
+
+	/**
+	 * Resolve a stat name: built-in enum name ("Health_Core"), built-in display
+	 * name ("Health Core") or custom StatID
+	 * @return The stat's slot, or EStatType::MAX if unknown
+	 */
+	EStatType FindStat(FName StatName) const;
+
+	/** Custom stat registered at a slot, or nullptr */
+	const FCustomStatInfo* FindCustomStat(EStatType StatType) const;
+
+	/** All registered custom stats, in slot order */
+	const TArray<FCustomStatInfo>& GetCustomStats() const { return CustomStats; }
+
+	/** Number of slots in use (built-in + custom) */
+	int32 GetNumStats() const { return StatSlots::NumBuiltIn + CustomStats.Num(); }
+
+	/** Slots of a category - built-in and custom stats (use StatCategories::GetMask) */
+	uint32 GetCategoryMask(EStatCategory Category) const
+	{
+		return (int32)Category < (int32)EStatCategory::MAX ? CategoryMasks[(int32)Category] : 0;
+	}
+
+	/** Name of a stat (enum name for built-in, StatID for custom) */
+	FName GetStatName(EStatType StatType) const;
+
+private:
+	FStatRegistry();
+
+	/** Register built-in stat names */
+	void RegisterBuiltInStats();
+
+	/** Register the rows of one FCustomStatDefinitionRow table */
+	void RegisterCustomStatTable(const UDataTable* Table);
+
+	/** Name -> slot, for built-in and custom stats */
+	TMap<FName, EStatType> NameToStat;
+
+	/** Custom stats, CustomStats[i] is slot NumBuiltIn + i */
+	TArray<FCustomStatInfo> CustomStats;
+
+	/** Per category: bit N set = slot N belongs to it */
+	uint32 CategoryMasks[(int32)EStatCategory::MAX] = {};
+
+	/** Keeps the tables (and their regeneration curves) loaded */
+	TArray<TStrongObjectPtr<UDataTable>> LoadedTables;
+};
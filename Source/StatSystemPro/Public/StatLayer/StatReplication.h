@@ -0,0 +1,116 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "StatLayer/StatTypes.h"
+#include "StatReplication.generated.h"
+
+/**
+ * Per-stat replication compression (set from FStatConfigRow)
+ */
+struct STATSYSTEMPRO_API FStatQuantizationSettings
+{
+	EStatReplicationQuantization Mode = EStatReplicationQuantization::None;
+
+	/** Fixed Step size, stored in thousandths so server and client round identically */
+	uint32 StepMillis = 100;
+
+	FStatQuantizationSettings() = default;
+	FStatQuantizationSettings(EStatReplicationQuantization InMode, float InPrecision);
+
+	/** Step size for Fixed Step quantization */
+	FORCEINLINE float GetStep() const
+	{
+		return StepMillis * 0.001f;
+	}
+};
+
+/**
+ * Replicated snapshot of one stat's values
+ *
+ * Stores values already quantized, so comparing against the next snapshot tells
+ * whether anything the client would see has changed. Custom NetSerialize packs
+ * them according to the stat's quantization mode.
+ */
+USTRUCT()
+struct STATSYSTEMPRO_API FStatNetValue
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float CurrentValue = 0.0f;
+
+	UPROPERTY()
+	float MaxValue = 0.0f;
+
+	UPROPERTY()
+	float BaseMaxValue = 0.0f;
+
+	UPROPERTY()
+	float RegenerationRate = 0.0f;
+
+	UPROPERTY()
+	UCurveFloat* RegenerationCurve = nullptr;
+
+	UPROPERTY()
+	float LazyRate = 0.0f;
+
+	UPROPERTY()
+	double LazyTimestamp = -1.0;
+
+	/** Compression used for CurrentValue / MaxValue (sent with the values) */
+	EStatReplicationQuantization Mode = EStatReplicationQuantization::None;
+	uint32 StepMillis = 100;
+
+	/** Quantize a stat into this snapshot. Returns true if the snapshot changed. */
+	bool SetFromStat(const FStatValue& Stat, const FStatQuantizationSettings& Settings);
+
+	/** Write the snapshot into a stat */
+	void ApplyToStat(FStatValue& OutStat) const;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FStatNetValue> : public TStructOpsTypeTraitsBase2<FStatNetValue>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * One replicated stat in FStatContainer's fast array
+ */
+USTRUCT()
+struct STATSYSTEMPRO_API FStatReplicatedItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Stat slot (a byte rather than EStatType, so custom stat slots past EStatType::MAX replicate) */
+	UPROPERTY()
+	uint8 StatIndex = 0;
+
+	UPROPERTY()
+	FStatNetValue Value;
+};
+
+/**
+ * A stat update received from the server, with the stat as it was before
+ * CLIENT ONLY: Collected by FStatContainer, consumed by the owning component's OnRep
+ */
+struct FStatReplicatedChange
+{
+	EStatType StatType = EStatType::Health_Core;
+
+	/** Stat before the update (only meaningful if bWasPresent) */
+	FStatValue OldStat;
+
+	bool bWasPresent = false;
+
+	/** Stat was removed by the server */
+	bool bRemoved = false;
+};
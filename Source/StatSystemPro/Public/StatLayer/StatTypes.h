@@ -45,6 +45,29 @@ enum class EStatType : uint8
 	MAX UMETA(Hidden)
 };
 
+/**
+ * Stat slot layout: built-in EStatType values first, then custom stats registered
+ * by FStatRegistry (cast to EStatType past MAX). Per-stat arrays and bitmasks are
+ * sized for every slot.
+ */
+namespace StatSlots
+{
+	/** Built-in stats (EStatType values) */
+	constexpr int32 NumBuiltIn = (int32)EStatType::MAX;
+
+	/** Total slots - bounded by the 32-bit per-stat masks */
+	constexpr int32 Capacity = 32;
+
+	/** Slots available to custom stats */
+	constexpr int32 MaxCustom = Capacity - NumBuiltIn;
+
+	/** Is this a registered-custom-stat slot? */
+	FORCEINLINE bool IsCustom(EStatType StatType)
+	{
+		return (int32)StatType >= NumBuiltIn && (int32)StatType < Capacity;
+	}
+}
+
 /**
  * Stat Categories for batch operations
  * BLUEPRINT: Select a category to work with multiple related stats at once!
@@ -73,6 +96,23 @@ enum class EStatCategory : uint8
 	MAX UMETA(Hidden)
 };
 
+/**
+ * How a stat's values are compressed when replicated
+ * MULTIPLAYER: Lower precision = less bandwidth per stat update
+ */
+UENUM(BlueprintType)
+enum class EStatReplicationQuantization : uint8
+{
+	/** Full 32-bit floats - exact */
+	None UMETA(DisplayName = "None (Full Precision)"),
+
+	/** Current and max rounded to a fixed step (e.g. 0.1) and sent as packed integers */
+	Precision UMETA(DisplayName = "Fixed Step (e.g. 0.1)"),
+
+	/** Current sent as a 16-bit fraction of max (about 0.0015% resolution) */
+	Percentage16 UMETA(DisplayName = "16-bit Percentage")
+};
+
 /**
  * Struct representing a single stat with current and max values
  */
@@ -101,12 +141,22 @@ struct STATSYSTEMPRO_API FStatValue
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stat")
 	UCurveFloat* RegenerationCurve;
 
+	/** Lazy evaluation: rate per second captured at the last rebase */
+	UPROPERTY()
+	float LazyRate;
+
+	/** Lazy evaluation: server world time CurrentValue was last rebased at (< 0 = not lazy) */
+	UPROPERTY()
+	double LazyTimestamp;
+
 	FStatValue()
 		: CurrentValue(100.0f)
 		, MaxValue(100.0f)
 		, BaseMaxValue(100.0f)
 		, RegenerationRate(0.0f)
 		, RegenerationCurve(nullptr)
+		, LazyRate(0.0f)
+		, LazyTimestamp(-1.0)
 	{
 	}
 
@@ -116,6 +166,8 @@ struct STATSYSTEMPRO_API FStatValue
 		, BaseMaxValue(InValue)
 		, RegenerationRate(0.0f)
 		, RegenerationCurve(nullptr)
+		, LazyRate(0.0f)
+		, LazyTimestamp(-1.0)
 	{
 	}
 
@@ -142,6 +194,35 @@ struct STATSYSTEMPRO_API FStatValue
 	{
 		return FMath::IsNearlyZero(CurrentValue);
 	}
+
+	/** Is this stat evaluated lazily (CurrentValue + LazyRate * elapsed) instead of written every tick? */
+	bool IsLazy() const
+	{
+		return LazyTimestamp >= 0.0;
+	}
+
+	/** Value at a server world time (CurrentValue if not lazy) */
+	float GetValueAt(double Time) const
+	{
+		if (!IsLazy())
+		{
+			return CurrentValue;
+		}
+
+		const float Elapsed = (float)FMath::Max(0.0, Time - LazyTimestamp);
+		return FMath::Clamp(CurrentValue + LazyRate * Elapsed, 0.0f, MaxValue);
+	}
+
+	/** Fold elapsed lazy regeneration into CurrentValue and restart the clock with a new rate */
+	void RebaseLazy(double Time, float NewRate)
+	{
+		if (IsLazy())
+		{
+			CurrentValue = GetValueAt(Time);
+			LazyTimestamp = Time;
+			LazyRate = NewRate;
+		}
+	}
 };
 
 /**
@@ -168,11 +249,24 @@ struct STATSYSTEMPRO_API FStatConfigRow : public FTableRowBase
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Config")
 	UCurveFloat* RegenerationCurve;
 
+	/** How this stat is compressed when replicated */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication")
+	EStatReplicationQuantization ReplicationQuantization;
+
+	/** Step for Fixed Step quantization (0.1 = one decimal place) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication", meta=(
+		EditCondition = "ReplicationQuantization == EStatReplicationQuantization::Precision",
+		ClampMin = "0.001", ClampMax = "1000.0"
+	))
+	float ReplicationPrecision;
+
 	FStatConfigRow()
 		: StatType(EStatType::Health_Core)
 		, DefaultMaxValue(100.0f)
 		, DefaultRegenerationRate(0.0f)
 		, RegenerationCurve(nullptr)
+		, ReplicationQuantization(EStatReplicationQuantization::None)
+		, ReplicationPrecision(0.1f)
 	{
 	}
 };
@@ -203,4 +297,86 @@ struct STATSYSTEMPRO_API FStatChangeReason
 		, ReasonTag(InTag)
 	{
 	}
+
+	bool operator==(const FStatChangeReason& Other) const
+	{
+		return Source == Other.Source && ReasonTag == Other.ReasonTag;
+	}
+};
+
+/**
+ * One change in a bulk stat change
+ * BLUEPRINT: Build an array of these and pass it to "Change Multiple Stats"
+ */
+USTRUCT(BlueprintType)
+struct STATSYSTEMPRO_API FStatDelta
+{
+	GENERATED_BODY()
+
+	/** Which stat to change */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stat")
+	EStatType StatType;
+
+	/** How much to change (+positive to increase, -negative to decrease) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stat")
+	float Amount;
+
+	/** Source of the change (e.g., "Combat", "Environment", "Item") */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stat")
+	FName Source;
+
+	/** Optional tag for filtering/tracking */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stat")
+	FGameplayTag ReasonTag;
+
+	FStatDelta()
+		: StatType(EStatType::Health_Core)
+		, Amount(0.0f)
+		, Source(NAME_None)
+	{
+	}
+
+	FStatDelta(EStatType InStatType, float InAmount, FName InSource, FGameplayTag InTag = FGameplayTag())
+		: StatType(InStatType)
+		, Amount(InAmount)
+		, Source(InSource)
+		, ReasonTag(InTag)
+	{
+	}
 };
+
+/**
+ * All changes to one stat during a frame, coalesced
+ * BLUEPRINT: Received from "On Stats Changed (Batched)"
+ */
+USTRUCT(BlueprintType)
+struct STATSYSTEMPRO_API FStatChangeRecord
+{
+	GENERATED_BODY()
+
+	/** The stat that changed */
+	UPROPERTY(BlueprintReadOnly, Category = "Stat")
+	EStatType StatType;
+
+	/** Value before the first change this frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Stat")
+	float OldValue;
+
+	/** Value after the last change this frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Stat")
+	float NewValue;
+
+	/** Distinct reasons given for the changes, in order (regeneration and replication give none) */
+	UPROPERTY(BlueprintReadOnly, Category = "Stat")
+	TArray<FStatChangeReason> Reasons;
+
+	FStatChangeRecord()
+		: StatType(EStatType::Health_Core)
+		, OldValue(0.0f)
+		, NewValue(0.0f)
+	{
+	}
+};
+
+/** One end-of-frame batch of coalesced stat changes (UStatComponent and UStatSystemProComponent) */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatsChangedBatch, const TArray<FStatChangeRecord>&, Changes);
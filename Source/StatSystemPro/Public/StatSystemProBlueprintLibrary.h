@@ -81,6 +81,19 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Stat System Pro|Stats", meta = (DefaultToSelf = "Actor"))
 	static float GetStatPercentage(AActor* Actor, EStatType StatType);
 
+	/**
+	 * Find a stat by name - built-in ("Health_Core") or custom (StatID from a Custom Stat Table)
+	 * Resolve once (e.g. in BeginPlay) and store the result; every stat function takes it
+	 */
+	UFUNCTION(BlueprintPure, Category = "Stat System Pro|Stats")
+	static bool FindStatByName(FName StatName, EStatType& OutStatType);
+
+	/**
+	 * Get a stat's name (enum name for built-in stats, StatID for custom stats)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Stat System Pro|Stats")
+	static FName GetStatName(EStatType StatType);
+
 	// ========== Quick Body Functions ==========
 
 	/**
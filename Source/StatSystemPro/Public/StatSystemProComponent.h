@@ -6,59 +6,20 @@
 #include "Components/ActorComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "StatLayer/StatTypes.h"
-#include "BodyLayer/BodyTypes.h"
-#include "StatusEffectLayer/StatusEffectTypes.h"
-#include "ProgressionLayer/ProgressionTypes.h"
-#include "WeatherSystem/WeatherTypes.h"
-#include "TimeSystem/TimeTypes.h"
+#include "StatLayer/StatContainer.h"
+#include "StatLayer/StatEventDispatcher.h"
+#include "StatSystemProLayers.h"
+#include "Simulation/StatSimulationSubsystem.h"
+#include "Simulation/StatChangeJournal.h"
+#include "Simulation/StatEventBatchSubsystem.h"
 #include "StatSystemProComponent.generated.h"
 
 // Forward declarations
 class UCurveFloat;
 class UDataTable;
 
-// ============================================================================
-// UNIFIED COMPONENT DELEGATES
-// ============================================================================
-
-// Stat Layer Events
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnStatChanged, EStatType, StatType, float, OldValue, float, NewValue);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatMaxChanged, EStatType, StatType, float, NewMaxValue);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatReachedZero, EStatType, StatType);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatReachedMax, EStatType, StatType);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatCritical, EStatType, StatType, float, CurrentValue);
-
-// Body Layer Events
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBodyPartDamaged, EBodyPart, BodyPart, float, Damage);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBodyPartFractured, EBodyPart, BodyPart);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBodyPartBleeding, EBodyPart, BodyPart, float, BleedRate);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBodyPartBurned, EBodyPart, BodyPart, EBurnLevel, BurnLevel);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBodyPartInfected, EBodyPart, BodyPart, float, InfectionRate);
-
-// Weather Layer Events
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWeatherChanged, EWeatherType, OldWeather, EWeatherType, NewWeather);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnClothingEquipped, EClothingSlot, Slot, FClothingItem, Item);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnClothingRemoved, EClothingSlot, Slot);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFreezingStageChanged, EFreezingStage, NewStage);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnOverheatingStageChanged, EOverheatingStage, NewStage);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTemperatureChanged, float, OldTemp, float, NewTemp);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnClothingWetnessChanged, float, NewWetness);
-
-// Status Effect Events
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatusEffectApplied, FName, EffectID, int32, Stacks);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatusEffectRemoved, FName, EffectID);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatusEffectExpired, FName, EffectID, int32, RemainingStacks);
-
-// Progression Events
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLevelUp, int32, OldLevel, int32, NewLevel);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnXPGained, int32, Amount, int32, NewTotal, EXPSource, Source);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSkillUnlocked, FName, SkillID);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatPointsAwarded, int32, Amount, int32, NewTotal);
-
-// Time Events
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHourChanged, int32, NewHour);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDayChanged, int32, NewDay);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTimeOfDayChanged, ETimeOfDay, OldTimeOfDay, ETimeOfDay, NewTimeOfDay);
+/** A layer object was created (server) or arrived by replication (client) - bind its events here */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatSystemProLayerReady, UStatSystemProLayer*, Layer);
 
 /**
  * ============================================================================
@@ -86,6 +47,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTimeOfDayChanged, ETimeOfDay, Ol
  * - Progression Layer: XP, levels, skills, stat points
  * - Time Layer: Global time, day/night cycle
  *
+ * Each enabled layer keeps its data and events in its own layer object
+ * (StatLayer, BodyLayer, ...). Disabled layers allocate nothing.
+ *
  * USAGE:
  * 1. Add this component to your character
  * 2. Enable the layers you want (checkboxes in details panel)
@@ -106,7 +70,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTimeOfDayChanged, ETimeOfDay, Ol
  * - Unified component is RECOMMENDED for new projects
  */
 UCLASS(ClassGroup=(StatSystemPro), meta=(BlueprintSpawnableComponent, DisplayName="StatSystemPro (Unified - All-in-One)"))
-class STATSYSTEMPRO_API UStatSystemProComponent : public UActorComponent
+class STATSYSTEMPRO_API UStatSystemProComponent : public UActorComponent, public IStatSimulationClient, public IStatEventBatchClient
 {
 	GENERATED_BODY()
 
@@ -114,8 +78,24 @@ public:
 	UStatSystemProComponent();
 
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void RegisterComponentTickFunctions(bool bRegister) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
+	// IStatSimulationClient
+	virtual FStatContainer& GetSimulatedStats() override { return StatLayer->Stats; } // Only registered while the stat layer exists
+	virtual bool ShouldSimulateStats() const override { return bEnableStatLayer && bEnableAutoRegeneration && StatLayer; }
+	virtual float GetSimulationCriticalThreshold() const override { return CriticalThreshold; }
+	virtual void OnSimulatedStatChanged(EStatType StatType, float OldValue, float NewValue) override;
+	virtual void OnSimulatedStatCrossedThreshold(EStatType StatType, float OldValue, float NewValue) override;
+
+	// IStatEventBatchClient
+	virtual void FlushBatchedStatEvents() override;
+
+	/** Tell the stat simulation subsystem that regeneration rates/curves changed */
+	void MarkStatSimulationDirty();
 
 	// ========================================================================
 	// LAYER TOGGLES
@@ -182,12 +162,75 @@ public:
 	bool bEnableTimeLayer;
 
 	// ========================================================================
-	// STAT LAYER DATA
+	// LAYER TICKING
 	// ========================================================================
+	// Each layer has its own tick function. Weather and body run before the
+	// stat layer (they feed it); progression and time run after physics.
+	// 0 = every frame.
+
+	/** Stat layer regeneration interval (unused while the stat simulation subsystem drives regen) */
+	UPROPERTY(EditAnywhere, Category = "StatSystemPro|Layer Ticking", meta=(ClampMin = "0.0", Units = "s"))
+	float StatLayerTickInterval;
+
+	/** Body layer interval (bleeding, infection) */
+	UPROPERTY(EditAnywhere, Category = "StatSystemPro|Layer Ticking", meta=(ClampMin = "0.0", Units = "s"))
+	float BodyLayerTickInterval;
+
+	/** Weather layer interval (body temperature, freezing/overheating) */
+	UPROPERTY(EditAnywhere, Category = "StatSystemPro|Layer Ticking", meta=(ClampMin = "0.0", Units = "s"))
+	float WeatherLayerTickInterval;
+
+	/** Status effect layer interval (effect timers) */
+	UPROPERTY(EditAnywhere, Category = "StatSystemPro|Layer Ticking", meta=(ClampMin = "0.0", Units = "s"))
+	float StatusEffectLayerTickInterval;
+
+	/** Progression layer interval */
+	UPROPERTY(EditAnywhere, Category = "StatSystemPro|Layer Ticking", meta=(ClampMin = "0.0", Units = "s"))
+	float ProgressionLayerTickInterval;
+
+	/** Time layer interval (clock, hour/day events) */
+	UPROPERTY(EditAnywhere, Category = "StatSystemPro|Layer Ticking", meta=(ClampMin = "0.0", Units = "s"))
+	float TimeLayerTickInterval;
+
+	// ========================================================================
+	// ========================================================================
+	// LAYER OBJECTS
+	// ========================================================================
+	// Each enabled layer's data and events live in its own object, created when
+	// the layer is switched on (null while it is off, and on clients until the
+	// server's layer replicates). Bind layer events in OnLayerReady.
+
+	/** Stats (null while the stat layer is off) */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Instanced, Transient, ReplicatedUsing=OnRep_Layers, Category = "StatSystemPro|Layers")
+	UStatSystemProStatLayer* StatLayer;
+
+	/** Body parts (null while the body layer is off) */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Instanced, Transient, ReplicatedUsing=OnRep_Layers, Category = "StatSystemPro|Layers")
+	UStatSystemProBodyLayer* BodyLayer;
+
+	/** Weather, temperature and clothing (null while the weather layer is off) */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Instanced, Transient, ReplicatedUsing=OnRep_Layers, Category = "StatSystemPro|Layers")
+	UStatSystemProWeatherLayer* WeatherLayer;
+
+	/** Active status effects (null while the status effect layer is off) */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Instanced, Transient, ReplicatedUsing=OnRep_Layers, Category = "StatSystemPro|Layers")
+	UStatSystemProStatusEffectLayer* StatusEffectLayer;
+
+	/** Level, XP and skills (null while the progression layer is off) */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Instanced, Transient, ReplicatedUsing=OnRep_Layers, Category = "StatSystemPro|Layers")
+	UStatSystemProProgressionLayer* ProgressionLayer;
 
-	/** All stat values (Health, Stamina, Hunger, etc.) */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Stats, Category = "StatSystemPro|Stat Layer")
-	TMap<EStatType, FStatValue> Stats;
+	/** Clock and day/night cycle (null while the time layer is off) */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Instanced, Transient, ReplicatedUsing=OnRep_Layers, Category = "StatSystemPro|Layers")
+	UStatSystemProTimeLayer* TimeLayer;
+
+	/** Fires once per layer object, when it is created (server) or replicated (client) */
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events")
+	FOnStatSystemProLayerReady OnLayerReady;
+
+	// ========================================================================
+	// STAT LAYER SETTINGS
+	// ========================================================================
 
 	/** Critical threshold for stats (0.0-1.0) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StatSystemPro|Stat Layer", meta=(
@@ -207,86 +250,34 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StatSystemPro|Stat Layer")
 	UDataTable* StatConfigTable;
 
+	/**
+	 * Coalesce stat changes into one OnStatsChangedBatch event per frame
+	 * Each stat appears once per batch (value before its first change, value after its last);
+	 * OnStatChanged and the other per-change events still fire as before
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StatSystemPro|Stat Layer")
+	bool bBatchStatChangeEvents;
+
 	// ========================================================================
-	// BODY LAYER DATA
+	// BODY LAYER SETTINGS
 	// ========================================================================
 
-	/** All body parts and their states */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_BodyParts, Category = "StatSystemPro|Body Layer")
-	TMap<EBodyPart, FBodyPartState> BodyParts;
-
 	/** Body part configuration data table */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StatSystemPro|Body Layer")
 	UDataTable* BodyPartConfigTable;
 
 	// ========================================================================
-	// WEATHER LAYER DATA
+	// STATUS EFFECT LAYER SETTINGS
 	// ========================================================================
 
-	/** Current weather type */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_CurrentWeather, Category = "StatSystemPro|Weather Layer")
-	EWeatherType CurrentWeather;
-
-	/** Ambient temperature (Celsius) */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
-	float AmbientTemperature;
-
-	/** Wind speed (m/s) */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
-	float WindSpeed;
-
-	/** Wetness level (0-100%) */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
-	float WetnessLevel;
-
-	/** Shelter level (0-100%) */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
-	float ShelterLevel;
-
-	/** Currently equipped clothing */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_EquippedClothing, Category = "StatSystemPro|Weather Layer")
-	TMap<EClothingSlot, FClothingItem> EquippedClothing;
-
-	/** Current freezing stage */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
-	EFreezingStage CurrentFreezingStage;
-
-	/** Current overheating stage */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
-	EOverheatingStage CurrentOverheatingStage;
-
-	// ========================================================================
-	// STATUS EFFECT LAYER DATA
-	// ========================================================================
-
-	/** All active status effects */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_ActiveEffects, Category = "StatSystemPro|Status Effect Layer")
-	TArray<FActiveStatusEffect> ActiveEffects;
-
 	/** Status effect definitions data table */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StatSystemPro|Status Effect Layer")
 	UDataTable* StatusEffectTable;
 
 	// ========================================================================
-	// PROGRESSION LAYER DATA
+	// PROGRESSION LAYER SETTINGS
 	// ========================================================================
 
-	/** Current level */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Progression Layer")
-	int32 CurrentLevel;
-
-	/** Current XP */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Progression Layer")
-	int32 CurrentXP;
-
-	/** Available stat points */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Progression Layer")
-	int32 StatPoints;
-
-	/** Unlocked skills */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Progression Layer")
-	TArray<FName> UnlockedSkills;
-
 	/** Skill tree data table */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StatSystemPro|Progression Layer")
 	UDataTable* SkillTreeTable;
@@ -296,135 +287,39 @@ public:
 	UCurveFloat* XPCurve;
 
 	// ========================================================================
-	// TIME LAYER DATA
+	// TIME LAYER SETTINGS
 	// ========================================================================
 
-	/** Current game time (in seconds since start) */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Time Layer")
-	float CurrentGameTime;
-
 	/** Time multiplier (1.0 = real-time, 2.0 = 2x speed) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "StatSystemPro|Time Layer", meta=(
 		ClampMin = "0.0", ClampMax = "100.0"
 	))
 	float TimeMultiplier;
 
-	/** Current hour (0-23) */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Time Layer")
-	int32 CurrentHour;
-
-	/** Current day */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Time Layer")
-	int32 CurrentDay;
+	// ========== NATIVE STAT EVENTS (C++ only) ==========
 
-	/** Current time of day */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Time Layer")
-	ETimeOfDay CurrentTimeOfDay;
-
-	// ========================================================================
-	// STAT LAYER EVENTS
-	// ========================================================================
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
-	FOnStatChanged OnStatChanged;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
-	FOnStatMaxChanged OnStatMaxChanged;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
-	FOnStatReachedZero OnStatReachedZero;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
-	FOnStatReachedMax OnStatReachedMax;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
-	FOnStatCritical OnStatCritical;
-
-	// ========================================================================
-	// BODY LAYER EVENTS
-	// ========================================================================
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Body Layer")
-	FOnBodyPartDamaged OnBodyPartDamaged;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Body Layer")
-	FOnBodyPartFractured OnBodyPartFractured;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Body Layer")
-	FOnBodyPartBleeding OnBodyPartBleeding;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Body Layer")
-	FOnBodyPartBurned OnBodyPartBurned;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Body Layer")
-	FOnBodyPartInfected OnBodyPartInfected;
-
-	// ========================================================================
-	// WEATHER LAYER EVENTS
-	// ========================================================================
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
-	FOnWeatherChanged OnWeatherChanged;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
-	FOnClothingEquipped OnClothingEquipped;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
-	FOnClothingRemoved OnClothingRemoved;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
-	FOnFreezingStageChanged OnFreezingStageChanged;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
-	FOnOverheatingStageChanged OnOverheatingStageChanged;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
-	FOnTemperatureChanged OnTemperatureChanged;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
-	FOnClothingWetnessChanged OnClothingWetnessChanged;
-
-	// ========================================================================
-	// STATUS EFFECT LAYER EVENTS
-	// ========================================================================
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Status Effect Layer")
-	FOnStatusEffectApplied OnStatusEffectApplied;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Status Effect Layer")
-	FOnStatusEffectRemoved OnStatusEffectRemoved;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Status Effect Layer")
-	FOnStatusEffectExpired OnStatusEffectExpired;
-
-	// ========================================================================
-	// PROGRESSION LAYER EVENTS
-	// ========================================================================
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Progression Layer")
-	FOnLevelUp OnLevelUp;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Progression Layer")
-	FOnXPGained OnXPGained;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Progression Layer")
-	FOnSkillUnlocked OnSkillUnlocked;
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Progression Layer")
-	FOnStatPointsAwarded OnStatPointsAwarded;
-
-	// ========================================================================
-	// TIME LAYER EVENTS
-	// ========================================================================
-
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Time Layer")
-	FOnHourChanged OnHourChanged;
+	/**
+	 * Subscribe a native delegate to one event of one stat
+	 * C++: Only that stat's listeners are invoked - prefer this over binding On Any Stat Changed and filtering
+	 * Fires alongside the stat layer's Blueprint events. Keep the returned handle to unsubscribe.
+	 * Held by the component, so subscriptions made before the stat layer replicates still fire.
+	 */
+	FStatEventSubscription SubscribeToStatEvent(EStatType StatType, EStatEventKind Kind, FStatNativeEventDelegate Delegate)
+	{
+		return NativeStatEvents.Subscribe(StatType, Kind, MoveTemp(Delegate));
+	}
 
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Time Layer")
-	FOnDayChanged OnDayChanged;
+	/** Remove a native subscription (resets the handle) */
+	bool UnsubscribeFromStatEvent(FStatEventSubscription& Subscription)
+	{
+		return NativeStatEvents.Unsubscribe(Subscription);
+	}
 
-	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Time Layer")
-	FOnTimeOfDayChanged OnTimeOfDayChanged;
+	/** Remove every native subscription bound to UserObject */
+	void UnsubscribeAllStatEvents(const void* UserObject)
+	{
+		NativeStatEvents.UnsubscribeAll(UserObject);
+	}
 
 	// ========================================================================
 	// STAT LAYER FUNCTIONS
@@ -474,6 +369,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Stat Layer")
 	bool HasStat(EStatType StatType) const;
 
+	/** Get all stats as a map (compatibility view for Blueprint) */
+	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Stat Layer")
+	TMap<EStatType, FStatValue> GetStatsMap() const;
+
 	/** Check if stat is at max */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Stat Layer")
 	bool IsStatAtMax(EStatType StatType) const;
@@ -624,15 +523,15 @@ public:
 
 	/** Get current weather */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Weather Layer")
-	EWeatherType GetCurrentWeather() const { return CurrentWeather; }
+	EWeatherType GetCurrentWeather() const { return LayerOrDefault(WeatherLayer).CurrentWeather; }
 
 	/** Get freezing stage */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Weather Layer")
-	EFreezingStage GetFreezingStage() const { return CurrentFreezingStage; }
+	EFreezingStage GetFreezingStage() const { return LayerOrDefault(WeatherLayer).CurrentFreezingStage; }
 
 	/** Get overheating stage */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Weather Layer")
-	EOverheatingStage GetOverheatingStage() const { return CurrentOverheatingStage; }
+	EOverheatingStage GetOverheatingStage() const { return LayerOrDefault(WeatherLayer).CurrentOverheatingStage; }
 
 	// ========================================================================
 	// STATUS EFFECT LAYER FUNCTIONS
@@ -656,7 +555,7 @@ public:
 
 	/** Get all active effects */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Status Effect Layer")
-	TArray<FActiveStatusEffect> GetActiveEffects() const { return ActiveEffects; }
+	TArray<FActiveStatusEffect> GetActiveEffects() const { return LayerOrDefault(StatusEffectLayer).ActiveEffects; }
 
 	/** Clear all status effects */
 	UFUNCTION(BlueprintCallable, Category = "StatSystemPro|Status Effect Layer")
@@ -684,11 +583,11 @@ public:
 
 	/** Get current level */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Progression Layer")
-	int32 GetCurrentLevel() const { return CurrentLevel; }
+	int32 GetCurrentLevel() const { return LayerOrDefault(ProgressionLayer).CurrentLevel; }
 
 	/** Get current XP */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Progression Layer")
-	int32 GetCurrentXP() const { return CurrentXP; }
+	int32 GetCurrentXP() const { return LayerOrDefault(ProgressionLayer).CurrentXP; }
 
 	/** Get XP for next level */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Progression Layer")
@@ -704,7 +603,7 @@ public:
 
 	/** Get available stat points */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Progression Layer")
-	int32 GetStatPoints() const { return StatPoints; }
+	int32 GetStatPoints() const { return LayerOrDefault(ProgressionLayer).StatPoints; }
 
 	// ========================================================================
 	// TIME LAYER FUNCTIONS
@@ -724,20 +623,62 @@ public:
 
 	/** Get current hour */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Time Layer")
-	int32 GetCurrentHour() const { return CurrentHour; }
+	int32 GetCurrentHour() const { return LayerOrDefault(TimeLayer).CurrentHour; }
 
 	/** Get current day */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Time Layer")
-	int32 GetCurrentDay() const { return CurrentDay; }
+	int32 GetCurrentDay() const { return LayerOrDefault(TimeLayer).CurrentDay; }
 
 	/** Get time of day */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Time Layer")
-	ETimeOfDay GetTimeOfDay() const { return CurrentTimeOfDay; }
+	ETimeOfDay GetTimeOfDay() const { return LayerOrDefault(TimeLayer).CurrentTimeOfDay; }
 
 	/** Get formatted time string */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Time Layer")
 	FString GetFormattedTime() const;
 
+	// ========================================================================
+	// FAST FORWARD
+	// ========================================================================
+
+	/**
+	 * Fast Forward - Advance every enabled layer by a span of time at once
+	 * Use for sleeping, waiting, or catching up a character that was offline.
+	 * Regen, hunger/thirst/fatigue, bleeding, infection, temperature, effect timers
+	 * and the clock all advance in a few large steps instead of frame by frame.
+	 *
+	 * EVENTS: Each changed stat broadcasts once (start value -> end value), stage
+	 * and time events fire once for the final state, expired effects once each.
+	 * Server only.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "StatSystemPro|Time Layer", meta=(
+		DisplayName = "Fast Forward",
+		Keywords = "sleep skip wait offline advance time"
+	))
+	void FastForward(FTimespan Duration);
+
+	// ========================================================================
+	// DORMANCY
+	// ========================================================================
+	// A layer with nothing to advance (no regen left to apply, no bleeding or
+	// infection, body temperature at equilibrium, no timed effects, clock
+	// stopped) stops ticking. Mutating calls wake the layers they affect.
+
+	/** Layers with pending work, one bit per EStatSystemProLayer */
+	uint8 GetActiveLayerMask() const { return ActiveLayerMask; }
+
+	/** Is every layer asleep? */
+	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Performance")
+	bool IsDormant() const { return ActiveLayerMask == 0; }
+
+	/**
+	 * Re-check which layers have work, waking or sleeping each one
+	 * Call after editing layer data directly or toggling layers at runtime
+	 * (creates the objects of layers switched on since registration)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "StatSystemPro|Performance")
+	void RefreshDormancy();
+
 	// ========================================================================
 	// SAVE/LOAD SYSTEM
 	// ========================================================================
@@ -768,6 +709,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "StatSystemPro|Debug")
 	FString GetDebugInfo() const;
 
+	/**
+	 * Memory used by this instance (bytes)
+	 * The component plus each enabled layer's object and the heap its containers hold
+	 * Disabled layers have no object and cost nothing
+	 */
+	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Debug")
+	int32 GetInstanceMemorySize() const;
+
 	/** Check if character is in critical condition */
 	UFUNCTION(BlueprintPure, Category = "StatSystemPro|Query")
 	bool IsCritical() const;
@@ -781,20 +730,14 @@ private:
 	// REPLICATION CALLBACKS
 	// ========================================================================
 
+	/** Layer objects arrived (client) */
 	UFUNCTION()
-	void OnRep_Stats();
-
-	UFUNCTION()
-	void OnRep_BodyParts();
+	void OnRep_Layers();
 
-	UFUNCTION()
-	void OnRep_CurrentWeather();
-
-	UFUNCTION()
-	void OnRep_EquippedClothing();
+	friend class UStatSystemProStatLayer;
 
-	UFUNCTION()
-	void OnRep_ActiveEffects();
+	/** Broadcast the stats the last replication changed (called by the stat layer, client) */
+	void OnRep_Stats();
 
 	// ========================================================================
 	// INTERNAL UPDATE FUNCTIONS
@@ -824,6 +767,9 @@ private:
 	/** Update freezing/overheating stages */
 	void UpdateTemperatureStages(float EffectiveTemp);
 
+	/** Update time of day from the current hour */
+	void UpdateTimeOfDay();
+
 	/** Update bleeding effects */
 	void UpdateBleeding(float DeltaTime);
 
@@ -835,4 +781,96 @@ private:
 
 	/** Get total clothing insulation */
 	float GetTotalClothingInsulation(bool bForCold) const;
+
+	/** Largest fast-forward step that keeps every layer accurate, up to MaxStep */
+	float GetFastForwardStep(float MaxStep) const;
+
+	friend struct FStatSystemProLayerTickFunction;
+
+	/** Advance one layer (called by its tick function) */
+	void TickLayer(EStatSystemProLayer Layer, float DeltaTime);
+
+	/** Configured interval of a layer */
+	float GetLayerTickInterval(EStatSystemProLayer Layer) const;
+
+	/** Layer object of a layer (null = disabled, or not replicated yet) */
+	UStatSystemProLayer* GetLayer(EStatSystemProLayer Layer) const;
+
+	/** A layer, or its class defaults while it doesn't exist - for read-only queries */
+	template<typename LayerType>
+	static const LayerType& LayerOrDefault(const LayerType* Layer)
+	{
+		return Layer ? *Layer : *GetDefault<LayerType>();
+	}
+
+	/** Is a layer's toggle on? */
+	bool IsLayerEnabled(EStatSystemProLayer Layer) const;
+
+	/** Create objects for enabled layers that don't have one yet (server / standalone) */
+	void CreateEnabledLayers();
+
+	/** Register a layer's tick function (interval, tick group, prerequisites) */
+	void RegisterLayerTickFunction(UStatSystemProLayer& LayerObject);
+
+	/** Drop the object of a layer switched off at runtime (its tick is already unregistered) */
+	void DestroyLayer(EStatSystemProLayer Layer);
+
+	/** Memory held by the layers - each layer object plus its containers - and the native event tables */
+	SIZE_T GetAllocatedLayerMemory() const;
+
+	/** Is automatic layer dormancy on? (UStatSystemProSettings) */
+	static bool IsDormancyEnabled();
+
+	/** Does a layer have anything left to advance? */
+	bool LayerHasPendingWork(EStatSystemProLayer Layer) const;
+
+	/** Enable/disable a layer's tick and keep the active mask in sync */
+	void SetLayerActive(EStatSystemProLayer Layer, bool bActive);
+
+	/** Resume ticking a layer after a change that may give it work */
+	void WakeLayer(EStatSystemProLayer Layer);
+
+	/** Wake the layers that react to a stat (regen, and the weather layer for body temperature) */
+	void WakeLayersForStat(EStatType StatType);
+
+	/** The first tick after a wake only covers the time since waking */
+	float ClampDeltaAfterWake(EStatSystemProLayer Layer, float DeltaTime);
+
+	/** Layers currently ticking, one bit per EStatSystemProLayer */
+	uint8 ActiveLayerMask;
+
+	/** Layers woken since their last tick */
+	uint8 WokenLayerMask;
+
+	/** Layers whose object OnLayerReady has announced */
+	uint8 ReadyLayerMask;
+
+	/** Per-step events are held back while fast-forwarding (broadcast once at the end) */
+	bool bFastForwarding;
+
+	/** Hand stat regeneration over to the world's stat simulation subsystem */
+	void RegisterWithStatSimulation();
+
+	/** Stop handing stat regeneration to the subsystem */
+	void UnregisterFromStatSimulation();
+
+	/** Subsystem driving stat regeneration (null = UpdateStatLayer runs in our tick) */
+	UPROPERTY(Transient)
+	UStatSimulationSubsystem* StatSimulation;
+
+	/** Registration handle with StatSimulation */
+	int32 StatSimulationHandle;
+
+	/** Append a change to the world's change journal (same records as UStatComponent) */
+	void JournalStatChange(EStatType StatType, float Amount, float NewValue, FName Source, FGameplayTag ReasonTag);
+
+	/** World change journal (null outside game worlds) */
+	UPROPERTY(Transient)
+	UStatChangeJournalSubsystem* ChangeJournal;
+
+	/** Native per-stat listeners (SubscribeToStatEvent) */
+	FStatEventDispatcher NativeStatEvents;
+
+	/** Broadcast a stat change (Blueprint, native and trace) and add it to the frame's batch */
+	void NotifyStatChanged(EStatType StatType, float OldValue, float NewValue, FName Source, const FGameplayTag& ReasonTag);
 };
@@ -0,0 +1,446 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Engine/EngineBaseTypes.h"
+#include "StatLayer/StatTypes.h"
+#include "StatLayer/StatContainer.h"
+#include "BodyLayer/BodyTypes.h"
+#include "StatusEffectLayer/StatusEffectTypes.h"
+#include "ProgressionLayer/ProgressionTypes.h"
+#include "WeatherSystem/WeatherTypes.h"
+#include "TimeSystem/TimeTypes.h"
+#include "StatSystemProLayers.generated.h"
+
+class UStatSystemProComponent;
+
+/**
+ * Layers of the unified component, each ticked by its own tick function
+ */
+enum class EStatSystemProLayer : uint8
+{
+	Stat,
+	Body,
+	Weather,
+	StatusEffect,
+	Progression,
+	Time,
+	MAX
+};
+
+/**
+ * Tick function for one layer of UStatSystemProComponent
+ * Lets each layer run at its own interval and tick group, ordered by prerequisites
+ */
+USTRUCT()
+struct FStatSystemProLayerTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Component that owns the layer */
+	UStatSystemProComponent* Target = nullptr;
+
+	/** Layer this function advances */
+	EStatSystemProLayer Layer = EStatSystemProLayer::MAX;
+
+	// FTickFunction
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FStatSystemProLayerTickFunction> : public TStructOpsTypeTraitsBase2<FStatSystemProLayerTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+// ============================================================================
+// UNIFIED COMPONENT DELEGATES
+// ============================================================================
+
+// Stat Layer Events
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnStatChanged, EStatType, StatType, float, OldValue, float, NewValue);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatMaxChanged, EStatType, StatType, float, NewMaxValue);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatReachedZero, EStatType, StatType);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatReachedMax, EStatType, StatType);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatCritical, EStatType, StatType, float, CurrentValue);
+
+// Body Layer Events
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBodyPartDamaged, EBodyPart, BodyPart, float, Damage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBodyPartFractured, EBodyPart, BodyPart);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBodyPartBleeding, EBodyPart, BodyPart, float, BleedRate);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBodyPartBurned, EBodyPart, BodyPart, EBurnLevel, BurnLevel);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBodyPartInfected, EBodyPart, BodyPart, float, InfectionRate);
+
+// Weather Layer Events
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWeatherChanged, EWeatherType, OldWeather, EWeatherType, NewWeather);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnClothingEquipped, EClothingSlot, Slot, FClothingItem, Item);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnClothingRemoved, EClothingSlot, Slot);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFreezingStageChanged, EFreezingStage, NewStage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnOverheatingStageChanged, EOverheatingStage, NewStage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTemperatureChanged, float, OldTemp, float, NewTemp);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnClothingWetnessChanged, float, NewWetness);
+
+// Status Effect Events
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatusEffectApplied, FName, EffectID, int32, Stacks);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatusEffectRemoved, FName, EffectID);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatusEffectExpired, FName, EffectID, int32, RemainingStacks);
+
+// Progression Events
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLevelUp, int32, OldLevel, int32, NewLevel);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnXPGained, int32, Amount, int32, NewTotal, EXPSource, Source);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSkillUnlocked, FName, SkillID);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatPointsAwarded, int32, Amount, int32, NewTotal);
+
+// Time Events
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHourChanged, int32, NewHour);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDayChanged, int32, NewDay);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTimeOfDayChanged, ETimeOfDay, OldTimeOfDay, ETimeOfDay, NewTimeOfDay);
+
+/**
+ * ============================================================================
+ * STATSYSTEMPRO LAYER
+ * ============================================================================
+ *
+ * One layer of UStatSystemProComponent: its runtime data, its events and its
+ * tick state, in a separately allocated object.
+ *
+ * The component creates a layer only while its "Enable ... Layer" toggle is on,
+ * so a stat-only NPC carries one layer object and five null pointers.
+ * Tuning (data tables, thresholds, tick intervals) stays on the component.
+ *
+ * MULTIPLAYER: The server creates the layers and replicates them as
+ * subobjects of the component. Clients get them a moment after the component -
+ * bind layer events in the component's OnLayerReady.
+ *
+ * BLUEPRINT: Bind events on the layer, e.g. StatSystem -> Stat Layer -> On Stat Changed.
+ */
+UCLASS(Abstract, DefaultToInstanced, BlueprintType)
+class STATSYSTEMPRO_API UStatSystemProLayer : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Component this layer belongs to */
+	UFUNCTION(BlueprintPure, Category = "StatSystemPro")
+	UStatSystemProComponent* GetOwningComponent() const;
+
+	/** Which layer this is */
+	virtual EStatSystemProLayer GetLayerType() const PURE_VIRTUAL(UStatSystemProLayer::GetLayerType, return EStatSystemProLayer::MAX;);
+
+	/** Memory used by this layer (bytes) - the object plus the heap its containers hold */
+	SIZE_T GetInstanceMemorySize() const;
+
+	// UObject
+	virtual bool IsSupportedForNetworking() const override { return true; }
+
+	// ========== TICK STATE (server) ==========
+
+	/** Advances the layer */
+	FStatSystemProLayerTickFunction TickFunction;
+
+	/** World time the layer was last woken */
+	double WakeTime = 0.0;
+
+protected:
+	/** Heap memory held by the layer's containers */
+	virtual SIZE_T GetAllocatedSize() const { return 0; }
+};
+
+/**
+ * Stat layer - Health, Stamina, Hunger, Thirst, Energy, Blood, Temperature, etc.
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatSystemProStatLayer : public UStatSystemProLayer
+{
+	GENERATED_BODY()
+
+public:
+	UStatSystemProStatLayer();
+
+	virtual EStatSystemProLayer GetLayerType() const override { return EStatSystemProLayer::Stat; }
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** All stat values (Health, Stamina, Hunger, etc.) - dense enum-indexed storage, only changed stats replicate */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Stats, Category = "StatSystemPro|Stat Layer")
+	FStatContainer Stats;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
+	FOnStatChanged OnStatChanged;
+
+	/** Fires at the end of the frame with every stat that changed (the component's bBatchStatChangeEvents only) */
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
+	FOnStatsChangedBatch OnStatsChangedBatch;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
+	FOnStatMaxChanged OnStatMaxChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
+	FOnStatReachedZero OnStatReachedZero;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
+	FOnStatReachedMax OnStatReachedMax;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Stat Layer")
+	FOnStatCritical OnStatCritical;
+
+	// ========== BATCHED EVENTS ==========
+
+	/** Changes accumulated this frame, one record per stat */
+	TArray<FStatChangeRecord> PendingStatChanges;
+
+	/** Index into PendingStatChanges per stat (INDEX_NONE = unchanged this frame) */
+	int32 PendingStatChangeIndices[FStatContainer::Capacity];
+
+	/** Already queued with the batch subsystem this frame */
+	bool bStatChangeFlushQueued = false;
+
+protected:
+	virtual SIZE_T GetAllocatedSize() const override;
+
+private:
+	UFUNCTION()
+	void OnRep_Stats();
+};
+
+/**
+ * Body layer - Body parts, fractures, bleeding, burns, infections, pain
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatSystemProBodyLayer : public UStatSystemProLayer
+{
+	GENERATED_BODY()
+
+public:
+	virtual EStatSystemProLayer GetLayerType() const override { return EStatSystemProLayer::Body; }
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** All body parts and their states */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_BodyParts, Category = "StatSystemPro|Body Layer")
+	TMap<EBodyPart, FBodyPartState> BodyParts;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Body Layer")
+	FOnBodyPartDamaged OnBodyPartDamaged;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Body Layer")
+	FOnBodyPartFractured OnBodyPartFractured;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Body Layer")
+	FOnBodyPartBleeding OnBodyPartBleeding;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Body Layer")
+	FOnBodyPartBurned OnBodyPartBurned;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Body Layer")
+	FOnBodyPartInfected OnBodyPartInfected;
+
+protected:
+	virtual SIZE_T GetAllocatedSize() const override;
+
+private:
+	UFUNCTION()
+	void OnRep_BodyParts();
+};
+
+/**
+ * Weather layer - Weather, temperature, clothing, freezing/overheating
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatSystemProWeatherLayer : public UStatSystemProLayer
+{
+	GENERATED_BODY()
+
+public:
+	UStatSystemProWeatherLayer();
+
+	virtual EStatSystemProLayer GetLayerType() const override { return EStatSystemProLayer::Weather; }
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** Current weather type */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_CurrentWeather, Category = "StatSystemPro|Weather Layer")
+	EWeatherType CurrentWeather;
+
+	/** Ambient temperature (Celsius) */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
+	float AmbientTemperature;
+
+	/** Wind speed (m/s) */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
+	float WindSpeed;
+
+	/** Wetness level (0-100%) */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
+	float WetnessLevel;
+
+	/** Shelter level (0-100%) */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
+	float ShelterLevel;
+
+	/** Currently equipped clothing */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_EquippedClothing, Category = "StatSystemPro|Weather Layer")
+	TMap<EClothingSlot, FClothingItem> EquippedClothing;
+
+	/** Current freezing stage */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
+	EFreezingStage CurrentFreezingStage;
+
+	/** Current overheating stage */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Weather Layer")
+	EOverheatingStage CurrentOverheatingStage;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
+	FOnWeatherChanged OnWeatherChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
+	FOnClothingEquipped OnClothingEquipped;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
+	FOnClothingRemoved OnClothingRemoved;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
+	FOnFreezingStageChanged OnFreezingStageChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
+	FOnOverheatingStageChanged OnOverheatingStageChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
+	FOnTemperatureChanged OnTemperatureChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Weather Layer")
+	FOnClothingWetnessChanged OnClothingWetnessChanged;
+
+protected:
+	virtual SIZE_T GetAllocatedSize() const override;
+
+private:
+	UFUNCTION()
+	void OnRep_CurrentWeather();
+
+	UFUNCTION()
+	void OnRep_EquippedClothing();
+};
+
+/**
+ * Status effect layer - Buffs, debuffs, stackable effects, timed effects
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatSystemProStatusEffectLayer : public UStatSystemProLayer
+{
+	GENERATED_BODY()
+
+public:
+	virtual EStatSystemProLayer GetLayerType() const override { return EStatSystemProLayer::StatusEffect; }
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** All active status effects */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_ActiveEffects, Category = "StatSystemPro|Status Effect Layer")
+	TArray<FActiveStatusEffect> ActiveEffects;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Status Effect Layer")
+	FOnStatusEffectApplied OnStatusEffectApplied;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Status Effect Layer")
+	FOnStatusEffectRemoved OnStatusEffectRemoved;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Status Effect Layer")
+	FOnStatusEffectExpired OnStatusEffectExpired;
+
+protected:
+	virtual SIZE_T GetAllocatedSize() const override;
+
+private:
+	UFUNCTION()
+	void OnRep_ActiveEffects();
+};
+
+/**
+ * Progression layer - XP, levels, skills, stat points
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatSystemProProgressionLayer : public UStatSystemProLayer
+{
+	GENERATED_BODY()
+
+public:
+	UStatSystemProProgressionLayer();
+
+	virtual EStatSystemProLayer GetLayerType() const override { return EStatSystemProLayer::Progression; }
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** Current level */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Progression Layer")
+	int32 CurrentLevel;
+
+	/** Current XP */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Progression Layer")
+	int32 CurrentXP;
+
+	/** Available stat points */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Progression Layer")
+	int32 StatPoints;
+
+	/** Unlocked skills */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Progression Layer")
+	TArray<FName> UnlockedSkills;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Progression Layer")
+	FOnLevelUp OnLevelUp;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Progression Layer")
+	FOnXPGained OnXPGained;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Progression Layer")
+	FOnSkillUnlocked OnSkillUnlocked;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Progression Layer")
+	FOnStatPointsAwarded OnStatPointsAwarded;
+
+protected:
+	virtual SIZE_T GetAllocatedSize() const override;
+};
+
+/**
+ * Time layer - Global time, day/night cycle
+ */
+UCLASS()
+class STATSYSTEMPRO_API UStatSystemProTimeLayer : public UStatSystemProLayer
+{
+	GENERATED_BODY()
+
+public:
+	UStatSystemProTimeLayer();
+
+	virtual EStatSystemProLayer GetLayerType() const override { return EStatSystemProLayer::Time; }
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** Current game time (in seconds since start) */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Time Layer")
+	float CurrentGameTime;
+
+	/** Current hour (0-23) */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Time Layer")
+	int32 CurrentHour;
+
+	/** Current day */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Time Layer")
+	int32 CurrentDay;
+
+	/** Current time of day */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "StatSystemPro|Time Layer")
+	ETimeOfDay CurrentTimeOfDay;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Time Layer")
+	FOnHourChanged OnHourChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Time Layer")
+	FOnDayChanged OnDayChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "StatSystemPro|Events|Time Layer")
+	FOnTimeOfDayChanged OnTimeOfDayChanged;
+};
@@ -6,6 +6,8 @@
 #include "Engine/DeveloperSettings.h"
 #include "StatSystemProSettings.generated.h"
 
+class UDataTable;
+
 /**
  * ============================================================================
  * STAT SYSTEM PRO SETTINGS
@@ -59,6 +61,21 @@ public:
 	))
 	bool bDefaultUseSimpleMode;
 
+	/**
+	 * Custom stat definitions, added to every stat component after the built-in stats
+	 * CUSTOMIZATION: Data tables with row type FCustomStatDefinitionRow
+	 *
+	 * NOTES:
+	 * - Loaded once at startup; server and clients must use the same tables
+	 * - Up to 14 custom stats (32 stat slots in total)
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Stat Layer", meta=(
+		DisplayName = "Custom Stat Tables",
+		Tooltip = "Data tables (row type: Custom Stat Definition Row) defining stats beyond the built-in ones",
+		RequiredAssetDataTags = "RowStructure=/Script/StatSystemPro.CustomStatDefinitionRow"
+	))
+	TArray<TSoftObjectPtr<UDataTable>> CustomStatTables;
+
 	// ========== BODY LAYER SETTINGS ==========
 
 	/**
@@ -277,6 +294,156 @@ public:
 	))
 	float StatUpdateInterval;
 
+	/**
+	 * Near significance distance (cm)
+	 * CUSTOMIZATION: Actors closer than this to a player tick at (almost) full rate
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Significance Near Distance",
+		Tooltip = "Distance (cm) to the nearest player below which an actor's stat layers tick at near-full rate",
+		ClampMin = "0.0",
+		EditCondition = "bEnableTickOptimization"
+	))
+	float SignificanceNearDistance;
+
+	/**
+	 * Far significance distance (cm)
+	 * CUSTOMIZATION: Actors beyond this from every player tick at the slowest rate
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Significance Far Distance",
+		Tooltip = "Distance (cm) to the nearest player beyond which an actor's stat layers tick at the slowest rate",
+		ClampMin = "0.0",
+		EditCondition = "bEnableTickOptimization"
+	))
+	float SignificanceFarDistance;
+
+	/**
+	 * Significance update interval (seconds)
+	 * CUSTOMIZATION: How often actors are re-ranked by distance and visibility
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Significance Update Interval",
+		Tooltip = "How often (in seconds) each actor's significance is re-evaluated",
+		ClampMin = "0.05",
+		ClampMax = "5.0",
+		EditCondition = "bEnableTickOptimization"
+	))
+	float SignificanceUpdateInterval;
+
+	/**
+	 * Fixed timestep simulation
+	 * CUSTOMIZATION: Integrate regen, bleeding, temperature and weather in constant steps so results don't depend on frame rate
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Use Fixed Timestep",
+		Tooltip = "Advance the simulation layers in fixed-size steps (same results at any frame or server tick rate)"
+	))
+	bool bUseFixedTimestep;
+
+	/**
+	 * Fixed timestep size (seconds)
+	 * CUSTOMIZATION: Smaller = more accurate, larger = cheaper
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Fixed Timestep",
+		Tooltip = "Size (in seconds) of one simulation step",
+		ClampMin = "0.005",
+		ClampMax = "1.0",
+		EditCondition = "bUseFixedTimestep"
+	))
+	float FixedTimestep;
+
+	/**
+	 * Max fixed steps per frame
+	 * CUSTOMIZATION: Caps catch-up work after a hitch - the rest is caught up over the following frames
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Max Fixed Steps Per Frame",
+		Tooltip = "Most steps one component or subsystem runs per tick. Leftover time is kept and caught up later, never dropped.",
+		ClampMin = "1",
+		ClampMax = "256",
+		EditCondition = "bUseFixedTimestep"
+	))
+	int32 MaxFixedStepsPerFrame;
+
+	/**
+	 * Batch stat regeneration in a world subsystem
+	 * CUSTOMIZATION: Advance every component's regeneration in one pass instead of one tick per component
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Use Batched Stat Simulation",
+		Tooltip = "Regenerate all stat components together in one world subsystem tick (recommended for many actors: ON)"
+	))
+	bool bUseBatchedStatSimulation;
+
+	/**
+	 * Compute layer stat changes in parallel
+	 * CUSTOMIZATION: Body, environment and weather layers compute their stat deltas on worker threads, then apply them together on the game thread
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Use Parallel Layer Simulation",
+		Tooltip = "Run body/environment/weather layer updates for all actors in one world subsystem tick, computed in parallel (recommended for many actors: ON)"
+	))
+	bool bUseParallelLayerSimulation;
+
+	/**
+	 * Parallel layer simulation batch size
+	 * CUSTOMIZATION: Minimum layer components per worker task (fewer = more tasks, more scheduling overhead)
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Parallel Layer Min Batch Size",
+		Tooltip = "Minimum number of layer components each worker thread processes at once",
+		ClampMin = "1",
+		EditCondition = "bUseParallelLayerSimulation"
+	))
+	int32 ParallelLayerMinBatchSize;
+
+	/**
+	 * Put idle layers to sleep
+	 * CUSTOMIZATION: Unified component layers with nothing to advance stop ticking until a change wakes them
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Use Component Dormancy",
+		Tooltip = "Stop ticking layers that have no pending work (stats full, no bleeding, stable temperature, no timed effects). Any change wakes them again (recommended: ON)"
+	))
+	bool bUseComponentDormancy;
+
+	/**
+	 * Bake regeneration curves into lookup tables
+	 * CUSTOMIZATION: Replace per-tick curve evaluation with a shared, linearly interpolated table
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Use Regeneration Curve LUTs",
+		Tooltip = "Bake regeneration curves into lookup tables shared by every component using the same curve (recommended: ON)"
+	))
+	bool bUseCurveLUTs;
+
+	/**
+	 * Regeneration curve LUT resolution
+	 * CUSTOMIZATION: Samples per curve (raised automatically if the max error check fails)
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Curve LUT Resolution",
+		Tooltip = "Number of segments each regeneration curve is baked into over 0-100%",
+		ClampMin = "8",
+		ClampMax = "1024",
+		EditCondition = "bUseCurveLUTs"
+	))
+	int32 CurveLUTResolution;
+
+	/**
+	 * Regeneration curve LUT max error
+	 * CUSTOMIZATION: Largest allowed difference between the table and the source curve
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta=(
+		DisplayName = "Curve LUT Max Error",
+		Tooltip = "Maximum allowed difference (regen per second) between a baked table and its curve. Resolution is increased until this is met.",
+		ClampMin = "0.0",
+		EditCondition = "bUseCurveLUTs"
+	))
+	float CurveLUTMaxError;
+
 	/**
 	 * Enable debug logging
 	 * CUSTOMIZATION: Show debug messages in log
@@ -287,6 +454,16 @@ public:
 	))
 	bool bEnableDebugLogging;
 
+	/**
+	 * Validate stat aggregates
+	 * CUSTOMIZATION: Cross-check the incrementally maintained aggregates against a full scan on every read (non-shipping builds)
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Debug", meta=(
+		DisplayName = "Validate Stat Aggregates",
+		Tooltip = "Recompute lowest/highest/average/critical stats from scratch on every query and log a warning on mismatch (slow, non-shipping only)"
+	))
+	bool bValidateStatAggregates;
+
 	// Utility function to get settings
 	static const UStatSystemProSettings* Get()
 	{
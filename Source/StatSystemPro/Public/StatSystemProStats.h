@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * ============================================================================
+ * STATSYSTEMPRO STATS - Profiling Counters
+ * ============================================================================
+ *
+ * Cycle counters around every layer update and the hot stat paths, plus
+ * per-frame counts of the work done. Both the unified component and the
+ * per-layer components (and the subsystems driving them) report here.
+ *
+ * VIEW IN GAME:  stat StatSystemPro
+ * Compiled out with the rest of the stats system (STATS=0, e.g. Shipping).
+ */
+DECLARE_STATS_GROUP(TEXT("StatSystemPro"), STATGROUP_StatSystemPro, STATCAT_Advanced);
+
+// ========== LAYER UPDATES ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stat Layer"), STAT_StatSystemPro_StatLayer, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Body Layer"), STAT_StatSystemPro_BodyLayer, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Environment Layer"), STAT_StatSystemPro_EnvironmentLayer, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Weather Layer"), STAT_StatSystemPro_WeatherLayer, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Status Effect Layer"), STAT_StatSystemPro_StatusEffectLayer, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Progression Layer"), STAT_StatSystemPro_ProgressionLayer, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Time Layer"), STAT_StatSystemPro_TimeLayer, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+
+// ========== HOT PATHS ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Stat Change"), STAT_StatSystemPro_ApplyStatChange, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Broadcast Stat Events"), STAT_StatSystemPro_BroadcastStatEvents, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Effective Temperature"), STAT_StatSystemPro_EffectiveTemperature, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+
+// ========== SAVE / LOAD ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Save"), STAT_StatSystemPro_Save, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Load"), STAT_StatSystemPro_Load, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+
+// ========== PER-FRAME COUNTERS ==========
+
+/** Component ticks, unified-component layer ticks and components advanced by the simulation subsystems */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Components Ticked"), STAT_StatSystemPro_ComponentsTicked, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+
+/** Stat deltas applied (a batch of N deltas counts N) */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Stat Changes Applied"), STAT_StatSystemPro_StatChangesApplied, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
+
+/** Stat changed events broadcast */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Events Broadcast"), STAT_StatSystemPro_EventsBroadcast, STATGROUP_StatSystemPro, STATSYSTEMPRO_API);
@@ -0,0 +1,132 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "GameplayTagContainer.h"
+#include "StatLayer/StatTypes.h"
+#include "BodyLayer/BodyTypes.h"
+
+class UActorComponent;
+
+/**
+ * ============================================================================
+ * STATSYSTEMPRO TRACE - Unreal Insights Events
+ * ============================================================================
+ *
+ * Per-actor timeline of what the stat system did, on its own trace channel:
+ *   StatChanged        - stat, old/new value, source and reason tag
+ *   EffectApplied      - effect ID, stacks
+ *   EffectRemoved      - effect ID, expired or removed
+ *   BodyPartDamaged    - part, damage, part health after the hit
+ *   TemperatureStage   - freezing/overheating stage transitions
+ *   LayerTick          - start/end cycles of one layer tick (component or
+ *                        unified-component layer; subsystem batches only
+ *                        show in the STATGROUP_StatSystemPro cycle stats)
+ *
+ * Every event carries the owning actor's object ID (the same ID the object
+ * channel uses, so Insights/Rewind Debugger resolve it to the actor).
+ *
+ * ENABLE:  -trace=StatSystemPro,Object   (or "Trace.Enable StatSystemPro")
+ *
+ * COST:
+ * - Compiled out in Shipping (or with STATSYSTEMPRO_TRACE_ENABLED=0)
+ * - Otherwise each macro is one channel check; arguments are only evaluated
+ *   when the channel is on
+ *
+ * Use the TRACE_STATSYSTEMPRO_* macros, not FStatSystemProTrace directly.
+ */
+
+#ifndef STATSYSTEMPRO_TRACE_ENABLED
+#define STATSYSTEMPRO_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+/** Which layer a LayerTick span belongs to (shared by the layer components and UStatSystemProComponent) */
+enum class EStatSystemProTraceLayer : uint8
+{
+	Stat,
+	Body,
+	Environment,
+	Weather,
+	StatusEffect,
+	Progression,
+	Time
+};
+
+/** Which temperature stage a TemperatureStage event belongs to */
+enum class EStatSystemProTraceTemperature : uint8
+{
+	Freezing,
+	Overheating
+};
+
+#if STATSYSTEMPRO_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(StatSystemProChannel, STATSYSTEMPRO_API);
+
+struct STATSYSTEMPRO_API FStatSystemProTrace
+{
+	static void OutputStatChanged(const UActorComponent* Component, EStatType StatType, float OldValue, float NewValue, FName Source, const FGameplayTag& ReasonTag);
+	static void OutputEffectApplied(const UActorComponent* Component, FName EffectID, int32 Stacks);
+	static void OutputEffectRemoved(const UActorComponent* Component, FName EffectID, bool bExpired);
+	static void OutputBodyPartDamaged(const UActorComponent* Component, EBodyPart BodyPart, float Damage, float HealthAfter);
+	static void OutputTemperatureStage(const UActorComponent* Component, EStatSystemProTraceTemperature Kind, uint8 OldStage, uint8 NewStage, float BodyTemperature);
+	static void OutputLayerTick(const UActorComponent* Component, EStatSystemProTraceLayer Layer, uint64 StartCycle, uint64 EndCycle);
+};
+
+/** Emits a LayerTick span when it goes out of scope (only if the channel was on when it was created) */
+struct FStatSystemProTraceLayerScope
+{
+	FStatSystemProTraceLayerScope(const UActorComponent* InComponent, EStatSystemProTraceLayer InLayer)
+		: Component(InComponent)
+		, Layer(InLayer)
+		, StartCycle(UE_TRACE_CHANNELEXPR_IS_ENABLED(StatSystemProChannel) ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FStatSystemProTraceLayerScope()
+	{
+		if (StartCycle != 0)
+		{
+			FStatSystemProTrace::OutputLayerTick(Component, Layer, StartCycle, FPlatformTime::Cycles64());
+		}
+	}
+
+private:
+	const UActorComponent* Component;
+	EStatSystemProTraceLayer Layer;
+	uint64 StartCycle;
+};
+
+#define STATSYSTEMPRO_TRACE_GATED(Call) \
+	do { if (UE_TRACE_CHANNELEXPR_IS_ENABLED(StatSystemProChannel)) { Call; } } while (0)
+
+#define TRACE_STATSYSTEMPRO_STAT_CHANGED(Component, StatType, OldValue, NewValue, Source, ReasonTag) \
+	STATSYSTEMPRO_TRACE_GATED(FStatSystemProTrace::OutputStatChanged(Component, StatType, OldValue, NewValue, Source, ReasonTag))
+
+#define TRACE_STATSYSTEMPRO_EFFECT_APPLIED(Component, EffectID, Stacks) \
+	STATSYSTEMPRO_TRACE_GATED(FStatSystemProTrace::OutputEffectApplied(Component, EffectID, Stacks))
+
+#define TRACE_STATSYSTEMPRO_EFFECT_REMOVED(Component, EffectID, bExpired) \
+	STATSYSTEMPRO_TRACE_GATED(FStatSystemProTrace::OutputEffectRemoved(Component, EffectID, bExpired))
+
+#define TRACE_STATSYSTEMPRO_BODY_PART_DAMAGED(Component, BodyPart, Damage, HealthAfter) \
+	STATSYSTEMPRO_TRACE_GATED(FStatSystemProTrace::OutputBodyPartDamaged(Component, BodyPart, Damage, HealthAfter))
+
+#define TRACE_STATSYSTEMPRO_TEMPERATURE_STAGE(Component, Kind, OldStage, NewStage, BodyTemperature) \
+	STATSYSTEMPRO_TRACE_GATED(FStatSystemProTrace::OutputTemperatureStage(Component, Kind, (uint8)(OldStage), (uint8)(NewStage), BodyTemperature))
+
+#define TRACE_STATSYSTEMPRO_LAYER_SCOPE(Component, Layer) \
+	FStatSystemProTraceLayerScope ANONYMOUS_VARIABLE(StatSystemProLayerScope_)(Component, Layer)
+
+#else
+
+#define TRACE_STATSYSTEMPRO_STAT_CHANGED(...)
+#define TRACE_STATSYSTEMPRO_EFFECT_APPLIED(...)
+#define TRACE_STATSYSTEMPRO_EFFECT_REMOVED(...)
+#define TRACE_STATSYSTEMPRO_BODY_PART_DAMAGED(...)
+#define TRACE_STATSYSTEMPRO_TEMPERATURE_STAGE(...)
+#define TRACE_STATSYSTEMPRO_LAYER_SCOPE(...)
+
+#endif // STATSYSTEMPRO_TRACE_ENABLED
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "StatusEffectLayer/StatusEffectTypes.h"
+#include "StatLayer/StatTypes.h"
 #include "StatusEffectComponent.generated.h"
 
 // Forward declarations
@@ -126,10 +127,25 @@ private:
 	void UpdateEffectTimers(float DeltaTime);
 
 	/**
-	 * Apply effect modifiers to stats
+	 * Register the stat modifiers of every active effect with the stat component
 	 */
 	void ApplyEffectModifiers();
 
+	/**
+	 * Replace one effect's stat modifiers (after it was applied, stacked or refreshed)
+	 */
+	void RefreshEffectModifiers(const FActiveStatusEffect& Effect);
+
+	/**
+	 * Remove one effect's stat modifiers
+	 */
+	void RemoveEffectModifiers(FName EffectID);
+
+	/**
+	 * Map a modifier's stat name (enum name, display name or custom StatID) to a stat type
+	 */
+	static bool ResolveStatType(FName StatName, EStatType& OutStatType);
+
 	/**
 	 * Find effect data in the data table
 	 */
@@ -6,6 +6,8 @@
 #include "Components/ActorComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "WeatherSystem/WeatherTypes.h"
+#include "Simulation/StatFixedStep.h"
+#include "Simulation/StatLayerSimulationSubsystem.h"
 #include "WeatherComponent.generated.h"
 
 // Events
@@ -40,7 +42,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStartedOverheating, float, BodyTe
  * - Environment Component (temperature, wind, rain)
  */
 UCLASS(ClassGroup=(StatSystemPro), meta=(BlueprintSpawnableComponent, DisplayName="Weather Component (Advanced)"))
-class STATSYSTEMPRO_API UWeatherComponent : public UActorComponent
+class STATSYSTEMPRO_API UWeatherComponent : public UActorComponent, public IStatLayerSimulationClient
 {
 	GENERATED_BODY()
 
@@ -52,8 +54,15 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
+	// IStatLayerSimulationClient
+	virtual UStatComponent* GetLayerStatTarget() const override;
+	virtual bool ShouldSimulateLayer() const override;
+	virtual void ComputeLayerStatDeltas(const UStatComponent* Target, float DeltaTime, TArray<FStatDelta>& OutDeltas) override;
+	virtual void PostLayerStatDeltasApplied(float DeltaTime) override;
+
 	// ========== CONFIGURATION ==========
 
 	/** Enable/Disable weather system */
@@ -362,8 +371,11 @@ private:
 	/** Previous overheating stage */
 	EOverheatingStage PreviousOverheatingStage;
 
-	/** Update temperature effects */
-	void UpdateTemperatureEffects(float DeltaTime);
+	/** Frame time -> fixed weather steps */
+	FStatFixedStepAccumulator FixedStep;
+
+	/** Body temperature change over DeltaTime */
+	float CalculateBodyTemperatureChange(float BodyTemp, float DeltaTime) const;
 
 	/** Update clothing wetness */
 	void UpdateClothingWetness(float DeltaTime);
@@ -371,8 +383,20 @@ private:
 	/** Update freezing/overheating stages */
 	void UpdateTemperatureStages();
 
-	/** Apply temperature damage/effects */
-	void ApplyTemperatureEffects(float DeltaTime);
+	/**
+	 * Hand the stat updates over to the world's layer simulation subsystem (server only)
+	 */
+	void RegisterWithLayerSimulation();
+
+	/** Subsystem computing our stat deltas (null = we tick ourselves) */
+	UPROPERTY(Transient)
+	UStatLayerSimulationSubsystem* LayerSimulation;
+
+	/** Registration handle with LayerSimulation */
+	int32 LayerSimulationHandle;
+
+	/** Deltas collected by our own tick (reused) */
+	TArray<FStatDelta> TickStatDeltas;
 
 	/** Replication callbacks */
 	UFUNCTION()
@@ -28,7 +28,8 @@ public class StatSystemPro : ModuleRules
 				"Core",
 				"CoreUObject",
 				"Engine",
-				"GameplayTags"
+				"GameplayTags",
+				"NetCore"
 			}
 		);
 